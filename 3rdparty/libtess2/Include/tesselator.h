@@ -130,7 +130,17 @@ enum TessOption
 };
 
 typedef float TESSreal;
+// vg-renderer: Must match vg::index_t (see VG_CONFIG_INDEX_UINT32 in vg/config.h)
+// libtess2 is compiled separately so the index type is made part of the name of tessNewTess().
+// Linking a libtess2 built with a different VG_CONFIG_INDEX_UINT32 value fails instead of
+// silently mixing index sizes.
+#if defined(VG_CONFIG_INDEX_UINT32) && VG_CONFIG_INDEX_UINT32
+typedef unsigned int TESSindex;
+#define tessNewTess tessNewTess_index32
+#else
 typedef unsigned short TESSindex;
+#define tessNewTess tessNewTess_index16
+#endif
 typedef struct TESStesselator TESStesselator;
 typedef struct TESSalloc TESSalloc;
 
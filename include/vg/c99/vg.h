@@ -12,6 +12,12 @@ typedef int16_t vg_uv_t;
 typedef float vg_uv_t;
 #endif
 
+#if VG_CONFIG_INDEX_UINT32
+typedef uint32_t vg_index_t;
+#else
+typedef uint16_t vg_index_t;
+#endif
+
 typedef uint32_t vg_color;
 
 #if defined(__cplusplus)
@@ -119,6 +125,8 @@ typedef enum vg_fill_flags
 	VG_FILL_FLAGS_CONCAVE_EVEN_ODD    = VG_FILL_FLAGS(VG_PATH_TYPE_CONCAVE, VG_FILL_RULE_EVEN_ODD, 0),
 	VG_FILL_FLAGS_CONCAVE_NON_ZERO_AA = VG_FILL_FLAGS(VG_PATH_TYPE_CONCAVE, VG_FILL_RULE_NON_ZERO, 1),
 	VG_FILL_FLAGS_CONCAVE_EVEN_ODD_AA = VG_FILL_FLAGS(VG_PATH_TYPE_CONCAVE, VG_FILL_RULE_EVEN_ODD, 1),
+
+	VG_FILL_FLAGS_STENCIL_COVER       = VG_FILL_FLAGS_STENCIL_COVER_Msk
 } vg_fill_flags;
 
 typedef enum vg_winding
@@ -163,6 +171,7 @@ typedef struct vg_image_pattern_handle { uint32_t idx; } vg_image_pattern_handle
 typedef struct vg_image_handle         { uint16_t idx; } vg_image_handle;
 typedef struct vg_font_handle          { uint16_t idx; } vg_font_handle;
 typedef struct vg_command_list_handle  { uint16_t idx; } vg_command_list_handle;
+typedef struct vg_layer_handle         { uint16_t idx; } vg_layer_handle;
 
 #undef VG_INVALID_HANDLE
 #define VG_INVALID_HANDLE(type)        (type){ .idx = UINT16_MAX }
@@ -184,9 +193,15 @@ typedef struct vg_context_config
 	uint16_t m_MaxStateStackSize;   // default: 32
 	uint16_t m_MaxImages;           // default: 16
 	uint16_t m_MaxCommandLists;     // default: 256
-	uint32_t m_MaxVBVertices;       // default: 65536
+	uint32_t m_MaxVBVertices;       // default: 65536 (max 65536 unless VG_CONFIG_INDEX_UINT32 is set)
 	uint32_t m_FontAtlasImageFlags; // default: ImageFlags::Filter_Bilinear
 	uint32_t m_MaxCommandListDepth; // default: 16
+	uint32_t m_NumRecordingShards;  // default: 1
+	uint32_t m_MaxCachedLODs;       // default: 4
+	float m_CacheScaleTolerance;    // default: 0.1f
+	uint32_t m_MaxCacheMemory;      // default: 64 MB
+	uint32_t m_MaxLayers;           // default: 8
+	uint32_t m_GlyphRasterization;  // default: VG_GLYPH_RASTERIZATION_IMMEDIATE
 } vg_context_config;
 
 typedef struct vg_stats
@@ -237,6 +252,8 @@ typedef enum vg_command_list_flags
 	VG_COMMAND_LIST_FLAGS_NONE                  = 0,
 	VG_COMMAND_LIST_FLAGS_CACHEABLE             = 1u << 0, // Cache the generated geometry in order to avoid retesselation every frame; uses extra memory
 	VG_COMMAND_LIST_FLAGS_ALLOW_COMMAND_CULLING = 1u << 1, // If the scissor rect ends up being zero-sized, don't execute fill/stroke commands.
+	VG_COMMAND_LIST_FLAGS_RETAINED              = 1u << 2, // Keep the cached geometry in static GPU buffers and only change the transform on resubmission; requires Cacheable
+	VG_COMMAND_LIST_FLAGS_GPU_TRANSFORM         = 1u << 3, // Draw cached solid color meshes using a model matrix instead of transforming their vertices on the CPU; requires Cacheable
 } vg_command_list_flags;
 
 typedef enum vg_font_flags
@@ -245,6 +262,13 @@ typedef enum vg_font_flags
 	VG_FONT_FLAGS_DONT_COPY_DATA = 1u << 0, // The calling code will keep the font data alive for as long as the Context is alive so there's no need to copy the data internally.
 } vg_font_flags;
 
+typedef enum vg_glyph_rasterization
+{
+	VG_GLYPH_RASTERIZATION_IMMEDIATE            = 0,
+	VG_GLYPH_RASTERIZATION_DEFERRED_BLOCK       = 1,
+	VG_GLYPH_RASTERIZATION_DEFERRED_PLACEHOLDER = 2,
+} vg_glyph_rasterization;
+
 static vg_color vg_color4f(float r, float g, float b, float a);
 static vg_color vg_color4ub(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 static vg_color vg_colorSetAlpha(vg_color c, uint8_t a);
@@ -262,6 +286,9 @@ VG_C_API void vg_begin(vg_context* ctx, uint16_t viewID, uint16_t canvasWidth, u
 VG_C_API void vg_end(vg_context* ctx);
 VG_C_API void vg_frame(vg_context* ctx);
 VG_C_API const vg_stats* vg_getStats(vg_context* ctx);
+VG_C_API void vg_setDirtyRectTracking(vg_context* ctx, bool enable);
+VG_C_API void vg_addDirtyRect(vg_context* ctx, float x, float y, float w, float h);
+VG_C_API bool vg_getDirtyRect(vg_context* ctx, float* rect);
 
 VG_C_API void vg_beginPath(vg_context* ctx);
 VG_C_API void vg_moveTo(vg_context* ctx, float x, float y);
@@ -318,6 +345,7 @@ VG_C_API void vg_measureTextBox(vg_context* ctx, const vg_text_config* cfg, floa
 VG_C_API float vg_getTextLineHeight(vg_context* ctx, const vg_text_config* cfg);
 VG_C_API int32_t vg_textBreakLines(vg_context* ctx, const vg_text_config* cfg, const char* str, const char* end, float breakRowWidth, vg_text_row* rows, int32_t maxRows, uint32_t flags);
 VG_C_API int32_t vg_textGlyphPositions(vg_context* ctx, const vg_text_config* cfg, float x, float y, const char* text, const char* end, vg_glyph_position* positions, int32_t maxPositions);
+VG_C_API uint32_t vg_rasterizeGlyphs(vg_context* ctx, uint32_t maxGlyphs);
 
 /*
  * pos: A list of 2D vertices (successive x,y pairs)
@@ -329,7 +357,10 @@ VG_C_API int32_t vg_textGlyphPositions(vg_context* ctx, const vg_text_config* cf
  * numIndices: The number of indices
  * img (optional): The image to use for this draw call (created via createImage()) or VG_INVALID_HANDLE in case you don't have an image (colored tri-list).
  */
-VG_C_API void vg_indexedTriList(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, vg_image_handle img);
+VG_C_API void vg_indexedTriList(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img);
+VG_C_API void vg_fillPathInstanced(vg_context* ctx, vg_color color, uint32_t flags, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances);
+VG_C_API void vg_strokePathInstanced(vg_context* ctx, vg_color color, float width, uint32_t flags, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances);
+VG_C_API void vg_indexedTriListInstanced(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances);
 
 VG_C_API bool vg_getImageSize(vg_context* ctx, vg_image_handle handle, uint16_t* w, uint16_t* h);
 VG_C_API vg_image_handle vg_createImage(vg_context* ctx, uint16_t w, uint16_t h, uint32_t flags, const uint8_t* data);
@@ -338,11 +369,20 @@ VG_C_API bool vg_updateImage(vg_context* ctx, vg_image_handle image, uint16_t x,
 VG_C_API bool vg_destroyImage(vg_context* ctx, vg_image_handle img);
 VG_C_API bool vg_isImageValid(vg_context* ctx, vg_image_handle img);
 
+VG_C_API vg_layer_handle vg_createLayer(vg_context* ctx, uint16_t width, uint16_t height, uint32_t imageFlags);
+VG_C_API void vg_destroyLayer(vg_context* ctx, vg_layer_handle handle);
+VG_C_API void vg_invalidateLayer(vg_context* ctx, vg_layer_handle handle);
+VG_C_API vg_image_handle vg_getLayerImage(vg_context* ctx, vg_layer_handle handle);
+VG_C_API bool vg_beginLayer(vg_context* ctx, vg_layer_handle handle, uint16_t viewID);
+VG_C_API void vg_endLayer(vg_context* ctx);
+
 // Command lists
 VG_C_API vg_command_list_handle vg_createCommandList(vg_context* ctx, uint32_t flags);
+VG_C_API vg_command_list_handle vg_createCommandList_shard(vg_context* ctx, uint32_t flags, uint16_t shardID);
 VG_C_API void vg_destroyCommandList(vg_context* ctx, vg_command_list_handle handle);
 VG_C_API void vg_resetCommandList(vg_context* ctx, vg_command_list_handle handle);
 VG_C_API void vg_submitCommandList(vg_context* ctx, vg_command_list_handle handle);
+VG_C_API bool vg_prepareCommandList(vg_context* ctx, vg_command_list_handle handle, uint16_t shardID);
 
 VG_C_API void vg_clBeginPath(vg_context* ctx, vg_command_list_handle handle);
 VG_C_API void vg_clMoveTo(vg_context* ctx, vg_command_list_handle handle, float x, float y);
@@ -358,7 +398,7 @@ VG_C_API void vg_clCircle(vg_context* ctx, vg_command_list_handle handle, float
 VG_C_API void vg_clEllipse(vg_context* ctx, vg_command_list_handle handle, float cx, float cy, float rx, float ry);
 VG_C_API void vg_clPolyline(vg_context* ctx, vg_command_list_handle handle, const float* coords, uint32_t numPoints);
 VG_C_API void vg_clClosePath(vg_context* ctx, vg_command_list_handle handle);
-VG_C_API void vg_clIndexedTriList(vg_context* ctx, vg_command_list_handle handle, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, vg_image_handle img);
+VG_C_API void vg_clIndexedTriList(vg_context* ctx, vg_command_list_handle handle, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img);
 VG_C_API void vg_clFillPath_color(vg_context* ctx, vg_command_list_handle handle, vg_color color, uint32_t flags);
 VG_C_API void vg_clFillPath_gradient(vg_context* ctx, vg_command_list_handle handle, vg_gradient_handle gradient, uint32_t flags);
 VG_C_API void vg_clFillPath_imagePattern(vg_context* ctx, vg_command_list_handle handle, vg_image_pattern_handle img, vg_color color, uint32_t flags);
@@ -390,6 +430,13 @@ VG_C_API void vg_clText(vg_context* ctx, vg_command_list_handle handle, const vg
 VG_C_API void vg_clTextBox(vg_context* ctx, vg_command_list_handle handle, const vg_text_config* cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textboxFlags);
 
 VG_C_API void vg_clSubmitCommandList(vg_context* ctx, vg_command_list_handle parent, vg_command_list_handle child);
+VG_C_API void vg_clBeginLayer(vg_context* ctx, vg_command_list_handle handle, vg_layer_handle layer, uint16_t viewID);
+VG_C_API void vg_clEndLayer(vg_context* ctx, vg_command_list_handle handle);
+
+VG_C_API uint32_t vg_clGetNextCommandID(vg_context* ctx, vg_command_list_handle handle);
+VG_C_API void vg_clSetCommandColor(vg_context* ctx, vg_command_list_handle handle, uint32_t cmdID, vg_color color);
+VG_C_API void vg_clSetCommandVisible(vg_context* ctx, vg_command_list_handle handle, uint32_t cmdID, bool visible);
+VG_C_API void vg_clReplaceCommandPath(vg_context* ctx, vg_command_list_handle handle, uint32_t cmdID, vg_command_list_handle pathList);
 
 typedef struct vg_api
 {
@@ -467,7 +514,7 @@ typedef struct vg_api
 	 * numIndices: The number of indices
 	 * img (optional): The image to use for this draw call (created via createImage()) or VG_INVALID_HANDLE in case you don't have an image (colored tri-list).
 	 */
-	void (*indexedTriList)(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, vg_image_handle img);
+	void (*indexedTriList)(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img);
 
 	bool (*getImageSize)(vg_context* ctx, vg_image_handle handle, uint16_t* w, uint16_t* h);
 	vg_image_handle (*createImage)(vg_context* ctx, uint16_t w, uint16_t h, uint32_t flags, const uint8_t* data);
@@ -478,9 +525,11 @@ typedef struct vg_api
 
 	// Command lists
 	vg_command_list_handle (*createCommandList)(vg_context* ctx, uint32_t flags);
+	vg_command_list_handle (*createCommandList_shard)(vg_context* ctx, uint32_t flags, uint16_t shardID);
 	void (*destroyCommandList)(vg_context* ctx, vg_command_list_handle handle);
 	void (*resetCommandList)(vg_context* ctx, vg_command_list_handle handle);
 	void (*submitCommandList)(vg_context* ctx, vg_command_list_handle handle);
+	bool (*prepareCommandList)(vg_context* ctx, vg_command_list_handle handle, uint16_t shardID);
 
 	void (*clBeginPath)(vg_context* ctx, vg_command_list_handle handle);
 	void (*clMoveTo)(vg_context* ctx, vg_command_list_handle handle, float x, float y);
@@ -496,7 +545,7 @@ typedef struct vg_api
 	void (*clEllipse)(vg_context* ctx, vg_command_list_handle handle, float cx, float cy, float rx, float ry);
 	void (*clPolyline)(vg_context* ctx, vg_command_list_handle handle, const float* coords, uint32_t numPoints);
 	void (*clClosePath)(vg_context* ctx, vg_command_list_handle handle);
-	void (*clIndexedTriList)(vg_context* ctx, vg_command_list_handle handle, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, vg_image_handle img);
+	void (*clIndexedTriList)(vg_context* ctx, vg_command_list_handle handle, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img);
 	void (*clFillPath_color)(vg_context* ctx, vg_command_list_handle handle, vg_color color, uint32_t flags);
 	void (*clFillPath_gradient)(vg_context* ctx, vg_command_list_handle handle, vg_gradient_handle gradient, uint32_t flags);
 	void (*clFillPath_imagePattern)(vg_context* ctx, vg_command_list_handle handle, vg_image_pattern_handle img, vg_color color, uint32_t flags);
@@ -528,6 +577,29 @@ typedef struct vg_api
 	void (*clTextBox)(vg_context* ctx, vg_command_list_handle handle, const vg_text_config* cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textboxFlags);
 
 	void (*clSubmitCommandList)(vg_context* ctx, vg_command_list_handle parent, vg_command_list_handle child);
+
+	uint32_t (*clGetNextCommandID)(vg_context* ctx, vg_command_list_handle handle);
+	void (*clSetCommandColor)(vg_context* ctx, vg_command_list_handle handle, uint32_t cmdID, vg_color color);
+	void (*clSetCommandVisible)(vg_context* ctx, vg_command_list_handle handle, uint32_t cmdID, bool visible);
+	void (*clReplaceCommandPath)(vg_context* ctx, vg_command_list_handle handle, uint32_t cmdID, vg_command_list_handle pathList);
+
+	void (*fillPathInstanced)(vg_context* ctx, vg_color color, uint32_t flags, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances);
+	void (*strokePathInstanced)(vg_context* ctx, vg_color color, float width, uint32_t flags, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances);
+	void (*indexedTriListInstanced)(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances);
+
+	void (*setDirtyRectTracking)(vg_context* ctx, bool enable);
+	void (*addDirtyRect)(vg_context* ctx, float x, float y, float w, float h);
+	bool (*getDirtyRect)(vg_context* ctx, float* rect);
+
+	vg_layer_handle (*createLayer)(vg_context* ctx, uint16_t width, uint16_t height, uint32_t imageFlags);
+	void (*destroyLayer)(vg_context* ctx, vg_layer_handle handle);
+	void (*invalidateLayer)(vg_context* ctx, vg_layer_handle handle);
+	vg_image_handle (*getLayerImage)(vg_context* ctx, vg_layer_handle handle);
+	bool (*beginLayer)(vg_context* ctx, vg_layer_handle handle, uint16_t viewID);
+	void (*endLayer)(vg_context* ctx);
+	void (*clBeginLayer)(vg_context* ctx, vg_command_list_handle handle, vg_layer_handle layer, uint16_t viewID);
+	void (*clEndLayer)(vg_context* ctx, vg_command_list_handle handle);
+	uint32_t (*rasterizeGlyphs)(vg_context* ctx, uint32_t maxGlyphs);
 } vg_api;
 
 typedef vg_api* (*PFN_VG_GET_API)();
@@ -25,6 +25,36 @@
 #	define VG_CONFIG_UV_INT16 1
 #endif
 
+// If set to 1, draw indices are 32-bit and a single draw call can reference more than 64k vertices
+// (ContextConfig::m_MaxVBVertices can be set above 65536). libtess2 must be compiled with the same
+// value because its TESSindex type is used directly (mismatched builds fail to link).
+#ifndef VG_CONFIG_INDEX_UINT32
+#	define VG_CONFIG_INDEX_UINT32 0
+#endif
+
+// If set to 1, the per-frame vertex buffers hold interleaved vertices (position, UV and color; 16 bytes
+// per vertex with VG_CONFIG_UV_INT16) instead of 3 separate streams. end() issues a single
+// bgfx::update() per vertex buffer and draw calls bind a single vertex stream.
+#ifndef VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+#	define VG_CONFIG_ENABLE_INTERLEAVED_VERTICES 0
+#endif
+
+// If set to 1, the per-frame vertex buffers store positions as int16 fixed point values with
+// VG_CONFIG_POSITION_INT16_FRAC_BITS fractional bits (1/8 px by default) instead of floats. They
+// are mapped back to canvas space by the model matrix of each draw call. Draws inside the
+// representable range ([-4096, 4096] with 3 fractional bits) share the same quantization; larger
+// ones are quantized relative to their own center, with fewer fractional bits if needed, so they
+// are never clamped. The canvas passed to begin() must fit in that range. Cached meshes are
+// transformed on the CPU in this mode. The static GPU buffers of retained command lists still use
+// float positions.
+#ifndef VG_CONFIG_POSITION_INT16
+#	define VG_CONFIG_POSITION_INT16 0
+#endif
+
+#ifndef VG_CONFIG_POSITION_INT16_FRAC_BITS
+#	define VG_CONFIG_POSITION_INT16_FRAC_BITS 3
+#endif
+
 // If set to 1, submitCommandList() calls pustState()/popState() and resetClip() before and after
 // executing the commands. Otherwise, the state produced by the command list will affect the global
 // state after the execution of the commands.
@@ -32,6 +62,42 @@
 #	define VG_CONFIG_COMMAND_LIST_PRESERVE_STATE 0
 #endif
 
+// If set to 1, end() moves draw commands back over non-overlapping ones (tested with their
+// bounding rects) in order to merge commands sharing the same program, texture, scissor and clip
+// state into a single draw call. Painter's order is preserved for overlapping commands.
+#ifndef VG_CONFIG_ENABLE_DRAW_COMMAND_MERGING
+#	define VG_CONFIG_ENABLE_DRAW_COMMAND_MERGING 0
+#endif
+
+// If set to 1, end() hashes the contents of each per-frame vertex and index buffer and skips
+// bgfx::update() for buffers identical to what was uploaded to the same GPU buffer last time.
+// Commands are still recorded and submitted every frame; only the uploads are skipped. Useful for
+// mostly static UIs, at the cost of hashing all the vertex data on the CPU.
+#ifndef VG_CONFIG_ENABLE_FRAME_DIFF
+#	define VG_CONFIG_ENABLE_FRAME_DIFF 0
+#endif
+
+// If set to 1, glyphs are baked once as signed distance fields at a reference size and text is drawn
+// with the fs_text_sdf program, which turns the distance field into coverage at any font size and
+// widens the edge for blur. Zooming or animating text then reuses a single atlas entry per glyph
+// instead of baking a bitmap for every size/blur combination. Blur wider than the spread of the
+// distance field (see FS_CONFIG_SDF_PAD in font_system.cpp) falls back to bitmap glyphs baked at the
+// exact size. 0 always bakes bitmaps.
+#ifndef VG_CONFIG_ENABLE_SDF_TEXT
+#	define VG_CONFIG_ENABLE_SDF_TEXT 0
+#endif
+
+// If set to 1, AA solid color strokes and fills are drawn with a coverage fragment shader. Every vertex
+// holds its distances from the edges of the outline (in fringe widths) as UVs, and the shader turns the
+// interpolated distances into the coverage of each pixel. Strokes need half the vertices because they
+// have no fringe geometry; fills keep their fringes but use the same program so they are batched
+// together with strokes. Gradient/image pattern paths, clip paths and cached/prepared/instanced paths
+// still use vertex color fringes. Requires VG_CONFIG_UV_INT16 = 0 because the UVs extend far outside
+// the [0, 1] range.
+#ifndef VG_CONFIG_ENABLE_ANALYTIC_AA
+#	define VG_CONFIG_ENABLE_ANALYTIC_AA 0
+#endif
+
 #define VG_EPSILON 1e-5f
 
 #define VG_COLOR_RED_Pos     0
@@ -80,6 +146,8 @@
 #define VG_FILL_FLAGS_FILL_RULE_Msk (0x01u << VG_FILL_FLAGS_FILL_RULE_Pos)
 #define VG_FILL_FLAGS_AA_Pos        2
 #define VG_FILL_FLAGS_AA_Msk        (0x01u << VG_FILL_FLAGS_AA_Pos)
+#define VG_FILL_FLAGS_STENCIL_COVER_Pos 3
+#define VG_FILL_FLAGS_STENCIL_COVER_Msk (0x01u << VG_FILL_FLAGS_STENCIL_COVER_Pos)
 #define VG_FILL_FLAGS(type, rule, aa) (0 \
 	| (((uint32_t)(type) << VG_FILL_FLAGS_PATH_TYPE_Pos) & VG_FILL_FLAGS_PATH_TYPE_Msk) \
 	| (((uint32_t)(rule) << VG_FILL_FLAGS_FILL_RULE_Pos) & VG_FILL_FLAGS_FILL_RULE_Msk) \
@@ -394,4 +394,14 @@ inline void clSubmitCommandList(CommandListRef& ref, CommandListHandle child)
 {
 	clSubmitCommandList(ref.m_Context, ref.m_Handle, child);
 }
+
+inline void clBeginLayer(CommandListRef& ref, LayerHandle layer, uint16_t viewID)
+{
+	clBeginLayer(ref.m_Context, ref.m_Handle, layer, viewID);
+}
+
+inline void clEndLayer(CommandListRef& ref)
+{
+	clEndLayer(ref.m_Context, ref.m_Handle);
+}
 }
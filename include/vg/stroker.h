@@ -58,6 +58,23 @@ void strokerPolylineStrokeAA(Stroker* stroker, Mesh* mesh, const float* vertexLi
 */
 void strokerPolylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const float* vertexList, uint32_t numVertices, bool isClosed, Color color, LineCap::Enum lineCap, LineJoin::Enum lineJoin);
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+/* Geometry
+* #----------------------------------#
+* |                                  |
+* a                                  b
+* |                                  |
+* #----------------------------------#
+*
+* Generates positions, UVs and indices. All vertices have the same color.
+* The outline (#) is half a fringe outside the stroke. The UVs (uvBuffer, 2 floats per vertex) hold
+* the distances of the vertex from the 2 long edges of the outline (in fringe widths). Caps use the
+* distance from the cap edge instead of one of them. The product of the interpolated distances,
+* each clamped to [0, 1], is the coverage of the stroke (use strokeWidth = fringe width for thin strokes).
+*/
+void strokerPolylineStrokeAnalyticAA(Stroker* stroker, Mesh* mesh, const float** uvBuffer, const float* vertexList, uint32_t numVertices, bool isClosed, float strokeWidth, LineCap::Enum lineCap, LineJoin::Enum lineJoin);
+#endif
+
 /*
 * Generates only indices (a triangle fan).
 * Positions are the initial polygon vertices (the same pointer is returned in the mesh).
@@ -70,6 +87,14 @@ void strokerConvexFill(Stroker* stroker, Mesh* mesh, const float* vertexList, ui
 */
 void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList, uint32_t numVertices, uint32_t color);
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+/*
+* Same geometry as strokerConvexFillAA() but generates positions, UVs and indices. The UVs hold the
+* distances from the outline in the same format as strokerPolylineStrokeAnalyticAA().
+*/
+void strokerConvexFillAnalyticAA(Stroker* stroker, Mesh* mesh, const float** uvBuffer, const float* vertexList, uint32_t numVertices);
+#endif
+
 bool strokerConcaveFillBegin(Stroker* stroker);
 void strokerConcaveFillAddContour(Stroker* stroker, const float* vertexList, uint32_t numVertices);
 
@@ -83,6 +108,14 @@ bool strokerConcaveFillEnd(Stroker* stroker, Mesh* mesh, FillRule::Enum fillRule
 * Generates positions, colors and indices
 */
 bool strokerConcaveFillEndAA(Stroker* stroker, Mesh* mesh, uint32_t color, FillRule::Enum fillRule);
+
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+/*
+* Same geometry as strokerConcaveFillEndAA() but generates positions, UVs and indices. The UVs hold
+* the distances from the outline in the same format as strokerPolylineStrokeAnalyticAA().
+*/
+bool strokerConcaveFillEndAnalyticAA(Stroker* stroker, Mesh* mesh, const float** uvBuffer, FillRule::Enum fillRule);
+#endif
 }
 
 #endif
@@ -191,6 +191,8 @@ struct FillFlags
 		ConcaveEvenOdd   = VG_FILL_FLAGS(PathType::Concave, FillRule::EvenOdd, 0),
 		ConcaveNonZeroAA = VG_FILL_FLAGS(PathType::Concave, FillRule::NonZero, 1),
 		ConcaveEvenOddAA = VG_FILL_FLAGS(PathType::Concave, FillRule::EvenOdd, 1),
+
+		StencilCover = VG_FILL_FLAGS_STENCIL_COVER_Msk // NOTE: Concave paths are filled on the GPU using the stencil buffer (see fillPath())
 	};
 };
 
@@ -255,17 +257,25 @@ typedef int16_t uv_t;
 typedef float uv_t;
 #endif
 
+#if VG_CONFIG_INDEX_UINT32
+typedef uint32_t index_t;
+#else
+typedef uint16_t index_t;
+#endif
+
 VG_HANDLE32(GradientHandle);
 VG_HANDLE32(ImagePatternHandle);
 VG_HANDLE(ImageHandle);
 VG_HANDLE(FontHandle);
 VG_HANDLE(CommandListHandle);
+VG_HANDLE(LayerHandle);
 
 inline bool isValid(GradientHandle _handle)           { return UINT16_MAX != _handle.idx; };
 inline bool isValid(ImagePatternHandle _handle)       { return UINT16_MAX != _handle.idx; };
 inline bool isValid(ImageHandle _handle)              { return UINT16_MAX != _handle.idx; };
 inline bool isValid(FontHandle _handle)               { return UINT16_MAX != _handle.idx; };
 inline bool isValid(CommandListHandle _handle)        { return UINT16_MAX != _handle.idx; };
+inline bool isValid(LayerHandle _handle)              { return UINT16_MAX != _handle.idx; };
 
 struct ContextConfig
 {
@@ -275,9 +285,15 @@ struct ContextConfig
 	uint16_t m_MaxStateStackSize;   // default: 32
 	uint16_t m_MaxImages;           // default: 16
 	uint16_t m_MaxCommandLists;     // default: 256
-	uint32_t m_MaxVBVertices;       // default: 65536
+	uint32_t m_MaxVBVertices;       // default: 65536 (max 65536 unless VG_CONFIG_INDEX_UINT32 is set)
 	uint32_t m_FontAtlasImageFlags; // default: ImageFlags::Filter_Bilinear
 	uint32_t m_MaxCommandListDepth; // default: 16
+	uint32_t m_NumRecordingShards;  // default: 1 (one per thread recording command lists concurrently)
+	uint32_t m_MaxCachedLODs;       // default: 4 (per Cacheable command list; the least recently used LOD is evicted)
+	float m_CacheScaleTolerance;    // default: 0.1f (reuse a cached LOD if the current scale is within a factor of 1 + tolerance; 0 caches one LOD per exact scale)
+	uint32_t m_MaxCacheMemory;      // default: 64 MB (cached meshes of all command lists; the least recently used LODs are evicted by end(); 0 = unlimited)
+	uint32_t m_MaxLayers;           // default: 8
+	uint32_t m_GlyphRasterization;  // default: GlyphRasterization::Immediate
 };
 
 struct Stats
@@ -300,7 +316,7 @@ struct Mesh
 {
 	const float* m_PosBuffer;
 	const uint32_t* m_ColorBuffer;
-	const uint16_t* m_IndexBuffer;
+	const index_t* m_IndexBuffer;
 	uint32_t m_NumVertices;
 	uint32_t m_NumIndices;
 };
@@ -330,6 +346,8 @@ struct CommandListFlags
 		None                = 0,
 		Cacheable           = 1 << 0, // Cache the generated geometry in order to avoid retesselation every frame; uses extra memory
 		AllowCommandCulling = 1 << 1, // If the scissor rect ends up being zero-sized, don't execute fill/stroke commands.
+		Retained            = 1 << 2, // Keep the cached geometry in static GPU buffers and only change the transform on resubmission; requires Cacheable
+		GPUTransform        = 1 << 3, // Draw cached solid color meshes using a model matrix instead of transforming their vertices on the CPU; requires Cacheable
 	};
 };
 
@@ -342,6 +360,16 @@ struct FontFlags
 	};
 };
 
+struct GlyphRasterization
+{
+	enum Enum : uint32_t
+	{
+		Immediate            = 0, // text() rasterizes missing glyphs
+		Deferred_Block       = 1, // Missing glyphs are queued for rasterizeGlyphs(); end() rasterizes the ones left in the queue
+		Deferred_Placeholder = 2, // Same as Deferred_Block but glyphs still in the queue at end() are drawn empty until they are rasterized
+	};
+};
+
 struct Context;
 
 // Context
@@ -353,6 +381,20 @@ void end(Context* ctx);
 void frame(Context* ctx);
 const Stats* getStats(Context* ctx);
 
+// Dirty rect tracking (partial redraw). When enabled, end() renders only the draw commands
+// intersecting the union of the rects marked dirty since the previous end(), scissored to it.
+// The rest of the view's framebuffer is expected to still hold the previous frame, i.e. the view
+// should render into a persistent framebuffer which isn't cleared (or is cleared only inside
+// getDirtyRect()), and is then composited to the screen. Submitted command lists mark the area
+// they cover as dirty whenever they are modified, moved, scissored differently, stop being
+// submitted or are destroyed. Everything else (immediate mode drawing, lists drawn into layers
+// whose images are drawn on the canvas) should be marked with addDirtyRect().
+// The first frame after enabling tracking, or after the canvas size changes, is fully rendered.
+// Rects are in canvas coordinates; getDirtyRect() returns false if the last end() rendered nothing.
+void setDirtyRectTracking(Context* ctx, bool enable);
+void addDirtyRect(Context* ctx, float x, float y, float w, float h);
+bool getDirtyRect(Context* ctx, float* rect);
+
 void beginPath(Context* ctx);
 void moveTo(Context* ctx, float x, float y);
 void lineTo(Context* ctx, float x, float y);
@@ -367,6 +409,11 @@ void circle(Context* ctx, float cx, float cy, float radius);
 void ellipse(Context* ctx, float cx, float cy, float rx, float ry);
 void polyline(Context* ctx, const float* coords, uint32_t numPoints);
 void closePath(Context* ctx);
+// FillFlags::StencilCover (concave paths only): Instead of being triangulated on the CPU, the winding
+// numbers of the path's contours are accumulated in the stencil buffer using triangle fans, and the
+// path's bounding rect is then drawn where they are non-zero (or odd). Requires a stencil buffer, and
+// the fill isn't anti-aliased (use MSAA). The flag is ignored inside beginClip()/endClip(), while a clip
+// is active, and for Cacheable or prepared command lists.
 void fillPath(Context* ctx, Color color, uint32_t flags);
 void fillPath(Context* ctx, GradientHandle gradient, uint32_t flags);
 void fillPath(Context* ctx, ImagePatternHandle img, Color color, uint32_t flags);
@@ -409,6 +456,12 @@ float getTextLineHeight(Context* ctx, const TextConfig& cfg);
 int textBreakLines(Context* ctx, const TextConfig& cfg, const char* str, const char* end, float breakRowWidth, TextRow* rows, int maxRows, uint32_t flags);
 int textGlyphPositions(Context* ctx, const TextConfig& cfg, float x, float y, const char* text, const char* end, GlyphPosition* positions, int maxPositions);
 
+// Rasterizes up to maxGlyphs of the glyphs queued by text() when ContextConfig::m_GlyphRasterization
+// is one of the Deferred modes. Their atlas rects are reserved by text() and the bitmaps are copied to
+// the atlas by end(). Can be called from any number of threads after begin(), but all calls should
+// return before end(). Returns the number of glyphs rasterized by this call.
+uint32_t rasterizeGlyphs(Context* ctx, uint32_t maxGlyphs);
+
 /*
  * pos: A list of 2D vertices (successive x,y pairs)
  * uv (optional): 1 UV pair for each position. If not specified (nullptr), the white-rect UV from the font atlas is used.
@@ -419,7 +472,21 @@ int textGlyphPositions(Context* ctx, const TextConfig& cfg, float x, float y, co
  * numIndices: The number of indices
  * img (optional): The image to use for this draw call (created via createImage()) or VG_INVALID_HANDLE in case you don't have an image (colored tri-list).
  */
-void indexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, ImageHandle img);
+void indexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img);
+
+/*
+ * Instanced versions of fillPath(), strokePath() and indexedTriList(). The geometry is generated
+ * and copied to the vertex buffer once and all numInstances instances are drawn with a single instanced
+ * draw call (a draw call per instance if the renderer doesn't support instancing).
+ * instanceMtx: numInstances 2x3 matrices (6 floats each). Each one is applied before the current transform.
+ * instanceColors (optional): numInstances colors. If specified, instance i is drawn using instanceColors[i]
+ *   instead of color (AA coverage is preserved).
+ * NOTE: AA fringes are generated for the current transform, so instance matrices shouldn't scale.
+ * Cannot be used inside beginClip()/endClip().
+ */
+void fillPathInstanced(Context* ctx, Color color, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
+void strokePathInstanced(Context* ctx, Color color, float width, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
+void indexedTriListInstanced(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
 
 bool getImageSize(Context* ctx, ImageHandle handle, uint16_t* w, uint16_t* h);
 ImageHandle createImage(Context* ctx, uint16_t w, uint16_t h, uint32_t flags, const uint8_t* data);
@@ -428,12 +495,43 @@ bool updateImage(Context* ctx, ImageHandle image, uint16_t x, uint16_t y, uint16
 bool destroyImage(Context* ctx, ImageHandle img);
 bool isImageValid(Context* ctx, ImageHandle img);
 
+// Layers are offscreen render targets (width x height pixels) which are rendered once and then
+// reused until invalidateLayer() is called. Everything drawn between beginLayer() and endLayer()
+// goes to the layer, using its own bgfx view (viewID should be ordered before the view passed to
+// begin()). If the layer is still valid, beginLayer() returns false and the commands up to the
+// matching endLayer() are discarded. Layers are composited with the image returned by getLayerImage()
+// (e.g. via createImagePattern()); the image holds pre-multiplied alpha and is blended accordingly.
+// beginLayer()/endLayer() should be called between begin() and end() and can be nested.
+LayerHandle createLayer(Context* ctx, uint16_t width, uint16_t height, uint32_t imageFlags);
+void destroyLayer(Context* ctx, LayerHandle handle);
+void invalidateLayer(Context* ctx, LayerHandle handle);
+ImageHandle getLayerImage(Context* ctx, LayerHandle handle);
+bool beginLayer(Context* ctx, LayerHandle handle, uint16_t viewID);
+void endLayer(Context* ctx);
+
 // Command lists
+// NOTE: cl*() functions only touch the specified command list and its recording shard so
+// different command lists can be recorded from different threads, as long as each thread
+// uses its own shard. create/destroy/submit should be called from the thread calling begin()/end().
 CommandListHandle createCommandList(Context* ctx, uint32_t flags);
+CommandListHandle createCommandList(Context* ctx, uint32_t flags, uint16_t shardID);
+bool setRecordingShardAllocator(Context* ctx, uint16_t shardID, bx::AllocatorI* allocator);
 void destroyCommandList(Context* ctx, CommandListHandle handle);
 void resetCommandList(Context* ctx, CommandListHandle handle);
+
+// Command lists keep conservative bounds of everything recorded in them (including child lists).
+// Submitted lists which end up completely outside the scissor rect are skipped. Lists with text,
+// transformIdentity(), setViewBox() or pre-multiplied transforms are never skipped. clSubmitCommandList()
+// reads the bounds of the child so it shouldn't be recorded from another thread at the same time.
 void submitCommandList(Context* ctx, CommandListHandle handle);
 
+// Tessellates all paths of the command list (and its children) using the shard's path/stroker.
+// Can be called from any thread after begin(), one thread per shard, as long as the list and its
+// children aren't modified at the same time. The next top-level submitCommandList() of the list
+// copies the generated meshes instead of tessellating the paths, provided it's submitted with an
+// identity transform and a global alpha of 1. Cacheable command lists cannot be prepared.
+bool prepareCommandList(Context* ctx, CommandListHandle handle, uint16_t shardID);
+
 void clBeginPath(Context* ctx, CommandListHandle handle);
 void clMoveTo(Context* ctx, CommandListHandle handle, float x, float y);
 void clLineTo(Context* ctx, CommandListHandle handle, float x, float y);
@@ -448,7 +546,7 @@ void clCircle(Context* ctx, CommandListHandle handle, float cx, float cy, float
 void clEllipse(Context* ctx, CommandListHandle handle, float cx, float cy, float rx, float ry);
 void clPolyline(Context* ctx, CommandListHandle handle, const float* coords, uint32_t numPoints);
 void clClosePath(Context* ctx, CommandListHandle handle);
-void clIndexedTriList(Context* ctx, CommandListHandle handle, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, ImageHandle img);
+void clIndexedTriList(Context* ctx, CommandListHandle handle, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img);
 void clFillPath(Context* ctx, CommandListHandle handle, Color color, uint32_t flags);
 void clFillPath(Context* ctx, CommandListHandle handle, GradientHandle gradient, uint32_t flags);
 void clFillPath(Context* ctx, CommandListHandle handle, ImagePatternHandle img, Color color, uint32_t flags);
@@ -481,6 +579,23 @@ void clTextBox(Context* ctx, CommandListHandle handle, const TextConfig& cfg, fl
 
 void clSubmitCommandList(Context* ctx, CommandListHandle parent, CommandListHandle child);
 
+// Command lists with layers are never Cacheable and cannot be prepared.
+void clBeginLayer(Context* ctx, CommandListHandle handle, LayerHandle layer, uint16_t viewID);
+void clEndLayer(Context* ctx, CommandListHandle handle);
+
+// Partial updates of recorded command lists. Fill/stroke commands are identified by the value
+// clGetNextCommandID() returned right before recording them. Only the modified commands are
+// tessellated again on the next submission of a Cacheable list; all other cached meshes are kept.
+// clSetCommandColor() never re-tessellates a cached command since cached meshes store only their
+// AA coverage.
+// clReplaceCommandPath() replaces all path commands of the path drawn by the command (from its
+// beginPath() up to the next one) with the path commands of pathList; every fill/stroke command
+// drawing that path is updated. Call these from the thread calling begin()/end().
+uint32_t clGetNextCommandID(Context* ctx, CommandListHandle handle);
+void clSetCommandColor(Context* ctx, CommandListHandle handle, uint32_t cmdID, Color color);
+void clSetCommandVisible(Context* ctx, CommandListHandle handle, uint32_t cmdID, bool visible);
+void clReplaceCommandPath(Context* ctx, CommandListHandle handle, uint32_t cmdID, CommandListHandle pathList);
+
 //////////////////////////////////////////////////////////////////////////
 // Helpers
 //
@@ -543,6 +658,8 @@ void clTransformMult(CommandListRef& ref, const float* mtx, TransformOrder::Enum
 void clText(CommandListRef& ref, const TextConfig& cfg, float x, float y, const char* str, const char* end);
 void clTextBox(CommandListRef& ref, const TextConfig& cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textboxFlags);
 void clSubmitCommandList(CommandListRef& ref, CommandListHandle child);
+void clBeginLayer(CommandListRef& ref, LayerHandle layer, uint16_t viewID);
+void clEndLayer(CommandListRef& ref);
 }
 
 #include "inline/vg.inl"
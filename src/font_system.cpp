@@ -5,14 +5,19 @@
 #include "font_system.h"
 #include "vg_util.h"
 #include <bx/allocator.h>
+#include <bx/cpu.h>
 #include <bx/string.h>
 
 #define FS_CONFIG_LUT_SIZE           256
 #define FS_CONFIG_MAX_FALLBACK_FONTS 8
-#define FS_CONFIG_MAX_FONT_IMAGES    4
+#define FS_CONFIG_MAX_FONT_IMAGES    8 // Max number of atlas images used in a single frame
+#define FS_CONFIG_NUM_ATLAS_PAGES    4 // Glyphs are evicted from the atlas one page (horizontal band) at a time
 #define FS_CONFIG_SNAP_TO_GRID       0
 #define FS_CONFIG_FONT_SIZE_EM       0
 #define FS_CONFIG_TAB_SIZE           4.0f // * Space size
+#define FS_CONFIG_MAX_GLYPH_JOBS     256 // Max number of glyphs queued for rasterizeGlyphs(). Glyphs are rasterized immediately when the queue is full.
+#define FS_CONFIG_SDF_SIZE           32 // Font size (px) of distance field glyphs (VG_CONFIG_ENABLE_SDF_TEXT)
+#define FS_CONFIG_SDF_PAD            6  // Spread of distance field glyphs (px at FS_CONFIG_SDF_SIZE)
 
 #if FS_CONFIG_SNAP_TO_GRID
 #define FS_SNAP_COORD(coord) (float)((int32_t)((coord) + 0.5f))
@@ -22,6 +27,11 @@
 
 #define FS_MAKE_GLYPH_CODE(cp, size, blur) (((uint64_t)(cp)) | ((uint64_t)(size) << 32) | ((uint64_t)(blur) << 48))
 
+// Distance field glyphs are baked with this blur value; it never matches the blur of a bitmap glyph.
+#define FS_SDF_GLYPH_BLUR    -1
+#define FS_SDF_ON_EDGE_VALUE 128
+#define FS_SDF_DIST_SCALE    (128.0f / (float)FS_CONFIG_SDF_PAD) // Change of the distance field value per pixel
+
 namespace vg
 {
 struct AtlasNode
@@ -32,14 +42,23 @@ struct AtlasNode
 	uint16_t _Reserved[1];
 };
 
-struct Atlas
+struct AtlasPage
 {
-	bx::AllocatorI* m_Allocator;
 	AtlasNode* m_Nodes;
 	uint32_t m_NumNodes;
 	uint32_t m_NodeCapacity;
+	uint32_t m_LastUsedFrame; // Latest FontSystem::m_FrameID a glyph of this page was drawn
+	uint16_t m_MinY;
+	uint16_t m_MaxY;
+};
+
+struct Atlas
+{
+	bx::AllocatorI* m_Allocator;
+	AtlasPage m_Pages[FS_CONFIG_NUM_ATLAS_PAGES];
 	uint16_t m_Width;
 	uint16_t m_Height;
+	uint16_t m_PageHeight;
 };
 
 struct Glyph
@@ -81,6 +100,23 @@ struct TextBuffer
 	int32_t* m_GlyphIndices;
 	int32_t* m_KernAdv;
 	FontHandle* m_GlyphFonts;
+	ImageHandle* m_QuadImages;
+};
+
+// A glyph whose atlas rect has been reserved by fsBakeGlyph() but which hasn't been rasterized yet.
+struct GlyphJob
+{
+	void* m_FontBackendData;
+	uint8_t* m_Bitmap;         // m_RectSize[0] x m_RectSize[1], copied to the atlas by the main thread. nullptr once the job has been retired.
+	uint32_t m_AtlasID;        // FontSystem::m_AtlasID at the time the rect was reserved
+	volatile uint32_t m_Done;  // Set by the thread which claimed the job after m_Bitmap has been written (fsAtomicStore())
+	int32_t m_GlyphIndex;
+	float m_Scale;
+	uint16_t m_RectPos[2];
+	uint16_t m_RectSize[2];
+	int16_t m_Pad;
+	int16_t m_Blur;
+	volatile uint32_t m_Cancelled; // The rect has been evicted from the atlas (fsAtomicStore())
 };
 
 struct FontSystem
@@ -97,7 +133,11 @@ struct FontSystem
 	uint32_t m_NumFonts;
 	uint32_t m_FontCapacity;
 	uint32_t m_AtlasID;
+	uint32_t m_FrameID;
 	uint16_t m_DirtyRect[4]; // { minx, miny, maxx, maxy }
+	GlyphJob* m_GlyphJobs;
+	volatile uint32_t m_NumGlyphJobs;  // Only written by the main thread (fsAtomicStore())
+	volatile uint32_t m_NextGlyphJob;  // First job not yet claimed by fsClaimGlyphJob()
 };
 
 static bool fsAddWhiteRect(FontSystem* fs, uint16_t rectWidth, uint16_t rectHeight);
@@ -106,14 +146,17 @@ static FontHandle fsAllocFont(FontSystem* fs);
 static bool fsResetAtlas(FontSystem* fs, uint16_t width, uint16_t height);
 static Atlas* fsCreateAtlas(bx::AllocatorI* allocator, uint16_t w, uint16_t h);
 static void fsDestroyAtlas(Atlas* atlas);
-static uint32_t fsAtlasAllocNode(Atlas* atlas);
-static void fsAtlasSetNode(Atlas* atlas, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w);
-static bool fsAtlasInsertNode(Atlas* atlas, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w);
-static void fsAtlasRemoveNode(Atlas* atlas, uint32_t nodeID);
+static uint32_t fsAtlasAllocNode(Atlas* atlas, AtlasPage* page);
+static void fsAtlasSetNode(AtlasPage* page, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w);
+static bool fsAtlasInsertNode(Atlas* atlas, AtlasPage* page, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w);
+static void fsAtlasRemoveNode(AtlasPage* page, uint32_t nodeID);
 static bool fsAtlasAddRect(Atlas* atlas, uint16_t rectWidth, uint16_t rectHeight, uint16_t* rectX, uint16_t* rectY);
-static uint32_t fsAtlasRectFits(Atlas* atlas, uint32_t nodeID, uint16_t rectWidth, uint16_t rectHeight);
-static bool fsAtlasAddSkylineLevel(Atlas* atlas, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static uint32_t fsAtlasRectFits(Atlas* atlas, AtlasPage* page, uint32_t nodeID, uint16_t rectWidth, uint16_t rectHeight);
+static bool fsAtlasAddSkylineLevel(Atlas* atlas, AtlasPage* page, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 static void fsAtlasReset(Atlas* atlas, uint16_t w, uint16_t h);
+static void fsAtlasResetPage(Atlas* atlas, uint32_t pageID);
+static uint32_t fsAtlasGetPageID(const Atlas* atlas, uint16_t y);
+static bool fsEvictAtlasPage(FontSystem* fs);
 static uint32_t decodeUTF8(uint32_t* state, uint32_t* codep, uint8_t byte);
 static void fsUpdateWhitePixelUV(FontSystem* fs, vg::Context* ctx);
 static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx, const vg::TextConfig& cfg, uint32_t flags, TextMesh* mesh);
@@ -122,9 +165,16 @@ static void fsTextBufferShutdown(TextBuffer* tb, bx::AllocatorI* allocator);
 static bool fsTextBufferReset(TextBuffer* tb, uint32_t capacity, bx::AllocatorI* allocator);
 static bool fsTextBufferPushCodepoint(TextBuffer* tb, uint32_t codepoint, uint8_t codepointSize, bx::AllocatorI* allocator);
 static float fsGetVertAlign(FontSystem* fs, const Font* font, uint32_t align, int16_t isize);
+static void fsGetAtlasUVScale(const FontSystem* fs, float* x_to_u, float* y_to_v);
 static Glyph* fsBakeGlyph(FontSystem* fs, Font* font, int32_t glyphIndex, uint32_t codepoint, int16_t isize, int16_t iblur, bool glyphBitmapOptional);
 static Glyph* fsAllocGlyph(FontSystem* fs, Font* font);
 static bool fsAllocTextAtlas(FontSystem* fs, Context* ctx);
+static void fsRenderGlyph(void* fontBackendData, int32_t glyphIndex, float scale, uint8_t* dst, uint32_t dstStride, uint16_t gw, uint16_t gh, int32_t pad, int16_t iblur);
+static bool fsPushGlyphJob(FontSystem* fs, const Font* font, int32_t glyphIndex, float scale, const Glyph* glyph, int32_t pad, int16_t iblur);
+static uint32_t fsClaimGlyphJob(FontSystem* fs);
+static uint32_t fsAtomicLoad(volatile uint32_t* ptr);
+static void fsAtomicStore(volatile uint32_t* ptr, uint32_t value);
+static void fsFinishGlyphJobs(FontSystem* fs, bool keepUnclaimed);
 
 static bool fsBackendInit(FontSystem* fs);
 static void* fsBackendLoadFont(FontSystem* fs, uint8_t* data, uint32_t dataSize);
@@ -134,6 +184,9 @@ static float fsBackendGetPixelHeightScale(void* fontPtr, float size);
 static int32_t fsBackendGetGlyphIndex(void* fontPtr, uint32_t codepoint);
 static bool fsBackendBuildGlyphBitmap(void* fontPtr, int32_t glyph, float size, float scale, int32_t* advance, int32_t* lsb, int32_t* x0, int32_t* y0, int32_t* x1, int32_t* y1);
 static void fsBackendRenderGlyphBitmap(void* fontPtr, uint8_t* output, int32_t outWidth, int32_t outHeight, int32_t outStride, float scaleX, float scaleY, int glyph);
+#if VG_CONFIG_ENABLE_SDF_TEXT
+static void fsBackendRenderGlyphSDF(void* fontPtr, uint8_t* output, int32_t outWidth, int32_t outHeight, int32_t outStride, float scale, int32_t pad, int glyph);
+#endif
 static int32_t fsBackendGetGlyphKernAdvance(void* fontPtr, int32_t glyph1, int32_t glyph2);
 
 FontSystem* fsCreate(vg::Context* ctx, bx::AllocatorI* allocator, const FontSystemConfig* cfg)
@@ -156,6 +209,7 @@ FontSystem* fsCreate(vg::Context* ctx, bx::AllocatorI* allocator, const FontSyst
 	}
 
 	fs->m_AtlasID = 1;
+	fs->m_FrameID = 1;
 
 	// Initialize image data
 	fs->m_ImageData = (uint8_t*)bx::alloc(allocator, (size_t)cfg->m_AtlasWidth * (size_t)cfg->m_AtlasHeight);
@@ -188,6 +242,14 @@ FontSystem* fsCreate(vg::Context* ctx, bx::AllocatorI* allocator, const FontSyst
 	fsUpdateWhitePixelUV(fs, ctx);
 	fsTextBufferInit(&fs->m_TextBuffer);
 
+	if (cfg->m_GlyphRasterization != GlyphRasterization::Immediate) {
+		fs->m_GlyphJobs = (GlyphJob*)bx::alloc(allocator, sizeof(GlyphJob) * FS_CONFIG_MAX_GLYPH_JOBS);
+		if (!fs->m_GlyphJobs) {
+			fsDestroy(fs, ctx);
+			return nullptr;
+		}
+	}
+
 	return fs;
 }
 
@@ -197,6 +259,12 @@ void fsDestroy(FontSystem* fs, vg::Context* ctx)
 
 	fsTextBufferShutdown(&fs->m_TextBuffer, allocator);
 
+	const uint32_t numGlyphJobs = fs->m_NumGlyphJobs;
+	for (uint32_t i = 0; i < numGlyphJobs; ++i) {
+		bx::free(allocator, fs->m_GlyphJobs[i].m_Bitmap);
+	}
+	bx::free(allocator, fs->m_GlyphJobs);
+
 	for (uint32_t i = 0; i < FS_CONFIG_MAX_FONT_IMAGES; ++i) {
 		destroyImage(ctx, fs->m_FontImages[i]);
 	}
@@ -223,6 +291,8 @@ void fsDestroy(FontSystem* fs, vg::Context* ctx)
 
 void fsFrame(FontSystem* fs, vg::Context* ctx)
 {
+	++fs->m_FrameID;
+
 	if (fs->m_FontImageID != 0) {
 		vg::ImageHandle fontImage = fs->m_FontImages[fs->m_FontImageID];
 
@@ -394,6 +464,51 @@ void fsFlushFontAtlasImage(FontSystem* fs, vg::Context* ctx)
 	bx::free(fs->m_Allocator, rgbaData);
 }
 
+// NOTE: Can be called from any thread.
+uint32_t fsRasterizeGlyphs(FontSystem* fs, uint32_t maxGlyphs)
+{
+	uint32_t numRasterized = 0;
+	while (numRasterized < maxGlyphs) {
+		const uint32_t jobID = fsClaimGlyphJob(fs);
+		if (jobID == UINT32_MAX) {
+			break;
+		}
+
+		GlyphJob* job = &fs->m_GlyphJobs[jobID];
+		if (!fsAtomicLoad(&job->m_Cancelled)) {
+			fsRenderGlyph(job->m_FontBackendData, job->m_GlyphIndex, job->m_Scale, job->m_Bitmap, job->m_RectSize[0], job->m_RectSize[0], job->m_RectSize[1], job->m_Pad, job->m_Blur);
+			++numRasterized;
+		}
+
+		// Makes the bitmap visible to the main thread before it sees the job as done.
+		fsAtomicStore(&job->m_Done, 1);
+	}
+
+	return numRasterized;
+}
+
+// NOTE: Should only be called from the thread calling begin()/end(), after all rasterizeGlyphs() calls have returned.
+void fsResolveGlyphJobs(FontSystem* fs)
+{
+	if (!fs->m_GlyphJobs) {
+		return;
+	}
+
+	fsFinishGlyphJobs(fs, fs->m_Config.m_GlyphRasterization == GlyphRasterization::Deferred_Placeholder);
+
+	// Move the jobs left in the queue to the front so they can be picked up in the next frame.
+	uint32_t numPending = 0;
+	const uint32_t numGlyphJobs = fs->m_NumGlyphJobs;
+	for (uint32_t i = 0; i < numGlyphJobs; ++i) {
+		if (fs->m_GlyphJobs[i].m_Bitmap) {
+			fs->m_GlyphJobs[numPending++] = fs->m_GlyphJobs[i];
+		}
+	}
+
+	fsAtomicStore(&fs->m_NumGlyphJobs, numPending);
+	fsAtomicStore(&fs->m_NextGlyphJob, 0);
+}
+
 uint32_t fsText(FontSystem* fs, vg::Context* ctx, const vg::TextConfig& cfg, const char* str, uint32_t len, uint32_t flags, TextMesh* mesh)
 {
 	VG_CHECK(vg::isValid(cfg.m_FontHandle), "Invalid font handle");
@@ -508,14 +623,22 @@ static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx
 		const float y_mult = originTopLeft ? 1.0f : -1.0f;
 		const uint32_t bboxMinYID = originTopLeft ? 1 : 3;
 		const uint32_t bboxMaxYID = originTopLeft ? 3 : 1;
-		const int16_t iblur = (int16_t)bx::clamp<float>(cfg.m_Blur, 0.0f, 20.0f);
-#if VG_CONFIG_UV_INT16
-		const float x_to_u = (float)INT16_MAX / (float)fs->m_Atlas->m_Width;
-		const float y_to_v = (float)INT16_MAX / (float)fs->m_Atlas->m_Height;
-#else
-		const float x_to_u = 1.0f / (float)fs->m_Atlas->m_Width;
-		const float y_to_v = 1.0f / (float)fs->m_Atlas->m_Height;
+		// Glyphs are baked at bakeSize and their quads are scaled by bakeScale to the requested size.
+		int16_t bakeSize = isize;
+		int16_t iblur = (int16_t)bx::clamp<float>(cfg.m_Blur, 0.0f, 20.0f);
+#if VG_CONFIG_ENABLE_SDF_TEXT
+		// The blurred edge has to fit in the spread of the distance field (minus 1px for AA).
+		const float sdfBlur = cfg.m_Blur * (float)(FS_CONFIG_SDF_SIZE * 10) / (float)isize;
+		if (sdfBlur <= (float)(FS_CONFIG_SDF_PAD - 1)) {
+			bakeSize = FS_CONFIG_SDF_SIZE * 10;
+			iblur = FS_SDF_GLYPH_BLUR;
+			mesh->m_DistanceField = true;
+			mesh->m_DistanceFieldBlur = bx::max<float>(sdfBlur, 0.0f) * FS_SDF_DIST_SCALE / 255.0f;
+		}
 #endif
+		const float bakeScale = (float)isize / (float)bakeSize;
+		float x_to_u, y_to_v;
+		fsGetAtlasUVScale(fs, &x_to_u, &y_to_v);
 		const float scale = fsBackendGetPixelHeightScale(font->m_BackendData, (float)isize / 10.0f);
 		const float spacing = cfg.m_Spacing;
 
@@ -526,16 +649,22 @@ static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx
 			const int32_t glyphIndex = tb->m_GlyphIndices[i];
 			const uint32_t codepoint = tb->m_Codepoints[i];
 
-			Glyph* glyph = fsBakeGlyph(fs, &fs->m_Fonts[glyphFont.idx], glyphIndex, codepoint, isize, iblur, bitmapsOptional);
+			Glyph* glyph = fsBakeGlyph(fs, &fs->m_Fonts[glyphFont.idx], glyphIndex, codepoint, bakeSize, iblur, bitmapsOptional);
 			if (!glyph) {
+				// Continue in a new atlas image. The quads generated so far keep referencing the previous
+				// image, which stays alive until the end of the frame.
 				if (!fsAllocTextAtlas(fs, ctx)) {
 					VG_WARN(false, "Failed to allocate enough text atlas space for string");
 					return 0;
 				}
 
-				// Start from the beginning...
-				i = 0;
-				continue;
+				fsGetAtlasUVScale(fs, &x_to_u, &y_to_v);
+
+				glyph = fsBakeGlyph(fs, &fs->m_Fonts[glyphFont.idx], glyphIndex, codepoint, bakeSize, iblur, bitmapsOptional);
+				if (!glyph) {
+					VG_WARN(false, "Glyph too large for the text atlas");
+					return 0;
+				}
 			}
 
 			const int32_t kernAdv = tb->m_KernAdv[i];
@@ -549,8 +678,8 @@ static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx
 				// Each glyph has 2px border to allow good interpolation,
 				// one pixel to prevent leaking, and one to allow good interpolation for rendering.
 				// Inset the texture region by one pixel for correct interpolation.
-				const float xoff = (float)(glyph->m_XOff + 1);
-				const float yoff = (float)(glyph->m_YOff + 1);
+				const float xoff = (float)(glyph->m_XOff + 1) * bakeScale;
+				const float yoff = (float)(glyph->m_YOff + 1) * bakeScale;
 				const float atlasMinX = (float)((int32_t)glyph->m_RectPos[0] + 1);
 				const float atlasMinY = (float)((int32_t)glyph->m_RectPos[1] + 1);
 				const float atlasMaxX = (float)((int32_t)glyph->m_RectPos[0] + (int32_t)glyph->m_RectSize[0] - 1);
@@ -561,8 +690,8 @@ static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx
 				// Positions
 				q->m_Pos[0] = rx;
 				q->m_Pos[1] = ry;
-				q->m_Pos[2] = rx + (atlasMaxX - atlasMinX) * width_mult;
-				q->m_Pos[3] = ry + (atlasMaxY - atlasMinY) * y_mult;
+				q->m_Pos[2] = rx + (atlasMaxX - atlasMinX) * bakeScale * width_mult;
+				q->m_Pos[3] = ry + (atlasMaxY - atlasMinY) * bakeScale * y_mult;
 
 				if (glyphFont.idx != cfg.m_FontHandle.idx) {
 					const Font* fallbackFont = &fs->m_Fonts[glyphFont.idx];
@@ -576,13 +705,14 @@ static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx
 				q->m_TexCoord[1] = (uv_t)(atlasMinY * y_to_v);
 				q->m_TexCoord[2] = (uv_t)(atlasMaxX * x_to_u);
 				q->m_TexCoord[3] = (uv_t)(atlasMaxY * y_to_v);
+				tb->m_QuadImages[i] = fs->m_FontImages[fs->m_FontImageID];
 
 				// Update bounding box
 				miny = bx::min<float>(miny, q->m_Pos[bboxMinYID]);
 				maxy = bx::max<float>(maxy, q->m_Pos[bboxMaxYID]);
 			}
 
-			cursorX += FS_SNAP_COORD(((float)glyph->m_XAdv / 10.0f) * width_mult + spacing);
+			cursorX += FS_SNAP_COORD(((float)glyph->m_XAdv / 10.0f) * bakeScale * width_mult + spacing);
 		}
 
 		// Calculate x bounds here. No need to do it inside the loop.
@@ -616,6 +746,7 @@ static uint32_t fsTextBuildMesh(FontSystem* fs, TextBuffer* tb, vg::Context* ctx
 	mesh->m_Bounds[2] = maxx + cfg.m_Spacing; // Make sure the bounding box includes the specified spacing at the end.
 	mesh->m_Bounds[3] = maxy;
 	mesh->m_Quads = tb->m_Quads;
+	mesh->m_QuadImages = tb->m_QuadImages;
 	mesh->m_Codepoints = tb->m_Codepoints;
 	mesh->m_CodepointSize = tb->m_CodepointSize;
 	mesh->m_Size = numCodepoints;
@@ -918,6 +1049,12 @@ static FontHandle fsAllocFont(FontSystem* fs)
 
 static bool fsAllocTextAtlas(FontSystem* fs, Context* ctx)
 {
+	// Quads already emitted this frame reference the current atlas so all the queued glyphs
+	// should be in it before it's uploaded for the last time.
+	if (fs->m_GlyphJobs) {
+		fsFinishGlyphJobs(fs, false);
+	}
+
 	fsFlushFontAtlasImage(fs, ctx);
 
 	if (fs->m_FontImageID + 1 >= FS_CONFIG_MAX_FONT_IMAGES) {
@@ -957,6 +1094,64 @@ static bool fsAllocTextAtlas(FontSystem* fs, Context* ctx)
 	return true;
 }
 
+// Evicts the least recently used atlas page not drawn in the current frame. Its glyphs keep their
+// metrics and are rasterized again the next time they are drawn.
+static bool fsEvictAtlasPage(FontSystem* fs)
+{
+	Atlas* atlas = fs->m_Atlas;
+
+	uint32_t lruPageID = UINT32_MAX;
+	uint32_t lruFrameID = fs->m_FrameID;
+	for (uint32_t i = 0; i < FS_CONFIG_NUM_ATLAS_PAGES; ++i) {
+		if (atlas->m_Pages[i].m_LastUsedFrame < lruFrameID) {
+			lruFrameID = atlas->m_Pages[i].m_LastUsedFrame;
+			lruPageID = i;
+		}
+	}
+
+	if (lruPageID == UINT32_MAX) {
+		return false;
+	}
+
+	const uint16_t minY = atlas->m_Pages[lruPageID].m_MinY;
+	const uint16_t maxY = atlas->m_Pages[lruPageID].m_MaxY;
+
+	const uint32_t numFonts = fs->m_NumFonts;
+	for (uint32_t i = 0; i < numFonts; ++i) {
+		Font* font = &fs->m_Fonts[i];
+
+		const uint32_t numGlyphs = font->m_NumGlyphs;
+		for (uint32_t j = 0; j < numGlyphs; ++j) {
+			Glyph* glyph = &font->m_Glyphs[j];
+			if (glyph->m_RectPos[1] != UINT16_MAX && glyph->m_RectPos[1] >= minY && glyph->m_RectPos[1] < maxY) {
+				glyph->m_RectPos[0] = UINT16_MAX;
+				glyph->m_RectPos[1] = UINT16_MAX;
+			}
+		}
+	}
+
+	const uint32_t numGlyphJobs = fs->m_NumGlyphJobs;
+	for (uint32_t i = 0; i < numGlyphJobs; ++i) {
+		GlyphJob* job = &fs->m_GlyphJobs[i];
+		if (job->m_RectPos[1] >= minY && job->m_RectPos[1] < maxY) {
+			fsAtomicStore(&job->m_Cancelled, 1);
+		}
+	}
+
+	fsAtlasResetPage(atlas, lruPageID);
+
+	const uint32_t atlasWidth = atlas->m_Width;
+	bx::memSet(&fs->m_ImageData[(uint32_t)minY * atlasWidth], 0, (uint32_t)(maxY - minY) * atlasWidth);
+	fsInvalidateRect(fs, 0, minY, atlas->m_Width, maxY);
+
+	// The white rect is always the first rect of the first page so it ends up at the same position.
+	if (lruPageID == 0) {
+		fsAddWhiteRect(fs, fs->m_Config.m_WhiteRectWidth, fs->m_Config.m_WhiteRectHeight);
+	}
+
+	return true;
+}
+
 static bool fsResetAtlas(FontSystem* fs, uint16_t width, uint16_t height)
 {
 	// Reset atlas
@@ -996,6 +1191,8 @@ static bool fsResetAtlas(FontSystem* fs, uint16_t width, uint16_t height)
 }
 
 // Atlas based on Skyline Bin Packer by Jukka Jylänki
+// The atlas is split into horizontal pages with their own skyline so the glyphs of a single page
+// can be evicted without touching the rest of the atlas.
 static Atlas* fsCreateAtlas(bx::AllocatorI* allocator, uint16_t w, uint16_t h)
 {
 	Atlas* atlas = (Atlas*)bx::alloc(allocator, sizeof(Atlas));
@@ -1005,16 +1202,15 @@ static Atlas* fsCreateAtlas(bx::AllocatorI* allocator, uint16_t w, uint16_t h)
 
 	bx::memSet(atlas, 0, sizeof(Atlas));
 	atlas->m_Allocator = allocator;
-	atlas->m_Width = w;
-	atlas->m_Height = h;
 
-	const uint32_t rootNodeID = fsAtlasAllocNode(atlas);
-	if (rootNodeID == UINT32_MAX) {
-		fsDestroyAtlas(atlas);
-		return nullptr;
+	for (uint32_t i = 0; i < FS_CONFIG_NUM_ATLAS_PAGES; ++i) {
+		if (fsAtlasAllocNode(atlas, &atlas->m_Pages[i]) == UINT32_MAX) {
+			fsDestroyAtlas(atlas);
+			return nullptr;
+		}
 	}
 
-	fsAtlasSetNode(atlas, rootNodeID, 0, 0, w);
+	fsAtlasReset(atlas, w, h);
 
 	return atlas;
 }
@@ -1022,14 +1218,16 @@ static Atlas* fsCreateAtlas(bx::AllocatorI* allocator, uint16_t w, uint16_t h)
 static void fsDestroyAtlas(Atlas* atlas)
 {
 	bx::AllocatorI* allocator = atlas->m_Allocator;
-	bx::free(allocator, atlas->m_Nodes);
+	for (uint32_t i = 0; i < FS_CONFIG_NUM_ATLAS_PAGES; ++i) {
+		bx::free(allocator, atlas->m_Pages[i].m_Nodes);
+	}
 	bx::free(allocator, atlas);
 }
 
-static uint32_t fsAtlasAllocNode(Atlas* atlas)
+static uint32_t fsAtlasAllocNode(Atlas* atlas, AtlasPage* page)
 {
-	if (atlas->m_NumNodes == atlas->m_NodeCapacity) {
-		const uint32_t oldCapacity = atlas->m_NodeCapacity;
+	if (page->m_NumNodes == page->m_NodeCapacity) {
+		const uint32_t oldCapacity = page->m_NodeCapacity;
 		const uint32_t newCapacity = oldCapacity == 0
 			? 64
 			: oldCapacity * 2
@@ -1040,134 +1238,141 @@ static uint32_t fsAtlasAllocNode(Atlas* atlas)
 			return UINT32_MAX;
 		}
 
-		bx::memCopy(&newNodes[0], atlas->m_Nodes, sizeof(AtlasNode) * oldCapacity);
+		bx::memCopy(&newNodes[0], page->m_Nodes, sizeof(AtlasNode) * oldCapacity);
 		bx::memSet(&newNodes[oldCapacity], 0, sizeof(AtlasNode) * (newCapacity - oldCapacity));
 
-		bx::free(atlas->m_Allocator, atlas->m_Nodes);
-		atlas->m_Nodes = newNodes;
-		atlas->m_NodeCapacity = newCapacity;
+		bx::free(atlas->m_Allocator, page->m_Nodes);
+		page->m_Nodes = newNodes;
+		page->m_NodeCapacity = newCapacity;
 	}
 
-	const uint32_t id = atlas->m_NumNodes;
-	++atlas->m_NumNodes;
+	const uint32_t id = page->m_NumNodes;
+	++page->m_NumNodes;
 	return id;
 }
 
-static inline void fsAtlasSetNode(Atlas* atlas, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w)
+static inline void fsAtlasSetNode(AtlasPage* page, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w)
 {
-	VG_CHECK(nodeID < atlas->m_NumNodes, "Invalid atlas node ID");
-	AtlasNode* node = &atlas->m_Nodes[nodeID];
+	VG_CHECK(nodeID < page->m_NumNodes, "Invalid atlas node ID");
+	AtlasNode* node = &page->m_Nodes[nodeID];
 	node->m_X = x;
 	node->m_Y = y;
 	node->m_Width = w;
 }
 
-static bool fsAtlasInsertNode(Atlas* atlas, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w)
+static bool fsAtlasInsertNode(Atlas* atlas, AtlasPage* page, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w)
 {
 	// Make sure there is room for one more node.
-	if (fsAtlasAllocNode(atlas) == UINT32_MAX) {
+	if (fsAtlasAllocNode(atlas, page) == UINT32_MAX) {
 		return false;
 	}
 
 	// Move everything up one slot
-	bx::memMove(&atlas->m_Nodes[nodeID + 1], &atlas->m_Nodes[nodeID], sizeof(AtlasNode) * (atlas->m_NumNodes - nodeID - 1));
+	bx::memMove(&page->m_Nodes[nodeID + 1], &page->m_Nodes[nodeID], sizeof(AtlasNode) * (page->m_NumNodes - nodeID - 1));
 
 	// Set the new node
-	fsAtlasSetNode(atlas, nodeID, x, y, w);
+	fsAtlasSetNode(page, nodeID, x, y, w);
 
 	return true;
 }
 
-static void fsAtlasRemoveNode(Atlas* atlas, uint32_t nodeID)
+static void fsAtlasRemoveNode(AtlasPage* page, uint32_t nodeID)
 {
-	bx::memMove(&atlas->m_Nodes[nodeID], &atlas->m_Nodes[nodeID + 1], sizeof(AtlasNode) * (atlas->m_NumNodes - nodeID - 1));
-	atlas->m_NumNodes--;
+	bx::memMove(&page->m_Nodes[nodeID], &page->m_Nodes[nodeID + 1], sizeof(AtlasNode) * (page->m_NumNodes - nodeID - 1));
+	page->m_NumNodes--;
 }
 
 static bool fsAtlasAddRect(Atlas* atlas, uint16_t rectWidth, uint16_t rectHeight, uint16_t* rectX, uint16_t* rectY)
 {
-	uint32_t besth = atlas->m_Height;
-	uint32_t bestw = atlas->m_Width;
-	uint32_t besti = UINT32_MAX;
-	uint32_t bestx = UINT32_MAX;
-	uint32_t besty = UINT32_MAX;
-
-	// Bottom left fit heuristic.
-	for (uint32_t i = 0; i < atlas->m_NumNodes; ++i) {
-		const uint32_t y = fsAtlasRectFits(atlas, i, rectWidth, rectHeight);
-		if (y != UINT32_MAX) {
-			const uint32_t y2 = y + rectHeight;
-			if (y2 < besth || (y2 == besth && atlas->m_Nodes[i].m_Width < bestw)) {
-				besti = i;
-				bestw = atlas->m_Nodes[i].m_Width;
-				besth = y2;
-				bestx = atlas->m_Nodes[i].m_X;
-				besty = y;
+	// Fill the pages in order. Pages are only reused after fsAtlasResetPage().
+	for (uint32_t iPage = 0; iPage < FS_CONFIG_NUM_ATLAS_PAGES; ++iPage) {
+		AtlasPage* page = &atlas->m_Pages[iPage];
+
+		uint32_t besth = page->m_MaxY;
+		uint32_t bestw = atlas->m_Width;
+		uint32_t besti = UINT32_MAX;
+		uint32_t bestx = UINT32_MAX;
+		uint32_t besty = UINT32_MAX;
+
+		// Bottom left fit heuristic.
+		for (uint32_t i = 0; i < page->m_NumNodes; ++i) {
+			const uint32_t y = fsAtlasRectFits(atlas, page, i, rectWidth, rectHeight);
+			if (y != UINT32_MAX) {
+				const uint32_t y2 = y + rectHeight;
+				if (y2 < besth || (y2 == besth && page->m_Nodes[i].m_Width < bestw)) {
+					besti = i;
+					bestw = page->m_Nodes[i].m_Width;
+					besth = y2;
+					bestx = page->m_Nodes[i].m_X;
+					besty = y;
+				}
 			}
 		}
-	}
 
-	if (besti == UINT32_MAX) {
-		return false;
-	}
+		if (besti == UINT32_MAX) {
+			continue;
+		}
 
-	// Perform the actual packing.
-	if (!fsAtlasAddSkylineLevel(atlas, besti, (uint16_t)bestx, (uint16_t)besty, rectWidth, rectHeight)) {
-		return false;
-	}
+		// Perform the actual packing.
+		if (!fsAtlasAddSkylineLevel(atlas, page, besti, (uint16_t)bestx, (uint16_t)besty, rectWidth, rectHeight)) {
+			return false;
+		}
 
-	*rectX = (uint16_t)bestx;
-	*rectY = (uint16_t)besty;
+		*rectX = (uint16_t)bestx;
+		*rectY = (uint16_t)besty;
 
-	return true;
+		return true;
+	}
+
+	return false;
 }
 
-static uint32_t fsAtlasRectFits(Atlas* atlas, uint32_t nodeID, uint16_t rectWidth, uint16_t rectHeight)
+static uint32_t fsAtlasRectFits(Atlas* atlas, AtlasPage* page, uint32_t nodeID, uint16_t rectWidth, uint16_t rectHeight)
 {
 	// Checks if there is enough space at the location of skyline span 'i',
 	// and return the max height of all skyline spans under that at that location,
 	// (think tetris block being dropped at that position). Or -1 if no space found.
-	uint16_t x = atlas->m_Nodes[nodeID].m_X;
-	uint16_t y = atlas->m_Nodes[nodeID].m_Y;
+	uint16_t x = page->m_Nodes[nodeID].m_X;
+	uint16_t y = page->m_Nodes[nodeID].m_Y;
 	if (x + rectWidth > atlas->m_Width) {
 		return UINT32_MAX;
 	}
 
 	int32_t spaceLeft = (int32_t)rectWidth;
 	while (spaceLeft > 0) {
-		if (nodeID == atlas->m_NumNodes) {
+		if (nodeID == page->m_NumNodes) {
 			return UINT32_MAX;
 		}
 
-		y = bx::max<uint16_t>(y, atlas->m_Nodes[nodeID].m_Y);
-		if (y + rectHeight > atlas->m_Height) {
+		y = bx::max<uint16_t>(y, page->m_Nodes[nodeID].m_Y);
+		if (y + rectHeight > page->m_MaxY) {
 			return UINT32_MAX;
 		}
 
-		spaceLeft -= atlas->m_Nodes[nodeID].m_Width;
+		spaceLeft -= page->m_Nodes[nodeID].m_Width;
 		++nodeID;
 	}
 
 	return (uint32_t)y;
 }
 
-static bool fsAtlasAddSkylineLevel(Atlas* atlas, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+static bool fsAtlasAddSkylineLevel(Atlas* atlas, AtlasPage* page, uint32_t nodeID, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
 	// Insert new node
-	if (!fsAtlasInsertNode(atlas, nodeID, x, y + h, w)) {
+	if (!fsAtlasInsertNode(atlas, page, nodeID, x, y + h, w)) {
 		return false;
 	}
 
 	// Delete skyline segments that fall under the shadow of the new segment.
-	for (uint32_t i = nodeID + 1; i < atlas->m_NumNodes; ++i) {
-		AtlasNode* curNode = &atlas->m_Nodes[i];
-		const AtlasNode* prevNode = &atlas->m_Nodes[i - 1];
+	for (uint32_t i = nodeID + 1; i < page->m_NumNodes; ++i) {
+		AtlasNode* curNode = &page->m_Nodes[i];
+		const AtlasNode* prevNode = &page->m_Nodes[i - 1];
 
 		const uint16_t prevNodeEndX = prevNode->m_X + prevNode->m_Width;
 		if (curNode->m_X < prevNodeEndX) {
 			const uint16_t shrink = prevNodeEndX - curNode->m_X;
 			if (curNode->m_Width <= shrink) {
-				fsAtlasRemoveNode(atlas, i);
+				fsAtlasRemoveNode(page, i);
 				--i;
 			} else {
 				curNode->m_X += shrink;
@@ -1180,13 +1385,13 @@ static bool fsAtlasAddSkylineLevel(Atlas* atlas, uint32_t nodeID, uint16_t x, ui
 	}
 
 	// Merge same height skyline segments that are next to each other.
-	for (uint32_t i = 0; i < atlas->m_NumNodes - 1; ++i) {
-		AtlasNode* curNode = &atlas->m_Nodes[i];
-		const AtlasNode* nextNode = &atlas->m_Nodes[i + 1];
+	for (uint32_t i = 0; i < page->m_NumNodes - 1; ++i) {
+		AtlasNode* curNode = &page->m_Nodes[i];
+		const AtlasNode* nextNode = &page->m_Nodes[i + 1];
 
 		if (curNode->m_Y == nextNode->m_Y) {
 			curNode->m_Width += nextNode->m_Width;
-			fsAtlasRemoveNode(atlas, i + 1);
+			fsAtlasRemoveNode(page, i + 1);
 			--i;
 		}
 	}
@@ -1198,13 +1403,36 @@ static void fsAtlasReset(Atlas* atlas, uint16_t w, uint16_t h)
 {
 	atlas->m_Width = w;
 	atlas->m_Height = h;
-	atlas->m_NumNodes = 0;
+	atlas->m_PageHeight = h / FS_CONFIG_NUM_ATLAS_PAGES;
+
+	for (uint32_t i = 0; i < FS_CONFIG_NUM_ATLAS_PAGES; ++i) {
+		AtlasPage* page = &atlas->m_Pages[i];
+		page->m_MinY = (uint16_t)(i * atlas->m_PageHeight);
+		page->m_MaxY = (i == FS_CONFIG_NUM_ATLAS_PAGES - 1)
+			? h
+			: (uint16_t)(page->m_MinY + atlas->m_PageHeight)
+			;
+
+		fsAtlasResetPage(atlas, i);
+	}
+}
+
+static void fsAtlasResetPage(Atlas* atlas, uint32_t pageID)
+{
+	AtlasPage* page = &atlas->m_Pages[pageID];
+	page->m_NumNodes = 0;
+	page->m_LastUsedFrame = 0;
 
 	// Init root node.
-	atlas->m_Nodes[0].m_X = 0;
-	atlas->m_Nodes[0].m_Y = 0;
-	atlas->m_Nodes[0].m_Width = (short)w;
-	atlas->m_NumNodes++;
+	page->m_Nodes[0].m_X = 0;
+	page->m_Nodes[0].m_Y = page->m_MinY;
+	page->m_Nodes[0].m_Width = atlas->m_Width;
+	page->m_NumNodes++;
+}
+
+static inline uint32_t fsAtlasGetPageID(const Atlas* atlas, uint16_t y)
+{
+	return bx::min<uint32_t>((uint32_t)(y / atlas->m_PageHeight), FS_CONFIG_NUM_ATLAS_PAGES - 1);
 }
 
 // Copyright (c) 2008-2010 Bjoern Hoehrmann <bjoern@hoehrmann.de>
@@ -1282,6 +1510,7 @@ static bool fsTextBufferExpand(TextBuffer* tb, uint32_t newCapacity, bool keepOl
 		+ bx::strideAlign(sizeof(int32_t) * newCapacity, 16)    // m_GlyphIndices
 		+ bx::strideAlign(sizeof(int32_t) * newCapacity, 16)    // m_KernAdv
 		+ bx::strideAlign(sizeof(FontHandle) * newCapacity, 16) // m_GlyphFonts
+		+ bx::strideAlign(sizeof(ImageHandle) * newCapacity, 16) // m_QuadImages
 		;
 
 	uint8_t* buffer = (uint8_t*)bx::alignedAlloc(allocator, totalMemory, 16);
@@ -1296,6 +1525,7 @@ static bool fsTextBufferExpand(TextBuffer* tb, uint32_t newCapacity, bool keepOl
 	int32_t* newGlyphIndices = (int32_t*)ptr;      ptr += bx::strideAlign(sizeof(int32_t) * newCapacity, 16);
 	int32_t* newKernAdv = (int32_t*)ptr;           ptr += bx::strideAlign(sizeof(int32_t) * newCapacity, 16);
 	FontHandle* newGlyphFonts = (FontHandle*)ptr;  ptr += bx::strideAlign(sizeof(FontHandle) * newCapacity, 16);
+	ImageHandle* newQuadImages = (ImageHandle*)ptr; ptr += bx::strideAlign(sizeof(ImageHandle) * newCapacity, 16);
 
 	if (keepOldData) {
 		const uint32_t oldCapacity = tb->m_Capacity;
@@ -1305,6 +1535,7 @@ static bool fsTextBufferExpand(TextBuffer* tb, uint32_t newCapacity, bool keepOl
 		bx::memCopy(newGlyphIndices, tb->m_GlyphIndices, sizeof(int32_t) * oldCapacity);
 		bx::memCopy(newKernAdv, tb->m_KernAdv, sizeof(int32_t) * oldCapacity);
 		bx::memCopy(newGlyphFonts, tb->m_GlyphFonts, sizeof(FontHandle) * oldCapacity);
+		bx::memCopy(newQuadImages, tb->m_QuadImages, sizeof(ImageHandle) * oldCapacity);
 	}
 
 	if (tb->m_Buffer) {
@@ -1317,6 +1548,7 @@ static bool fsTextBufferExpand(TextBuffer* tb, uint32_t newCapacity, bool keepOl
 	tb->m_GlyphIndices = newGlyphIndices;
 	tb->m_KernAdv = newKernAdv;
 	tb->m_GlyphFonts = newGlyphFonts;
+	tb->m_QuadImages = newQuadImages;
 	tb->m_Capacity = newCapacity;
 
 	return true;
@@ -1379,6 +1611,17 @@ static float fsGetVertAlign(FontSystem* fs, const Font* font, uint32_t align, in
 	return 0.0f;
 }
 
+static void fsGetAtlasUVScale(const FontSystem* fs, float* x_to_u, float* y_to_v)
+{
+#if VG_CONFIG_UV_INT16
+	*x_to_u = (float)INT16_MAX / (float)fs->m_Atlas->m_Width;
+	*y_to_v = (float)INT16_MAX / (float)fs->m_Atlas->m_Height;
+#else
+	*x_to_u = 1.0f / (float)fs->m_Atlas->m_Width;
+	*y_to_v = 1.0f / (float)fs->m_Atlas->m_Height;
+#endif
+}
+
 static uint32_t fsHashGlyphCode(uint64_t glyphCode)
 {
 	// BKDR
@@ -1475,10 +1718,14 @@ static void fsBlur(uint8_t* dst, int32_t w, int32_t h, int32_t dstStride, int32_
 static Glyph* fsBakeGlyph(FontSystem* fs, Font* font, int32_t glyphIndex, uint32_t codepoint, int16_t isize, int16_t iblur, bool glyphBitmapOptional)
 {
 	const float size = (float)isize / 10.0f;
-	const int32_t pad = iblur + 2;
+	const int32_t pad = iblur == FS_SDF_GLYPH_BLUR ? FS_CONFIG_SDF_PAD : iblur + 2;
 
 	Glyph* glyph = fsFontFindGlyph(font, codepoint, isize, iblur);
 	if (glyph && (glyphBitmapOptional || (glyph->m_RectPos[0] != UINT16_MAX && glyph->m_RectPos[1] != UINT16_MAX))) {
+		if (!glyphBitmapOptional) {
+			fs->m_Atlas->m_Pages[fsAtlasGetPageID(fs->m_Atlas, glyph->m_RectPos[1])].m_LastUsedFrame = fs->m_FrameID;
+		}
+
 		return glyph;
 	}
 
@@ -1494,9 +1741,15 @@ static Glyph* fsBakeGlyph(FontSystem* fs, Font* font, int32_t glyphIndex, uint32
 	uint16_t gx, gy;
 	if (!glyphBitmapOptional) {
 		bool added = fsAtlasAddRect(fs->m_Atlas, gw, gh, &gx, &gy);
+		while (!added && gh <= fs->m_Atlas->m_PageHeight && fsEvictAtlasPage(fs)) {
+			added = fsAtlasAddRect(fs->m_Atlas, gw, gh, &gx, &gy);
+		}
+
 		if (!added) {
 			return nullptr;
 		}
+
+		fs->m_Atlas->m_Pages[fsAtlasGetPageID(fs->m_Atlas, gy)].m_LastUsedFrame = fs->m_FrameID;
 	} else {
 		gx = UINT16_MAX;
 		gy = UINT16_MAX;
@@ -1525,34 +1778,170 @@ static Glyph* fsBakeGlyph(FontSystem* fs, Font* font, int32_t glyphIndex, uint32
 		return glyph;
 	}
 
-	// Rasterize
-	{
-		const uint32_t atlasWidth = fs->m_Atlas->m_Width;
+	// The atlas rect is reserved; the bitmap is copied to it by fsResolveGlyphJobs().
+	if (fs->m_GlyphJobs && fsPushGlyphJob(fs, font, glyphIndex, scale, glyph, pad, iblur)) {
+		return glyph;
+	}
 
-		uint8_t* dst = &fs->m_ImageData[(gx + pad) + (gy + pad) * atlasWidth];
-		fsBackendRenderGlyphBitmap(font->m_BackendData, dst, gw - pad * 2, gh - pad * 2, atlasWidth, scale, scale, glyphIndex);
+	const uint32_t atlasWidth = fs->m_Atlas->m_Width;
+	fsRenderGlyph(font->m_BackendData, glyphIndex, scale, &fs->m_ImageData[gx + gy * atlasWidth], atlasWidth, gw, gh, pad, iblur);
 
-		// Make sure there is one pixel empty border.
-		dst = &fs->m_ImageData[gx + gy * atlasWidth];
-		for (uint32_t y = 0; y < gh; y++) {
-			dst[y * atlasWidth] = 0;
-			dst[gw - 1 + y * atlasWidth] = 0;
-		}
-		for (uint32_t x = 0; x < gw; x++) {
-			dst[x] = 0;
-			dst[x + (gh - 1) * atlasWidth] = 0;
-		}
+	fsInvalidateRect(fs, glyph->m_RectPos[0], glyph->m_RectPos[1], glyph->m_RectPos[0] + glyph->m_RectSize[0], glyph->m_RectPos[1] + glyph->m_RectSize[1]);
+
+	return glyph;
+}
+
+// Rasterizes a gw x gh glyph rect (including padding) at dst. Only touches the memory of the rect
+// so it can be called from any thread as long as the rect isn't shared.
+static void fsRenderGlyph(void* fontBackendData, int32_t glyphIndex, float scale, uint8_t* dst, uint32_t dstStride, uint16_t gw, uint16_t gh, int32_t pad, int16_t iblur)
+{
+#if VG_CONFIG_ENABLE_SDF_TEXT
+	if (iblur == FS_SDF_GLYPH_BLUR) {
+		fsBackendRenderGlyphSDF(fontBackendData, dst, gw, gh, dstStride, scale, pad, glyphIndex);
+		return;
+	}
+#endif
+
+	fsBackendRenderGlyphBitmap(fontBackendData, &dst[pad + pad * dstStride], gw - pad * 2, gh - pad * 2, dstStride, scale, scale, glyphIndex);
+
+	// Make sure there is one pixel empty border.
+	for (uint32_t y = 0; y < gh; y++) {
+		dst[y * dstStride] = 0;
+		dst[gw - 1 + y * dstStride] = 0;
+	}
+	for (uint32_t x = 0; x < gw; x++) {
+		dst[x] = 0;
+		dst[x + (gh - 1) * dstStride] = 0;
 	}
 
 	// Blur
 	if (iblur > 0) {
-		uint8_t* bdst = &fs->m_ImageData[gx + gy * fs->m_Atlas->m_Width];
-		fsBlur(bdst, gw, gh, fs->m_Atlas->m_Width, iblur);
+		fsBlur(dst, gw, gh, dstStride, iblur);
 	}
+}
 
-	fsInvalidateRect(fs, glyph->m_RectPos[0], glyph->m_RectPos[1], glyph->m_RectPos[0] + glyph->m_RectSize[0], glyph->m_RectPos[1] + glyph->m_RectSize[1]);
+// NOTE: Should only be called from the thread calling begin()/end().
+static bool fsPushGlyphJob(FontSystem* fs, const Font* font, int32_t glyphIndex, float scale, const Glyph* glyph, int32_t pad, int16_t iblur)
+{
+	const uint32_t jobID = fs->m_NumGlyphJobs;
+	if (jobID == FS_CONFIG_MAX_GLYPH_JOBS) {
+		return false;
+	}
 
-	return glyph;
+	const uint32_t bitmapSize = (uint32_t)glyph->m_RectSize[0] * (uint32_t)glyph->m_RectSize[1];
+	uint8_t* bitmap = (uint8_t*)bx::alloc(fs->m_Allocator, bitmapSize);
+	if (!bitmap) {
+		return false;
+	}
+	bx::memSet(bitmap, 0, bitmapSize);
+
+	GlyphJob* job = &fs->m_GlyphJobs[jobID];
+	job->m_FontBackendData = font->m_BackendData;
+	job->m_Bitmap = bitmap;
+	job->m_AtlasID = fs->m_AtlasID;
+	job->m_Done = 0;
+	job->m_GlyphIndex = glyphIndex;
+	job->m_Scale = scale;
+	job->m_RectPos[0] = glyph->m_RectPos[0];
+	job->m_RectPos[1] = glyph->m_RectPos[1];
+	job->m_RectSize[0] = glyph->m_RectSize[0];
+	job->m_RectSize[1] = glyph->m_RectSize[1];
+	job->m_Pad = (int16_t)pad;
+	job->m_Blur = iblur;
+	job->m_Cancelled = 0;
+
+	// Publish the job only after it has been completely written.
+	fsAtomicStore(&fs->m_NumGlyphJobs, jobID + 1);
+
+	return true;
+}
+
+// NOTE: Can be called from any thread. Returns UINT32_MAX if there are no unclaimed jobs.
+static uint32_t fsClaimGlyphJob(FontSystem* fs)
+{
+	uint32_t jobID;
+	do {
+		jobID = fs->m_NextGlyphJob;
+		if (jobID >= fsAtomicLoad(&fs->m_NumGlyphJobs)) {
+			return UINT32_MAX;
+		}
+	} while (bx::atomicCompareAndSwap(&fs->m_NextGlyphJob, jobID, jobID + 1) != jobID);
+
+	return jobID;
+}
+
+// NOTE: bx::readBarrier()/writeBarrier() only prevent compiler reordering. Values shared between the
+// main thread and the threads calling fsRasterizeGlyphs() go through atomic read-modify-write operations,
+// which are full memory barriers, so everything written before fsAtomicStore() is visible to any thread
+// after fsAtomicLoad() returns the stored value.
+static uint32_t fsAtomicLoad(volatile uint32_t* ptr)
+{
+	return bx::atomicFetchAndAdd(ptr, 0u);
+}
+
+static void fsAtomicStore(volatile uint32_t* ptr, uint32_t value)
+{
+	uint32_t old;
+	do {
+		old = *ptr;
+	} while (bx::atomicCompareAndSwap(ptr, old, value) != old);
+}
+
+// Copies the bitmaps of claimed jobs to the atlas and rasterizes the unclaimed ones directly into it
+// (unless keepUnclaimed is set). Jobs are retired by freeing their bitmap. Jobs for a previous atlas
+// or for an evicted rect are dropped.
+// NOTE: Should only be called from the thread calling begin()/end().
+static void fsFinishGlyphJobs(FontSystem* fs, bool keepUnclaimed)
+{
+	bx::AllocatorI* allocator = fs->m_Allocator;
+	const uint32_t numGlyphJobs = fs->m_NumGlyphJobs;
+	const uint32_t atlasWidth = fs->m_Atlas->m_Width;
+
+	// Claim all the remaining jobs so no other thread starts working on them.
+	uint32_t firstUnclaimed = fs->m_NextGlyphJob;
+	if (!keepUnclaimed) {
+		while (bx::atomicCompareAndSwap(&fs->m_NextGlyphJob, firstUnclaimed, numGlyphJobs) != firstUnclaimed) {
+			firstUnclaimed = fs->m_NextGlyphJob;
+		}
+	}
+
+	for (uint32_t i = 0; i < numGlyphJobs; ++i) {
+		GlyphJob* job = &fs->m_GlyphJobs[i];
+		if (!job->m_Bitmap) {
+			continue;
+		}
+
+		const bool claimed = i < firstUnclaimed;
+		const bool valid = !job->m_Cancelled && job->m_AtlasID == fs->m_AtlasID;
+		if (!claimed && valid && keepUnclaimed) {
+			continue;
+		}
+
+		const uint16_t gx = job->m_RectPos[0];
+		const uint16_t gy = job->m_RectPos[1];
+		const uint16_t gw = job->m_RectSize[0];
+		const uint16_t gh = job->m_RectSize[1];
+		if (claimed) {
+			// The job might still be rasterized by another thread when switching atlases mid-frame.
+			while (!fsAtomicLoad(&job->m_Done)) {
+			}
+
+			if (valid) {
+				for (uint32_t y = 0; y < gh; ++y) {
+					bx::memCopy(&fs->m_ImageData[gx + (gy + y) * atlasWidth], &job->m_Bitmap[y * gw], gw);
+				}
+			}
+		} else if (valid) {
+			fsRenderGlyph(job->m_FontBackendData, job->m_GlyphIndex, job->m_Scale, &fs->m_ImageData[gx + gy * atlasWidth], atlasWidth, gw, gh, job->m_Pad, job->m_Blur);
+		}
+
+		if (valid) {
+			fsInvalidateRect(fs, gx, gy, gx + gw, gy + gh);
+		}
+
+		bx::free(allocator, job->m_Bitmap);
+		job->m_Bitmap = nullptr;
+	}
 }
 
 static Glyph* fsAllocGlyph(FontSystem* fs, Font* font)
@@ -1699,6 +2088,37 @@ static void fsBackendRenderGlyphBitmap(void* fontPtr, uint8_t* output, int32_t o
 	stbtt_MakeGlyphBitmap(&font->m_Font, output, outWidth, outHeight, outStride, scaleX, scaleY, glyph);
 }
 
+#if VG_CONFIG_ENABLE_SDF_TEXT
+// Writes the whole outWidth x outHeight rect. The distance field covers the glyph box returned by
+// fsBackendBuildGlyphBitmap() expanded by pad on each side.
+static void fsBackendRenderGlyphSDF(void* fontPtr, uint8_t* output, int32_t outWidth, int32_t outHeight, int32_t outStride, float scale, int32_t pad, int glyph)
+{
+	FontStb* font = (FontStb*)fontPtr;
+
+	int w = 0, h = 0, xoff, yoff;
+	uint8_t* sdf = stbtt_GetGlyphSDF(&font->m_Font, scale, glyph, pad, FS_SDF_ON_EDGE_VALUE, FS_SDF_DIST_SCALE, &w, &h, &xoff, &yoff);
+
+	// NOTE: Glyphs without an outline (e.g. space) return nullptr.
+	const int32_t copyWidth = sdf ? bx::min<int32_t>(w, outWidth) : 0;
+	const int32_t copyHeight = sdf ? bx::min<int32_t>(h, outHeight) : 0;
+	for (int32_t y = 0; y < outHeight; ++y) {
+		uint8_t* dstRow = &output[y * outStride];
+
+		int32_t rowWidth = 0;
+		if (y < copyHeight) {
+			bx::memCopy(dstRow, &sdf[y * w], copyWidth);
+			rowWidth = copyWidth;
+		}
+
+		bx::memSet(&dstRow[rowWidth], 0, outWidth - rowWidth);
+	}
+
+	if (sdf) {
+		stbtt_FreeSDF(sdf, font->m_Font.userdata);
+	}
+}
+#endif
+
 static int32_t fsBackendGetGlyphKernAdvance(void* fontPtr, int32_t glyph1, int32_t glyph2)
 {
 	FontStb* font = (FontStb*)fontPtr;
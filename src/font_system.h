@@ -31,6 +31,7 @@ struct FontSystemConfig
 	uint32_t m_MaxTextureSize;
 	uint32_t m_Flags;
 	uint32_t m_FontAtlasImageFlags;
+	uint32_t m_GlyphRasterization;
 };
 
 struct TextQuad
@@ -49,12 +50,15 @@ BX_STATIC_ASSERT((sizeof(TextQuad) & 15) == 0, "TextQuad size must be a multiple
 struct TextMesh
 {
 	const TextQuad* m_Quads;
+	const ImageHandle* m_QuadImages; // Atlas image of each quad
 	const uint32_t* m_Codepoints;
 	const uint8_t* m_CodepointSize;
 	uint32_t m_Size;
 	float m_Width;
 	float m_Alignment[2];
 	float m_Bounds[4];
+	float m_DistanceFieldBlur; // Half width of the blurred glyph edges, in distance field units (texel alpha)
+	bool m_DistanceField;      // The quads sample distance field glyphs (VG_CONFIG_ENABLE_SDF_TEXT)
 };
 
 struct TextFlags
@@ -75,6 +79,8 @@ FontHandle fsFindFont(const FontSystem* fs, const char* name);
 bool fsAddFallbackFont(FontSystem* fs, FontHandle baseFont, FontHandle fallbackFont);
 const uint8_t* fsGetImageData(const FontSystem* fs, uint16_t* imageSize);
 void fsFlushFontAtlasImage(FontSystem* fs, vg::Context* ctx);
+uint32_t fsRasterizeGlyphs(FontSystem* fs, uint32_t maxGlyphs);
+void fsResolveGlyphJobs(FontSystem* fs);
 ImageHandle fsGetFontAtlasImage(const FontSystem* fs);
 const uv_t* fsGetWhitePixelUV(const FontSystem* fs);
 
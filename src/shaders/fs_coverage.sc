@@ -0,0 +1,10 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+// v_texcoord0 holds the distances of the fragment from 2 edges of the outline, in fringe widths.
+void main()
+{
+	vec2 coverage = clamp(v_texcoord0.xy, 0.0, 1.0);
+	gl_FragColor = vec4(v_color0.xyz, v_color0.w * coverage.x * coverage.y);
+}
@@ -0,0 +1,20 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_tex, 0);
+
+uniform vec4 u_sdfParams;
+
+#define u_blur (u_sdfParams.x)
+
+// Atlas alpha on the glyph outline (FS_SDF_ON_EDGE_VALUE in font_system.cpp)
+#define ON_EDGE_VALUE (128.0 / 255.0)
+
+void main()
+{
+	float dist = texture2D(s_tex, v_texcoord0.xy).w;
+	float width = 0.7 * fwidth(dist) + u_blur;
+	float coverage = smoothstep(ON_EDGE_VALUE - width, ON_EDGE_VALUE + width, dist);
+	gl_FragColor = vec4(v_color0.xyz, v_color0.w * coverage);
+}
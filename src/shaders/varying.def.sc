@@ -5,3 +5,7 @@ vec2 v_position  : TEXCOORD1 = vec2(0.0, 0.0);
 vec2 a_position  : POSITION;
 vec4 a_color0    : COLOR0;
 vec2 a_texcoord0 : TEXCOORD0;
+
+vec4 i_data0     : TEXCOORD7;
+vec4 i_data1     : TEXCOORD6;
+vec4 i_data2     : TEXCOORD5;
@@ -0,0 +1,15 @@
+$input a_position, a_color0, a_texcoord0, i_data0, i_data1, i_data2
+$output v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+// i_data0/i_data1: Rows of the instance's 2x3 matrix
+// i_data2: Instance color
+void main()
+{
+	vec3 localPos = vec3(a_position, 1.0);
+	vec2 pos = vec2(dot(i_data0.xyz, localPos), dot(i_data1.xyz, localPos) );
+	gl_Position = mul(u_modelViewProj, vec4(pos, 0.0, 1.0) );
+	v_color0 = a_color0 * i_data2;
+	v_texcoord0 = a_texcoord0;
+}
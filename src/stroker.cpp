@@ -19,6 +19,8 @@ struct Vec2
 	float x, y;
 };
 
+static const index_t kInvalidIndex = (index_t)~0u;
+
 inline Vec2 vec2Add(const Vec2& a, const Vec2& b)    { return{ a.x + b.x, a.y + b.y }; }
 inline Vec2 vec2Sub(const Vec2& a, const Vec2& b)    { return{ a.x - b.x, a.y - b.y }; }
 inline Vec2 vec2Scale(const Vec2& a, float s)        { return{ a.x * s, a.y * s }; }
@@ -161,11 +163,14 @@ struct Stroker
 	bx::AllocatorI* m_Allocator;
 	Vec2* m_PosBuffer;
 	uint32_t* m_ColorBuffer;
-	uint16_t* m_IndexBuffer;
+	index_t* m_IndexBuffer;
 	uint32_t m_NumVertices;
 	uint32_t m_NumIndices;
 	uint32_t m_VertexCapacity;
 	uint32_t m_IndexCapacity;
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+	Vec2* m_UVBuffer;
+#endif
 	TESStesselator* m_Tesselator;
 	libtess2Allocator m_libTessAllocator;
 	float m_FringeWidth;
@@ -183,13 +188,21 @@ template<bool _Closed, LineCap::Enum _LineCap, LineJoin::Enum _LineJoin>
 static void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numPathVertices, float strokeWidth, Color color);
 template<LineCap::Enum _LineCap, LineJoin::Enum _LineJoin>
 static void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numPathVertices, Color color, bool closed);
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+static void polylineStrokeAnalyticAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numPathVertices, bool closed, float strokeWidth, LineCap::Enum lineCap, LineJoin::Enum lineJoin);
+static void addAnalyticAACapStrip(Stroker* stroker, const Vec2& e, const Vec2& d, const Vec2& l, float hsw_aa);
+#endif
 
 template<uint32_t N>
 static void addPos(Stroker* stroker, const Vec2* srcPos);
 template<uint32_t N>
 static void addPosColor(Stroker* stroker, const Vec2* srcPos, const uint32_t* srcColor);
 template<uint32_t N>
-static void addIndices(Stroker* stroker, const uint16_t* src);
+static void addIndices(Stroker* stroker, const index_t* src);
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+template<uint32_t N>
+static void addPosUV(Stroker* stroker, const Vec2* srcPos, const Vec2* srcUV);
+#endif
 
 Stroker* createStroker(bx::AllocatorI* allocator)
 {
@@ -209,6 +222,9 @@ void destroyStroker(Stroker* stroker)
 	bx::alignedFree(allocator, stroker->m_PosBuffer, 16);
 	bx::alignedFree(allocator, stroker->m_ColorBuffer, 16);
 	bx::alignedFree(allocator, stroker->m_IndexBuffer, 16);
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+	bx::alignedFree(allocator, stroker->m_UVBuffer, 16);
+#endif
 
 	if (stroker->m_Tesselator) {
 		tessDeleteTess(stroker->m_Tesselator);
@@ -324,6 +340,17 @@ void strokerPolylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const float* vert
 	}
 }
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+void strokerPolylineStrokeAnalyticAA(Stroker* stroker, Mesh* mesh, const float** uvBuffer, const float* vertexList, uint32_t numPathVertices, bool isClosed, float strokeWidth, LineCap::Enum lineCap, LineJoin::Enum lineJoin)
+{
+	const Vec2* vtx = (const Vec2*)vertexList;
+
+	polylineStrokeAnalyticAA(stroker, mesh, vtx, numPathVertices, isClosed, strokeWidth, lineCap, lineJoin);
+
+	*uvBuffer = &stroker->m_UVBuffer[0].x;
+}
+#endif
+
 void strokerConvexFill(Stroker* stroker, Mesh* mesh, const float* vertexList, uint32_t numVertices)
 {
 	const uint32_t numTris = numVertices - 2;
@@ -335,8 +362,8 @@ void strokerConvexFill(Stroker* stroker, Mesh* mesh, const float* vertexList, ui
 	{
 		expandIB(stroker, numIndices);
 
-		uint16_t* dstIndex = stroker->m_IndexBuffer;
-		uint16_t nextID = 1;
+		index_t* dstIndex = stroker->m_IndexBuffer;
+		index_t nextID = 1;
 
 		uint32_t n = numTris;
 		while (n-- > 0) {
@@ -357,7 +384,8 @@ void strokerConvexFill(Stroker* stroker, Mesh* mesh, const float* vertexList, ui
 	mesh->m_NumIndices = stroker->m_NumIndices;
 }
 
-#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
+// NOTE: The SIMD version generates 16-bit indices.
+#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86 && !VG_CONFIG_INDEX_UINT32
 void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList, uint32_t numVertices, uint32_t color)
 {
 	VG_CHECK(numVertices >= 3, "Invalid number of vertices");
@@ -604,7 +632,7 @@ void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList,
 	{
 		expandIB(stroker, numDrawIndices);
 
-		uint16_t* dstIndex = stroker->m_IndexBuffer;
+		index_t* dstIndex = stroker->m_IndexBuffer;
 
 		// First fringe quad
 		dstIndex[0] = 0; dstIndex[1] = 1; dstIndex[2] = 3;
@@ -685,7 +713,7 @@ void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList,
 		}
 
 		// Last fringe quad
-		const uint16_t lastID = (uint16_t)((numVertices - 1) << 1);
+		const index_t lastID = (index_t)((numVertices - 1) << 1);
 		dstIndex[0] = lastID;
 		dstIndex[1] = lastID + 1;
 		dstIndex[2] = 1;
@@ -756,11 +784,11 @@ void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList,
 	{
 		expandIB(stroker, numDrawIndices);
 
-		uint16_t* dstIndex = stroker->m_IndexBuffer;
+		index_t* dstIndex = stroker->m_IndexBuffer;
 
 		// Generate the triangle fan (original polygon)
 		const uint32_t numFanTris = numVertices - 2;
-		uint16_t secondTriVertex = 2;
+		index_t secondTriVertex = 2;
 		for (uint32_t i = 0; i < numFanTris; ++i) {
 			*dstIndex++ = 0;
 			*dstIndex++ = secondTriVertex;
@@ -769,7 +797,7 @@ void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList,
 		}
 
 		// Generate the AA fringes
-		uint16_t firstVertexID = 0;
+		index_t firstVertexID = 0;
 		for (uint32_t i = 0; i < numVertices - 1; ++i) {
 			*dstIndex++ = firstVertexID;
 			*dstIndex++ = firstVertexID + 1;
@@ -799,6 +827,27 @@ void strokerConvexFillAA(Stroker* stroker, Mesh* mesh, const float* vertexList,
 }
 #endif
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+void strokerConvexFillAnalyticAA(Stroker* stroker, Mesh* mesh, const float** uvBuffer, const float* vertexList, uint32_t numVertices)
+{
+	strokerConvexFillAA(stroker, mesh, vertexList, numVertices, Colors::White);
+
+	// Each polygon vertex generates an inner vertex (one fringe away from the outline) followed by an outer one.
+	const Vec2 uvInner = { 1.0f, 1.0f };
+	const Vec2 uvOuter = { 0.0f, 1.0f };
+
+	Vec2* dstUV = stroker->m_UVBuffer;
+	for (uint32_t i = 0; i < numVertices; ++i) {
+		dstUV[0] = uvInner;
+		dstUV[1] = uvOuter;
+		dstUV += 2;
+	}
+
+	mesh->m_ColorBuffer = nullptr;
+	*uvBuffer = &stroker->m_UVBuffer[0].x;
+}
+#endif
+
 bool strokerConcaveFillBegin(Stroker* stroker)
 {
 	// Delete old tesselator
@@ -923,14 +972,14 @@ bool strokerConcaveFillEndAA(Stroker* stroker, Mesh* mesh, uint32_t color, FillR
 		// Indices
 		expandIB(stroker, numContourVertices * 6);
 		{
-			uint16_t* dstIndex = &stroker->m_IndexBuffer[nextIndexID];
+			index_t* dstIndex = &stroker->m_IndexBuffer[nextIndexID];
 
 			const uint32_t numSegments = numContourVertices - 1;
 			for (uint32_t iSegment = 0; iSegment < numSegments; ++iSegment) {
-				const uint16_t id0 = (uint16_t)(nextVertexID + iSegment * 2 + 0);
-				const uint16_t id1 = (uint16_t)(nextVertexID + iSegment * 2 + 1);
-				const uint16_t id2 = (uint16_t)(nextVertexID + iSegment * 2 + 2);
-				const uint16_t id3 = (uint16_t)(nextVertexID + iSegment * 2 + 3);
+				const index_t id0 = (index_t)(nextVertexID + iSegment * 2 + 0);
+				const index_t id1 = (index_t)(nextVertexID + iSegment * 2 + 1);
+				const index_t id2 = (index_t)(nextVertexID + iSegment * 2 + 2);
+				const index_t id3 = (index_t)(nextVertexID + iSegment * 2 + 3);
 
 				dstIndex[0] = id0;
 				dstIndex[1] = id2;
@@ -943,10 +992,10 @@ bool strokerConcaveFillEndAA(Stroker* stroker, Mesh* mesh, uint32_t color, FillR
 
 			// Last (closing) segment
 			{
-				const uint16_t id0 = (uint16_t)(nextVertexID + numSegments * 2 + 0);
-				const uint16_t id1 = (uint16_t)(nextVertexID + numSegments * 2 + 1);
-				const uint16_t id2 = (uint16_t)(nextVertexID + 0);
-				const uint16_t id3 = (uint16_t)(nextVertexID + 1);
+				const index_t id0 = (index_t)(nextVertexID + numSegments * 2 + 0);
+				const index_t id1 = (index_t)(nextVertexID + numSegments * 2 + 1);
+				const index_t id2 = (index_t)(nextVertexID + 0);
+				const index_t id3 = (index_t)(nextVertexID + 1);
 
 				dstIndex[0] = id0;
 				dstIndex[1] = id2;
@@ -982,7 +1031,7 @@ bool strokerConcaveFillEndAA(Stroker* stroker, Mesh* mesh, uint32_t color, FillR
 	const uint32_t numTessIndices = tessGetElementCount(stroker->m_Tesselator) * 3;
 	expandIB(stroker, numTessIndices);
 	{
-		vgutil::batchTransformDrawIndices(tessGetElements(stroker->m_Tesselator), numTessIndices, &stroker->m_IndexBuffer[nextIndexID], (uint16_t)nextVertexID);
+		vgutil::batchTransformDrawIndices(tessGetElements(stroker->m_Tesselator), numTessIndices, &stroker->m_IndexBuffer[nextIndexID], (index_t)nextVertexID);
 		stroker->m_NumIndices += numTessIndices;
 	}
 
@@ -995,6 +1044,30 @@ bool strokerConcaveFillEndAA(Stroker* stroker, Mesh* mesh, uint32_t color, FillR
 	return true;
 }
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+bool strokerConcaveFillEndAnalyticAA(Stroker* stroker, Mesh* mesh, const float** uvBuffer, FillRule::Enum fillRule)
+{
+	if (!strokerConcaveFillEndAA(stroker, mesh, Colors::White, fillRule)) {
+		return false;
+	}
+
+	// Only the outer fringe vertices (alpha = 0) lie on the outline. The rest of the vertices are
+	// at least one fringe inside it.
+	const uint32_t numVertices = stroker->m_NumVertices;
+	const uint32_t* srcColor = stroker->m_ColorBuffer;
+	Vec2* dstUV = stroker->m_UVBuffer;
+	for (uint32_t i = 0; i < numVertices; ++i) {
+		dstUV[i].x = colorGetAlpha(srcColor[i]) != 0 ? 1.0f : 0.0f;
+		dstUV[i].y = 1.0f;
+	}
+
+	mesh->m_ColorBuffer = nullptr;
+	*uvBuffer = &stroker->m_UVBuffer[0].x;
+
+	return true;
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Templates
 //
@@ -1009,10 +1082,10 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 	resetGeometry(stroker);
 
 	Vec2 d01;
-	uint16_t prevSegmentLeftID = 0xFFFF;
-	uint16_t prevSegmentRightID = 0xFFFF;
-	uint16_t firstSegmentLeftID = 0xFFFF;
-	uint16_t firstSegmentRightID = 0xFFFF;
+	index_t prevSegmentLeftID = kInvalidIndex;
+	index_t prevSegmentRightID = kInvalidIndex;
+	index_t firstSegmentLeftID = kInvalidIndex;
+	index_t firstSegmentRightID = kInvalidIndex;
 	if (!_Closed) {
 		// First segment of an open path
 		const Vec2& p0 = vtx[0];
@@ -1065,12 +1138,12 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 
 			expandIB(stroker, (numPointsHalfCircle - 2) * 3);
 			for (uint32_t i = 0; i < numPointsHalfCircle - 2; ++i) {
-				uint16_t id[3] = { 0, (uint16_t)(i + 1), (uint16_t)(i + 2) };
+				index_t id[3] = { 0, (index_t)(i + 1), (index_t)(i + 2) };
 				addIndices<3>(stroker, &id[0]);
 			}
 
 			prevSegmentLeftID = 0;
-			prevSegmentRightID = (uint16_t)(numPointsHalfCircle - 1);
+			prevSegmentRightID = (index_t)(numPointsHalfCircle - 1);
 		} else {
 			VG_CHECK(false, "Unknown line cap type");
 		}
@@ -1095,7 +1168,7 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 			const Vec2 innerCorner = vec2Add(p1, v_hsw);
 
 			if (_LineJoin == LineJoin::Miter) {
-				const uint16_t firstVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstVertexID = (index_t)stroker->m_NumVertices;
 
 				Vec2 p[2] = {
 					innerCorner,
@@ -1105,12 +1178,12 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 				expandVB(stroker, 2);
 				addPos<2>(stroker, &p[0]);
 
-				if (prevSegmentLeftID != 0xFFFF) {
-					VG_CHECK(prevSegmentRightID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftID != kInvalidIndex) {
+					VG_CHECK(prevSegmentRightID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[6] = {
-						prevSegmentLeftID, prevSegmentRightID, (uint16_t)(firstVertexID + 1),
-						prevSegmentLeftID, (uint16_t)(firstVertexID + 1), firstVertexID
+					index_t id[6] = {
+						prevSegmentLeftID, prevSegmentRightID, (index_t)(firstVertexID + 1),
+						prevSegmentLeftID, (index_t)(firstVertexID + 1), firstVertexID
 					};
 
 					expandIB(stroker, 6);
@@ -1146,7 +1219,7 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 					vec2Add(p1, vec2Scale(r12, hsw))
 				};
 
-				uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 				expandVB(stroker, numArcPoints + 2);
 				addPos<2>(stroker, &p[0]);
 				for (uint32_t iArcPoint = 1; iArcPoint < numArcPoints; ++iArcPoint) {
@@ -1160,12 +1233,12 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 				}
 				addPos<1>(stroker, &p[2]);
 
-				if (prevSegmentLeftID != 0xFFFF) {
-					VG_CHECK(prevSegmentRightID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftID != kInvalidIndex) {
+					VG_CHECK(prevSegmentRightID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[6] = {
-						prevSegmentLeftID, prevSegmentRightID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftID, (uint16_t)(firstFanVertexID + 1), firstFanVertexID
+					index_t id[6] = {
+						prevSegmentLeftID, prevSegmentRightID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftID, (index_t)(firstFanVertexID + 1), firstFanVertexID
 					};
 
 					expandIB(stroker, 6);
@@ -1178,22 +1251,22 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 				// Generate the triangle fan.
 				expandIB(stroker, numArcPoints * 3);
 				for (uint32_t iArcPoint = 0; iArcPoint < numArcPoints; ++iArcPoint) {
-					const uint16_t idBase = firstFanVertexID + (uint16_t)iArcPoint;
-					uint16_t id[3] = {
-						firstFanVertexID, (uint16_t)(idBase + 1), (uint16_t)(idBase + 2)
+					const index_t idBase = firstFanVertexID + (index_t)iArcPoint;
+					index_t id[3] = {
+						firstFanVertexID, (index_t)(idBase + 1), (index_t)(idBase + 2)
 					};
 					addIndices<3>(stroker, &id[0]);
 				}
 
 				prevSegmentLeftID = firstFanVertexID;
-				prevSegmentRightID = firstFanVertexID + (uint16_t)numArcPoints + 1;
+				prevSegmentRightID = firstFanVertexID + (index_t)numArcPoints + 1;
 			}
 		} else {
 			// The right point is the inner corner.
 			const Vec2 innerCorner = vec2Sub(p1, v_hsw);
 
 			if (_LineJoin == LineJoin::Miter) {
-				const uint16_t firstVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstVertexID = (index_t)stroker->m_NumVertices;
 
 				Vec2 p[2] = {
 					innerCorner,
@@ -1203,12 +1276,12 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 				expandVB(stroker, 2);
 				addPos<2>(stroker, &p[0]);
 
-				if (prevSegmentLeftID != 0xFFFF) {
-					VG_CHECK(prevSegmentRightID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftID != kInvalidIndex) {
+					VG_CHECK(prevSegmentRightID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[6] = {
+					index_t id[6] = {
 						prevSegmentLeftID, prevSegmentRightID, firstVertexID,
-						prevSegmentLeftID, firstVertexID, (uint16_t)(firstVertexID + 1)
+						prevSegmentLeftID, firstVertexID, (index_t)(firstVertexID + 1)
 					};
 
 					expandIB(stroker, 6);
@@ -1244,7 +1317,7 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 					vec2Add(p1, vec2Scale(l12, hsw))
 				};
 
-				uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 				expandVB(stroker, numArcPoints + 2);
 				addPos<2>(stroker, &p[0]);
 				for (uint32_t iArcPoint = 1; iArcPoint < numArcPoints; ++iArcPoint) {
@@ -1257,10 +1330,10 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 				}
 				addPos<1>(stroker, &p[2]);
 
-				if (prevSegmentLeftID != 0xFFFF && prevSegmentRightID != 0xFFFF) {
-					uint16_t id[6] = {
+				if (prevSegmentLeftID != kInvalidIndex && prevSegmentRightID != kInvalidIndex) {
+					index_t id[6] = {
 						prevSegmentLeftID, prevSegmentRightID, firstFanVertexID,
-						prevSegmentLeftID, firstFanVertexID, (uint16_t)(firstFanVertexID + 1)
+						prevSegmentLeftID, firstFanVertexID, (index_t)(firstFanVertexID + 1)
 					};
 
 					expandIB(stroker, 6);
@@ -1272,14 +1345,14 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 
 				expandIB(stroker, numArcPoints * 3);
 				for (uint32_t iArcPoint = 0; iArcPoint < numArcPoints; ++iArcPoint) {
-					const uint16_t idBase = firstFanVertexID + (uint16_t)iArcPoint;
-					uint16_t id[3] = {
-						firstFanVertexID, (uint16_t)(idBase + 2), (uint16_t)(idBase + 1)
+					const index_t idBase = firstFanVertexID + (index_t)iArcPoint;
+					index_t id[3] = {
+						firstFanVertexID, (index_t)(idBase + 2), (index_t)(idBase + 1)
 					};
 					addIndices<3>(stroker, &id[0]);
 				}
 
-				prevSegmentLeftID = firstFanVertexID + (uint16_t)numArcPoints + 1;
+				prevSegmentLeftID = firstFanVertexID + (index_t)numArcPoints + 1;
 				prevSegmentRightID = firstFanVertexID;
 			}
 		}
@@ -1294,7 +1367,7 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 		const Vec2 l01 = vec2PerpCCW(d01);
 
 		if (_LineCap == LineCap::Butt) {
-			const uint16_t curSegmentLeftID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftID = (index_t)stroker->m_NumVertices;
 			const Vec2 l01_hsw = vec2Scale(l01, hsw);
 
 			Vec2 p[2] = {
@@ -1305,15 +1378,15 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 			expandVB(stroker, 2);
 			addPos<2>(stroker, &p[0]);
 
-			uint16_t id[6] = {
-				prevSegmentLeftID, prevSegmentRightID, (uint16_t)(curSegmentLeftID + 1),
-				prevSegmentLeftID, (uint16_t)(curSegmentLeftID + 1), curSegmentLeftID
+			index_t id[6] = {
+				prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftID + 1),
+				prevSegmentLeftID, (index_t)(curSegmentLeftID + 1), curSegmentLeftID
 			};
 
 			expandIB(stroker, 6);
 			addIndices<6>(stroker, &id[0]);
 		} else if (_LineCap == LineCap::Square) {
-			const uint16_t curSegmentLeftID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftID = (index_t)stroker->m_NumVertices;
 			const Vec2 l01_hsw = vec2Scale(l01, hsw);
 			const Vec2 d01_hsw = vec2Scale(d01, hsw);
 
@@ -1325,9 +1398,9 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 			expandVB(stroker, 2);
 			addPos<2>(stroker, &p[0]);
 
-			uint16_t id[6] = {
-				prevSegmentLeftID, prevSegmentRightID, (uint16_t)(curSegmentLeftID + 1),
-				prevSegmentLeftID, (uint16_t)(curSegmentLeftID + 1), curSegmentLeftID
+			index_t id[6] = {
+				prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftID + 1),
+				prevSegmentLeftID, (index_t)(curSegmentLeftID + 1), curSegmentLeftID
 			};
 
 			expandIB(stroker, 6);
@@ -1335,7 +1408,7 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 		} else if (_LineCap == LineCap::Round) {
 			expandVB(stroker, numPointsHalfCircle);
 
-			const uint16_t curSegmentLeftID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftID = (index_t)stroker->m_NumVertices;
 			const float startAngle = bx::atan2(l01.y, l01.x);
 			for (uint32_t i = 0; i < numPointsHalfCircle; ++i) {
 				float a = startAngle - i * bx::kPi / (float)(numPointsHalfCircle - 1);
@@ -1347,24 +1420,24 @@ void polylineStroke(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numP
 				addPos<1>(stroker, &p);
 			}
 
-			uint16_t id[6] = {
-				prevSegmentLeftID, prevSegmentRightID, (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1)),
-				prevSegmentLeftID, (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1)), curSegmentLeftID
+			index_t id[6] = {
+				prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1)),
+				prevSegmentLeftID, (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1)), curSegmentLeftID
 			};
 
 			expandIB(stroker, 6 + (numPointsHalfCircle - 2) * 3);
 			addIndices<6>(stroker, &id[0]);
 			for (uint32_t i = 0; i < numPointsHalfCircle - 2; ++i) {
-				const uint16_t idBase = curSegmentLeftID + (uint16_t)i;
-				uint16_t id[3] = {
-					curSegmentLeftID, (uint16_t)(idBase + 2), (uint16_t)(idBase + 1)
+				const index_t idBase = curSegmentLeftID + (index_t)i;
+				index_t id[3] = {
+					curSegmentLeftID, (index_t)(idBase + 2), (index_t)(idBase + 1)
 				};
 				addIndices<3>(stroker, &id[0]);
 			}
 		}
 	} else {
 		// Generate the first segment quad.
-		uint16_t id[6] = {
+		index_t id[6] = {
 			prevSegmentLeftID, prevSegmentRightID, firstSegmentRightID,
 			prevSegmentLeftID, firstSegmentRightID, firstSegmentLeftID
 		};
@@ -1394,14 +1467,14 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 	resetGeometry(stroker);
 
 	Vec2 d01;
-	uint16_t prevSegmentLeftID = 0xFFFF;
-	uint16_t prevSegmentLeftAAID = 0xFFFF;
-	uint16_t prevSegmentRightID = 0xFFFF;
-	uint16_t prevSegmentRightAAID = 0xFFFF;
-	uint16_t firstSegmentLeftID = 0xFFFF;
-	uint16_t firstSegmentLeftAAID = 0xFFFF;
-	uint16_t firstSegmentRightID = 0xFFFF;
-	uint16_t firstSegmentRightAAID = 0xFFFF;
+	index_t prevSegmentLeftID = kInvalidIndex;
+	index_t prevSegmentLeftAAID = kInvalidIndex;
+	index_t prevSegmentRightID = kInvalidIndex;
+	index_t prevSegmentRightAAID = kInvalidIndex;
+	index_t firstSegmentLeftID = kInvalidIndex;
+	index_t firstSegmentLeftAAID = kInvalidIndex;
+	index_t firstSegmentRightID = kInvalidIndex;
+	index_t firstSegmentRightAAID = kInvalidIndex;
 
 	if (!_Closed) {
 		// First segment of an open path
@@ -1427,7 +1500,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			expandVB(stroker, 4);
 			addPosColor<4>(stroker, &p[0], &c0_c_c_c0[0]);
 
-			uint16_t id[6] = {
+			index_t id[6] = {
 				0, 2, 1,
 				0, 3, 2
 			};
@@ -1454,7 +1527,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			expandVB(stroker, 4);
 			addPosColor<4>(stroker, &p[0], &c0_c_c_c0[0]);
 
-			uint16_t id[6] = {
+			index_t id[6] = {
 				0, 2, 1,
 				0, 3, 2
 			};
@@ -1484,28 +1557,28 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			// Generate indices for the triangle fan
 			expandIB(stroker, numPointsHalfCircle * 9 - 12);
 			for (uint32_t i = 0; i < numPointsHalfCircle - 2; ++i) {
-				uint16_t id[3] = {
+				index_t id[3] = {
 					0,
-					(uint16_t)((i << 1) + 2),
-					(uint16_t)((i << 1) + 4)
+					(index_t)((i << 1) + 2),
+					(index_t)((i << 1) + 4)
 				};
 				addIndices<3>(stroker, &id[0]);
 			}
 
 			// Generate indices for the AA quads
 			for (uint32_t i = 0; i < numPointsHalfCircle - 1; ++i) {
-				const uint16_t idBase = (uint16_t)(i << 1);
-				uint16_t id[6] = {
-					idBase, (uint16_t)(idBase + 1), (uint16_t)(idBase + 3),
-					idBase, (uint16_t)(idBase + 3), (uint16_t)(idBase + 2)
+				const index_t idBase = (index_t)(i << 1);
+				index_t id[6] = {
+					idBase, (index_t)(idBase + 1), (index_t)(idBase + 3),
+					idBase, (index_t)(idBase + 3), (index_t)(idBase + 2)
 				};
 				addIndices<6>(stroker, &id[0]);
 			}
 
 			prevSegmentLeftAAID = 1;
 			prevSegmentLeftID = 0;
-			prevSegmentRightID = (uint16_t)((numPointsHalfCircle - 1) * 2);
-			prevSegmentRightAAID = (uint16_t)((numPointsHalfCircle - 1) * 2 + 1);
+			prevSegmentRightID = (index_t)((numPointsHalfCircle - 1) * 2);
+			prevSegmentRightAAID = (index_t)((numPointsHalfCircle - 1) * 2 + 1);
 		} else {
 			VG_CHECK(false, "Unknown line cap type");
 		}
@@ -1532,7 +1605,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			const Vec2 innerCorner = vec2Add(p1, v_hsw);
 
 			if (_LineJoin == LineJoin::Miter) {
-				const uint16_t firstVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstVertexID = (index_t)stroker->m_NumVertices;
 
 				Vec2 p[4] = {
 					innerCornerAA,
@@ -1544,16 +1617,16 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 				expandVB(stroker, 4);
 				addPosColor<4>(stroker, &p[0], &c0_c_c_c0[0]);
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentLeftID != 0xFFFF && prevSegmentRightID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentLeftID != kInvalidIndex && prevSegmentRightID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[18] = {
-						prevSegmentLeftAAID, prevSegmentLeftID, (uint16_t)(firstVertexID + 1),
-						prevSegmentLeftAAID, (uint16_t)(firstVertexID + 1), firstVertexID,
-						prevSegmentLeftID, prevSegmentRightID, (uint16_t)(firstVertexID + 2),
-						prevSegmentLeftID, (uint16_t)(firstVertexID + 2), (uint16_t)(firstVertexID + 1),
-						prevSegmentRightID, prevSegmentRightAAID, (uint16_t)(firstVertexID + 3),
-						prevSegmentRightID, (uint16_t)(firstVertexID + 3), (uint16_t)(firstVertexID + 2)
+					index_t id[18] = {
+						prevSegmentLeftAAID, prevSegmentLeftID, (index_t)(firstVertexID + 1),
+						prevSegmentLeftAAID, (index_t)(firstVertexID + 1), firstVertexID,
+						prevSegmentLeftID, prevSegmentRightID, (index_t)(firstVertexID + 2),
+						prevSegmentLeftID, (index_t)(firstVertexID + 2), (index_t)(firstVertexID + 1),
+						prevSegmentRightID, prevSegmentRightAAID, (index_t)(firstVertexID + 3),
+						prevSegmentRightID, (index_t)(firstVertexID + 3), (index_t)(firstVertexID + 2)
 					};
 
 					expandIB(stroker, 18);
@@ -1588,7 +1661,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 					arcDa = ((a12 - a01) / (float)numArcPoints);
 				}
 
-				const uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 				expandVB(stroker, numArcPoints * 2 + 4);
 
 				Vec2 p[2] = {
@@ -1641,16 +1714,16 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 					addPosColor<2>(stroker, &p[0], &c0_c_c_c0[2]);
 				}
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentLeftID != 0xFFFF && prevSegmentRightID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentLeftID != kInvalidIndex && prevSegmentRightID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[18] = {
-						prevSegmentLeftAAID, prevSegmentLeftID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftAAID, (uint16_t)(firstFanVertexID + 1), firstFanVertexID,
-						prevSegmentLeftID, prevSegmentRightID, (uint16_t)(firstFanVertexID + 2),
-						prevSegmentLeftID, (uint16_t)(firstFanVertexID + 2), (uint16_t)(firstFanVertexID + 1),
-						prevSegmentRightID, prevSegmentRightAAID, (uint16_t)(firstFanVertexID + 3),
-						prevSegmentRightID, (uint16_t)(firstFanVertexID + 3), (uint16_t)(firstFanVertexID + 2)
+					index_t id[18] = {
+						prevSegmentLeftAAID, prevSegmentLeftID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftAAID, (index_t)(firstFanVertexID + 1), firstFanVertexID,
+						prevSegmentLeftID, prevSegmentRightID, (index_t)(firstFanVertexID + 2),
+						prevSegmentLeftID, (index_t)(firstFanVertexID + 2), (index_t)(firstFanVertexID + 1),
+						prevSegmentRightID, prevSegmentRightAAID, (index_t)(firstFanVertexID + 3),
+						prevSegmentRightID, (index_t)(firstFanVertexID + 3), (index_t)(firstFanVertexID + 2)
 					};
 
 					expandIB(stroker, 18);
@@ -1664,13 +1737,13 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 				}
 
 				// Generate the slice.
-				uint16_t arcID = firstFanVertexID + 2;
+				index_t arcID = firstFanVertexID + 2;
 				expandIB(stroker, numArcPoints * 9);
 				for (uint32_t iArcPoint = 0; iArcPoint < numArcPoints; ++iArcPoint) {
-					uint16_t id[9] = {
-						(uint16_t)(firstFanVertexID + 1), arcID, (uint16_t)(arcID + 2),
-						arcID, (uint16_t)(arcID + 1), (uint16_t)(arcID + 3),
-						arcID, (uint16_t)(arcID + 3), (uint16_t)(arcID + 2)
+					index_t id[9] = {
+						(index_t)(firstFanVertexID + 1), arcID, (index_t)(arcID + 2),
+						arcID, (index_t)(arcID + 1), (index_t)(arcID + 3),
+						arcID, (index_t)(arcID + 3), (index_t)(arcID + 2)
 					};
 					addIndices<9>(stroker, &id[0]);
 
@@ -1689,7 +1762,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			const Vec2 innerCorner = vec2Sub(p1, v_hsw);
 
 			if (_LineJoin == LineJoin::Miter) {
-				const uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 
 				Vec2 p[4] = {
 					innerCornerAA,
@@ -1701,16 +1774,16 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 				expandVB(stroker, 4);
 				addPosColor<4>(stroker, &p[0], &c0_c_c_c0[0]);
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentLeftID != 0xFFFF && prevSegmentRightID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentLeftID != kInvalidIndex && prevSegmentRightID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[18] = {
-						prevSegmentLeftAAID, prevSegmentLeftID, (uint16_t)(firstFanVertexID + 2),
-						prevSegmentLeftAAID, (uint16_t)(firstFanVertexID + 2), (uint16_t)(firstFanVertexID + 3),
-						prevSegmentLeftID, prevSegmentRightID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftID, (uint16_t)(firstFanVertexID + 1), (uint16_t)(firstFanVertexID + 2),
+					index_t id[18] = {
+						prevSegmentLeftAAID, prevSegmentLeftID, (index_t)(firstFanVertexID + 2),
+						prevSegmentLeftAAID, (index_t)(firstFanVertexID + 2), (index_t)(firstFanVertexID + 3),
+						prevSegmentLeftID, prevSegmentRightID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftID, (index_t)(firstFanVertexID + 1), (index_t)(firstFanVertexID + 2),
 						prevSegmentRightID, prevSegmentRightAAID, firstFanVertexID,
-						prevSegmentRightID, firstFanVertexID, (uint16_t)(firstFanVertexID + 1)
+						prevSegmentRightID, firstFanVertexID, (index_t)(firstFanVertexID + 1)
 					};
 
 					expandIB(stroker, 18);
@@ -1744,7 +1817,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 					arcDa = ((a12 - a01) / (float)numArcPoints);
 				}
 
-				const uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 				expandVB(stroker, numArcPoints * 2 + 4);
 
 				Vec2 p[2] = {
@@ -1797,16 +1870,16 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 					addPosColor<2>(stroker, &p[0], &c0_c_c_c0[2]);
 				}
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentLeftID != 0xFFFF && prevSegmentRightID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentLeftID != kInvalidIndex && prevSegmentRightID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[18] = {
-						prevSegmentLeftAAID, prevSegmentLeftID, (uint16_t)(firstFanVertexID + 2),
-						prevSegmentLeftAAID, (uint16_t)(firstFanVertexID + 2), (uint16_t)(firstFanVertexID + 3),
-						prevSegmentLeftID, prevSegmentRightID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftID, (uint16_t)(firstFanVertexID + 1), (uint16_t)(firstFanVertexID + 2),
+					index_t id[18] = {
+						prevSegmentLeftAAID, prevSegmentLeftID, (index_t)(firstFanVertexID + 2),
+						prevSegmentLeftAAID, (index_t)(firstFanVertexID + 2), (index_t)(firstFanVertexID + 3),
+						prevSegmentLeftID, prevSegmentRightID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftID, (index_t)(firstFanVertexID + 1), (index_t)(firstFanVertexID + 2),
 						prevSegmentRightID, prevSegmentRightAAID, firstFanVertexID,
-						prevSegmentRightID, firstFanVertexID, (uint16_t)(firstFanVertexID + 1)
+						prevSegmentRightID, firstFanVertexID, (index_t)(firstFanVertexID + 1)
 					};
 
 					expandIB(stroker, 18);
@@ -1819,13 +1892,13 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 				}
 
 				// Generate the slice.
-				uint16_t arcID = firstFanVertexID + 2;
+				index_t arcID = firstFanVertexID + 2;
 				expandIB(stroker, numArcPoints * 9);
 				for (uint32_t iArcPoint = 0; iArcPoint < numArcPoints; ++iArcPoint) {
-					uint16_t id[9] = {
-						(uint16_t)(firstFanVertexID + 1), (uint16_t)(arcID + 2), arcID,
-						arcID, (uint16_t)(arcID + 3), (uint16_t)(arcID + 1),
-						arcID, (uint16_t)(arcID + 2), (uint16_t)(arcID + 3)
+					index_t id[9] = {
+						(index_t)(firstFanVertexID + 1), (index_t)(arcID + 2), arcID,
+						arcID, (index_t)(arcID + 3), (index_t)(arcID + 1),
+						arcID, (index_t)(arcID + 2), (index_t)(arcID + 3)
 					};
 					addIndices<9>(stroker, &id[0]);
 
@@ -1849,7 +1922,7 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 		const Vec2 l01 = vec2PerpCCW(d01);
 
 		if (_LineCap == LineCap::Butt) {
-			const uint16_t curSegmentLeftAAID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftAAID = (index_t)stroker->m_NumVertices;
 			const Vec2 l01_hsw = vec2Scale(l01, hsw);
 			const Vec2 l01_hsw_aa = vec2Scale(l01, hsw_aa);
 			const Vec2 d01_aa = vec2Scale(d01, stroker->m_FringeWidth);
@@ -1864,21 +1937,21 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			expandVB(stroker, 4);
 			addPosColor<4>(stroker, &p[0], &c0_c_c_c0[0]);
 
-			uint16_t id[24] = {
-				prevSegmentLeftAAID, prevSegmentLeftID, (uint16_t)(curSegmentLeftAAID + 1),
-				prevSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
-				prevSegmentLeftID, prevSegmentRightID, (uint16_t)(curSegmentLeftAAID + 2),
-				prevSegmentLeftID, (uint16_t)(curSegmentLeftAAID + 2), (uint16_t)(curSegmentLeftAAID + 1),
-				prevSegmentRightID, prevSegmentRightAAID, (uint16_t)(curSegmentLeftAAID + 3),
-				prevSegmentRightID, (uint16_t)(curSegmentLeftAAID + 3), (uint16_t)(curSegmentLeftAAID + 2),
-				curSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 1), (uint16_t)(curSegmentLeftAAID + 2),
-				curSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 2), (uint16_t)(curSegmentLeftAAID + 3)
+			index_t id[24] = {
+				prevSegmentLeftAAID, prevSegmentLeftID, (index_t)(curSegmentLeftAAID + 1),
+				prevSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
+				prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftAAID + 2),
+				prevSegmentLeftID, (index_t)(curSegmentLeftAAID + 2), (index_t)(curSegmentLeftAAID + 1),
+				prevSegmentRightID, prevSegmentRightAAID, (index_t)(curSegmentLeftAAID + 3),
+				prevSegmentRightID, (index_t)(curSegmentLeftAAID + 3), (index_t)(curSegmentLeftAAID + 2),
+				curSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 1), (index_t)(curSegmentLeftAAID + 2),
+				curSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 2), (index_t)(curSegmentLeftAAID + 3)
 			};
 
 			expandIB(stroker, 24);
 			addIndices<24>(stroker, &id[0]);
 		} else if (_LineCap == LineCap::Square) {
-			const uint16_t curSegmentLeftAAID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftAAID = (index_t)stroker->m_NumVertices;
 			const Vec2 l01_hsw = vec2Scale(l01, hsw);
 			const Vec2 d01_hsw = vec2Scale(d01, hsw);
 			const Vec2 l01_hsw_aa = vec2Scale(l01, hsw_aa);
@@ -1894,21 +1967,21 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			expandVB(stroker, 4);
 			addPosColor<4>(stroker, &p[0], &c0_c_c_c0[0]);
 
-			uint16_t id[24] = {
-				prevSegmentLeftAAID, prevSegmentLeftID, (uint16_t)(curSegmentLeftAAID + 1),
-				prevSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
-				prevSegmentLeftID, prevSegmentRightID, (uint16_t)(curSegmentLeftAAID + 2),
-				prevSegmentLeftID, (uint16_t)(curSegmentLeftAAID + 2), (uint16_t)(curSegmentLeftAAID + 1),
-				prevSegmentRightID, prevSegmentRightAAID, (uint16_t)(curSegmentLeftAAID + 3),
-				prevSegmentRightID, (uint16_t)(curSegmentLeftAAID + 3), (uint16_t)(curSegmentLeftAAID + 2),
-				curSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 1), (uint16_t)(curSegmentLeftAAID + 2),
-				curSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 2), (uint16_t)(curSegmentLeftAAID + 3)
+			index_t id[24] = {
+				prevSegmentLeftAAID, prevSegmentLeftID, (index_t)(curSegmentLeftAAID + 1),
+				prevSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
+				prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftAAID + 2),
+				prevSegmentLeftID, (index_t)(curSegmentLeftAAID + 2), (index_t)(curSegmentLeftAAID + 1),
+				prevSegmentRightID, prevSegmentRightAAID, (index_t)(curSegmentLeftAAID + 3),
+				prevSegmentRightID, (index_t)(curSegmentLeftAAID + 3), (index_t)(curSegmentLeftAAID + 2),
+				curSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 1), (index_t)(curSegmentLeftAAID + 2),
+				curSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 2), (index_t)(curSegmentLeftAAID + 3)
 			};
 
 			expandIB(stroker, 24);
 			addIndices<24>(stroker, &id[0]);
 		} else if (_LineCap == LineCap::Round) {
-			const uint16_t curSegmentLeftID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftID = (index_t)stroker->m_NumVertices;
 			const float startAngle = bx::atan2(l01.y, l01.x);
 
 			expandVB(stroker, numPointsHalfCircle * 2);
@@ -1925,13 +1998,13 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 				addPosColor<2>(stroker, &p[0], &c0_c_c_c0[2]);
 			}
 
-			uint16_t id[18] = {
+			index_t id[18] = {
 				prevSegmentLeftAAID, prevSegmentLeftID, curSegmentLeftID,
-				prevSegmentLeftAAID, curSegmentLeftID, (uint16_t)(curSegmentLeftID + 1),
-				prevSegmentLeftID, prevSegmentRightID, (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2),
-				prevSegmentLeftID, (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2), curSegmentLeftID,
-				prevSegmentRightID, prevSegmentRightAAID, (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2 + 1),
-				prevSegmentRightID, (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2 + 1), (uint16_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2)
+				prevSegmentLeftAAID, curSegmentLeftID, (index_t)(curSegmentLeftID + 1),
+				prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2),
+				prevSegmentLeftID, (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2), curSegmentLeftID,
+				prevSegmentRightID, prevSegmentRightAAID, (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2 + 1),
+				prevSegmentRightID, (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2 + 1), (index_t)(curSegmentLeftID + (numPointsHalfCircle - 1) * 2)
 			};
 
 			expandIB(stroker, 18);
@@ -1940,11 +2013,11 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			// Generate indices for the triangle fan
 			expandIB(stroker, (numPointsHalfCircle - 2) * 3);
 			for (uint32_t i = 0; i < numPointsHalfCircle - 2; ++i) {
-				const uint16_t idBase = curSegmentLeftID + (uint16_t)(i << 1);
-				uint16_t id[3] = {
+				const index_t idBase = curSegmentLeftID + (index_t)(i << 1);
+				index_t id[3] = {
 					curSegmentLeftID,
-					(uint16_t)(idBase + 4),
-					(uint16_t)(idBase + 2)
+					(index_t)(idBase + 4),
+					(index_t)(idBase + 2)
 				};
 				addIndices<3>(stroker, &id[0]);
 			}
@@ -1952,18 +2025,18 @@ void polylineStrokeAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t nu
 			// Generate indices for the AA quads
 			expandIB(stroker, (numPointsHalfCircle - 1) * 6);
 			for (uint32_t i = 0; i < numPointsHalfCircle - 1; ++i) {
-				const uint16_t idBase = curSegmentLeftID + (uint16_t)(i << 1);
-				uint16_t id[6] = {
-					idBase, (uint16_t)(idBase + 3), (uint16_t)(idBase + 1),
-					idBase, (uint16_t)(idBase + 2), (uint16_t)(idBase + 3)
+				const index_t idBase = curSegmentLeftID + (index_t)(i << 1);
+				index_t id[6] = {
+					idBase, (index_t)(idBase + 3), (index_t)(idBase + 1),
+					idBase, (index_t)(idBase + 2), (index_t)(idBase + 3)
 				};
 				addIndices<6>(stroker, &id[0]);
 			}
 		}
 	} else {
-		VG_CHECK(firstSegmentLeftAAID != 0xFFFF && firstSegmentLeftID != 0xFFFF && firstSegmentRightID != 0xFFFF && firstSegmentRightAAID != 0xFFFF, "Invalid first segment");
+		VG_CHECK(firstSegmentLeftAAID != kInvalidIndex && firstSegmentLeftID != kInvalidIndex && firstSegmentRightID != kInvalidIndex && firstSegmentRightAAID != kInvalidIndex, "Invalid first segment");
 
-		uint16_t id[18] = {
+		index_t id[18] = {
 			prevSegmentLeftAAID, prevSegmentLeftID, firstSegmentLeftID,
 			prevSegmentLeftAAID, firstSegmentLeftID, firstSegmentLeftAAID,
 			prevSegmentLeftID, prevSegmentRightID, firstSegmentRightID,
@@ -1994,13 +2067,13 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 	resetGeometry(stroker);
 
 	Vec2 d01;
-	uint16_t prevSegmentLeftAAID = 0xFFFF;
-	uint16_t prevSegmentMiddleID = 0xFFFF;
-	uint16_t prevSegmentRightAAID = 0xFFFF;
+	index_t prevSegmentLeftAAID = kInvalidIndex;
+	index_t prevSegmentMiddleID = kInvalidIndex;
+	index_t prevSegmentRightAAID = kInvalidIndex;
 
-	uint16_t firstSegmentLeftAAID = 0xFFFF;
-	uint16_t firstSegmentMiddleID = 0xFFFF;
-	uint16_t firstSegmentRightAAID = 0xFFFF;
+	index_t firstSegmentLeftAAID = kInvalidIndex;
+	index_t firstSegmentMiddleID = kInvalidIndex;
+	index_t firstSegmentRightAAID = kInvalidIndex;
 
 	if (!closed) {
 		// First segment of an open path
@@ -2068,7 +2141,7 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 			const Vec2 innerCorner = vec2Add(p1, v_hsw_aa);
 
 			if (_LineJoin == LineJoin::Miter) {
-				const uint16_t firstVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstVertexID = (index_t)stroker->m_NumVertices;
 
 				Vec2 p[3] = {
 					innerCorner,
@@ -2079,14 +2152,14 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 				expandVB(stroker, 3);
 				addPosColor<3>(stroker, &p[0], &c0_c_c0_c0[0]);
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentMiddleID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentMiddleID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[12] = {
-						prevSegmentLeftAAID, prevSegmentMiddleID, (uint16_t)(firstVertexID + 1),
-						prevSegmentLeftAAID, (uint16_t)(firstVertexID + 1), firstVertexID,
-						prevSegmentMiddleID, prevSegmentRightAAID, (uint16_t)(firstVertexID + 2),
-						prevSegmentMiddleID, (uint16_t)(firstVertexID + 2), (uint16_t)(firstVertexID + 1)
+					index_t id[12] = {
+						prevSegmentLeftAAID, prevSegmentMiddleID, (index_t)(firstVertexID + 1),
+						prevSegmentLeftAAID, (index_t)(firstVertexID + 1), firstVertexID,
+						prevSegmentMiddleID, prevSegmentRightAAID, (index_t)(firstVertexID + 2),
+						prevSegmentMiddleID, (index_t)(firstVertexID + 2), (index_t)(firstVertexID + 1)
 					};
 
 					expandIB(stroker, 12);
@@ -2113,18 +2186,18 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 					vec2Add(p1, vec2Scale(r12, hsw_aa))
 				};
 
-				const uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 				expandVB(stroker, 4);
 				addPosColor<4>(stroker, &p[0], &c0_c_c0_c0[0]);
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentMiddleID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentMiddleID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[12] = {
-						prevSegmentLeftAAID, prevSegmentMiddleID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftAAID, (uint16_t)(firstFanVertexID + 1), firstFanVertexID,
-						prevSegmentMiddleID, prevSegmentRightAAID, (uint16_t)(firstFanVertexID + 2),
-						prevSegmentMiddleID, (uint16_t)(firstFanVertexID + 2), (uint16_t)(firstFanVertexID + 1)
+					index_t id[12] = {
+						prevSegmentLeftAAID, prevSegmentMiddleID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftAAID, (index_t)(firstFanVertexID + 1), firstFanVertexID,
+						prevSegmentMiddleID, prevSegmentRightAAID, (index_t)(firstFanVertexID + 2),
+						prevSegmentMiddleID, (index_t)(firstFanVertexID + 2), (index_t)(firstFanVertexID + 1)
 					};
 
 					expandIB(stroker, 12);
@@ -2136,8 +2209,8 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 					firstSegmentRightAAID = firstFanVertexID + 2;
 				}
 
-				uint16_t id[3] = {
-					(uint16_t)(firstFanVertexID + 1), (uint16_t)(firstFanVertexID + 2), (uint16_t)(firstFanVertexID + 3)
+				index_t id[3] = {
+					(index_t)(firstFanVertexID + 1), (index_t)(firstFanVertexID + 2), (index_t)(firstFanVertexID + 3)
 				};
 				expandIB(stroker, 3);
 				addIndices<3>(stroker, id);
@@ -2151,7 +2224,7 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 			const Vec2 innerCorner = vec2Sub(p1, v_hsw_aa);
 
 			if (_LineJoin == LineJoin::Miter) {
-				const uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 
 				Vec2 p[3] = {
 					innerCorner,
@@ -2162,14 +2235,14 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 				expandVB(stroker, 3);
 				addPosColor<3>(stroker, &p[0], &c0_c_c0_c0[0]);
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentMiddleID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentMiddleID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[12] = {
-						prevSegmentLeftAAID, prevSegmentMiddleID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftAAID, (uint16_t)(firstFanVertexID + 1), (uint16_t)(firstFanVertexID + 2),
+					index_t id[12] = {
+						prevSegmentLeftAAID, prevSegmentMiddleID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftAAID, (index_t)(firstFanVertexID + 1), (index_t)(firstFanVertexID + 2),
 						prevSegmentMiddleID, prevSegmentRightAAID, firstFanVertexID,
-						prevSegmentMiddleID, firstFanVertexID, (uint16_t)(firstFanVertexID + 1)
+						prevSegmentMiddleID, firstFanVertexID, (index_t)(firstFanVertexID + 1)
 					};
 
 					expandIB(stroker, 12);
@@ -2194,18 +2267,18 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 					vec2Add(p1, vec2Scale(l12, hsw_aa))
 				};
 
-				const uint16_t firstFanVertexID = (uint16_t)stroker->m_NumVertices;
+				const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
 				expandVB(stroker, 4);
 				addPosColor<4>(stroker, &p[0], &c0_c_c0_c0[0]);
 
-				if (prevSegmentLeftAAID != 0xFFFF) {
-					VG_CHECK(prevSegmentMiddleID != 0xFFFF && prevSegmentRightAAID != 0xFFFF, "Invalid previous segment");
+				if (prevSegmentLeftAAID != kInvalidIndex) {
+					VG_CHECK(prevSegmentMiddleID != kInvalidIndex && prevSegmentRightAAID != kInvalidIndex, "Invalid previous segment");
 
-					uint16_t id[12] = {
-						prevSegmentLeftAAID, prevSegmentMiddleID, (uint16_t)(firstFanVertexID + 1),
-						prevSegmentLeftAAID, (uint16_t)(firstFanVertexID + 1), (uint16_t)(firstFanVertexID + 2),
+					index_t id[12] = {
+						prevSegmentLeftAAID, prevSegmentMiddleID, (index_t)(firstFanVertexID + 1),
+						prevSegmentLeftAAID, (index_t)(firstFanVertexID + 1), (index_t)(firstFanVertexID + 2),
 						prevSegmentMiddleID, prevSegmentRightAAID, firstFanVertexID,
-						prevSegmentMiddleID, firstFanVertexID, (uint16_t)(firstFanVertexID + 1)
+						prevSegmentMiddleID, firstFanVertexID, (index_t)(firstFanVertexID + 1)
 					};
 
 					expandIB(stroker, 12);
@@ -2216,8 +2289,8 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 					firstSegmentRightAAID = firstFanVertexID + 0;
 				}
 
-				uint16_t id[3] = {
-					(uint16_t)(firstFanVertexID + 1), (uint16_t)(firstFanVertexID + 3), (uint16_t)(firstFanVertexID + 2)
+				index_t id[3] = {
+					(index_t)(firstFanVertexID + 1), (index_t)(firstFanVertexID + 3), (index_t)(firstFanVertexID + 2)
 				};
 				expandIB(stroker, 3);
 				addIndices<3>(stroker, id);
@@ -2238,7 +2311,7 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 		const Vec2 l01 = vec2PerpCCW(d01);
 
 		if (_LineCap == LineCap::Butt) {
-			const uint16_t curSegmentLeftAAID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftAAID = (index_t)stroker->m_NumVertices;
 			const Vec2 l01_hsw_aa = vec2Scale(l01, hsw_aa);
 
 			Vec2 p[3] = {
@@ -2250,17 +2323,17 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 			expandVB(stroker, 3);
 			addPosColor<3>(stroker, &p[0], &c0_c_c0_c0[0]);
 
-			uint16_t id[12] = {
-				prevSegmentLeftAAID, prevSegmentMiddleID, (uint16_t)(curSegmentLeftAAID + 1),
-				prevSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
-				prevSegmentMiddleID, prevSegmentRightAAID, (uint16_t)(curSegmentLeftAAID + 2),
-				prevSegmentMiddleID, (uint16_t)(curSegmentLeftAAID + 2), (uint16_t)(curSegmentLeftAAID + 1)
+			index_t id[12] = {
+				prevSegmentLeftAAID, prevSegmentMiddleID, (index_t)(curSegmentLeftAAID + 1),
+				prevSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
+				prevSegmentMiddleID, prevSegmentRightAAID, (index_t)(curSegmentLeftAAID + 2),
+				prevSegmentMiddleID, (index_t)(curSegmentLeftAAID + 2), (index_t)(curSegmentLeftAAID + 1)
 			};
 
 			expandIB(stroker, 12);
 			addIndices<12>(stroker, id);
 		} else if (_LineCap == LineCap::Square) {
-			const uint16_t curSegmentLeftAAID = (uint16_t)stroker->m_NumVertices;
+			const index_t curSegmentLeftAAID = (index_t)stroker->m_NumVertices;
 			const Vec2 d01_hsw = vec2Scale(d01, hsw_aa);
 			const Vec2 l01_hsw_aa = vec2Scale(l01, hsw_aa);
 
@@ -2273,11 +2346,11 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 			expandVB(stroker, 3);
 			addPosColor<3>(stroker, &p[0], &c0_c_c0_c0[0]);
 
-			uint16_t id[12] = {
-				prevSegmentLeftAAID, prevSegmentMiddleID, (uint16_t)(curSegmentLeftAAID + 1),
-				prevSegmentLeftAAID, (uint16_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
-				prevSegmentMiddleID, prevSegmentRightAAID, (uint16_t)(curSegmentLeftAAID + 2),
-				prevSegmentMiddleID, (uint16_t)(curSegmentLeftAAID + 2), (uint16_t)(curSegmentLeftAAID + 1)
+			index_t id[12] = {
+				prevSegmentLeftAAID, prevSegmentMiddleID, (index_t)(curSegmentLeftAAID + 1),
+				prevSegmentLeftAAID, (index_t)(curSegmentLeftAAID + 1), curSegmentLeftAAID,
+				prevSegmentMiddleID, prevSegmentRightAAID, (index_t)(curSegmentLeftAAID + 2),
+				prevSegmentMiddleID, (index_t)(curSegmentLeftAAID + 2), (index_t)(curSegmentLeftAAID + 1)
 			};
 
 			expandIB(stroker, 12);
@@ -2286,9 +2359,9 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 			VG_CHECK(false, "Round caps not implemented for thin strokes.");
 		}
 	} else {
-		VG_CHECK(firstSegmentLeftAAID != 0xFFFF && firstSegmentMiddleID != 0xFFFF && firstSegmentRightAAID != 0xFFFF, "Invalid first segment");
+		VG_CHECK(firstSegmentLeftAAID != kInvalidIndex && firstSegmentMiddleID != kInvalidIndex && firstSegmentRightAAID != kInvalidIndex, "Invalid first segment");
 
-		uint16_t id[12] = {
+		index_t id[12] = {
 			prevSegmentLeftAAID, prevSegmentMiddleID, firstSegmentMiddleID,
 			prevSegmentLeftAAID, firstSegmentMiddleID, firstSegmentLeftAAID,
 			prevSegmentMiddleID, prevSegmentRightAAID, firstSegmentRightAAID,
@@ -2306,6 +2379,332 @@ void polylineStrokeAAThin(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_
 	mesh->m_NumIndices = stroker->m_NumIndices;
 }
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+void polylineStrokeAnalyticAA(Stroker* stroker, Mesh* mesh, const Vec2* vtx, uint32_t numPathVertices, bool closed, float strokeWidth, LineCap::Enum lineCap, LineJoin::Enum lineJoin)
+{
+	const uint32_t numSegments = numPathVertices - (closed ? 0 : 1);
+	const float fringeWidth = stroker->m_FringeWidth;
+	const float hsw = strokeWidth * 0.5f;
+	const float hsw_aa = hsw + fringeWidth * 0.5f;
+	const float da = bx::acos((stroker->m_Scale * hsw_aa) / ((stroker->m_Scale * hsw_aa) + stroker->m_TesselationTolerance)) * 2.0f;
+	const uint32_t numPointsHalfCircle = bx::uint32_max(2u, (uint32_t)bx::ceil(bx::kPi / da));
+
+	// (distance from left edge, distance from right edge)
+	const float uvEdge = 0.0f;
+	const float uvMid = hsw_aa / fringeWidth;
+	const float uvFar = 2.0f * hsw_aa / fringeWidth;
+	const Vec2 uvLeft = { uvEdge, uvFar };
+	const Vec2 uvRight = { uvFar, uvEdge };
+	const Vec2 uvLeftRight[2] = { uvLeft, uvRight };
+	const Vec2 uvRoundCapCenter = { uvMid, uvFar };
+	const Vec2 uvRoundCapEdge = { uvEdge, uvFar };
+
+	resetGeometry(stroker);
+
+	Vec2 d01;
+	index_t prevSegmentLeftID = kInvalidIndex;
+	index_t prevSegmentRightID = kInvalidIndex;
+	index_t firstSegmentLeftID = kInvalidIndex;
+	index_t firstSegmentRightID = kInvalidIndex;
+	if (!closed) {
+		// First segment of an open path
+		const Vec2& p0 = vtx[0];
+		const Vec2& p1 = vtx[1];
+
+		d01 = vec2Dir(p0, p1);
+
+		const Vec2 l01 = vec2PerpCCW(d01);
+		const Vec2 l01_hsw = vec2Scale(l01, hsw_aa);
+
+		Vec2 bodyStart = p0;
+		if (lineCap == LineCap::Butt || lineCap == LineCap::Square) {
+			const float capOffset = (lineCap == LineCap::Square ? hsw : 0.0f) + fringeWidth * 0.5f;
+			const Vec2 e = vec2Sub(p0, vec2Scale(d01, capOffset));
+
+			addAnalyticAACapStrip(stroker, e, d01, l01, hsw_aa);
+
+			bodyStart = vec2Add(e, vec2Scale(d01, fringeWidth));
+		} else if (lineCap == LineCap::Round) {
+			const index_t centerID = (index_t)stroker->m_NumVertices;
+
+			expandVB(stroker, numPointsHalfCircle + 1);
+			addPosUV<1>(stroker, &p0, &uvRoundCapCenter);
+
+			const float startAngle = bx::atan2(l01.y, l01.x);
+			for (uint32_t i = 0; i < numPointsHalfCircle; ++i) {
+				float a = startAngle + i * bx::kPi / (float)(numPointsHalfCircle - 1);
+				float ca = bx::cos(a);
+				float sa = bx::sin(a);
+
+				Vec2 p = { p0.x + ca * hsw_aa, p0.y + sa * hsw_aa };
+
+				addPosUV<1>(stroker, &p, &uvRoundCapEdge);
+			}
+
+			expandIB(stroker, (numPointsHalfCircle - 1) * 3);
+			for (uint32_t i = 0; i < numPointsHalfCircle - 1; ++i) {
+				index_t id[3] = { centerID, (index_t)(centerID + i + 1), (index_t)(centerID + i + 2) };
+				addIndices<3>(stroker, &id[0]);
+			}
+		} else {
+			VG_CHECK(false, "Unknown line cap type");
+		}
+
+		Vec2 p[2] = {
+			vec2Add(bodyStart, l01_hsw),
+			vec2Sub(bodyStart, l01_hsw)
+		};
+
+		prevSegmentLeftID = (index_t)stroker->m_NumVertices;
+		prevSegmentRightID = prevSegmentLeftID + 1;
+
+		expandVB(stroker, 2);
+		addPosUV<2>(stroker, &p[0], &uvLeftRight[0]);
+	} else {
+		d01 = vec2Dir(vtx[numPathVertices - 1], vtx[0]);
+	}
+
+	const uint32_t firstSegmentID = closed ? 0 : 1;
+	for (uint32_t iSegment = firstSegmentID; iSegment < numSegments; ++iSegment) {
+		const Vec2& p1 = vtx[iSegment];
+		const Vec2& p2 = vtx[iSegment == numPathVertices - 1 ? 0 : iSegment + 1];
+
+		const Vec2 d12 = vec2Dir(p1, p2);
+
+		const Vec2 v = calcExtrusionVector(d01, d12);
+		const Vec2 v_hsw = vec2Scale(v, hsw_aa);
+
+		// Check which one of the points is the inner corner.
+		const bool leftIsInner = (d12.x * v_hsw.x + d12.y * v_hsw.y) >= 0.0f;
+
+		// Vertices on the inner side keep the UV of their side. Outer vertices (the whole join) get
+		// the UV of the other side.
+		const Vec2& uvInner = leftIsInner ? uvLeft : uvRight;
+		const Vec2& uvOuter = leftIsInner ? uvRight : uvLeft;
+		const Vec2 innerCorner = leftIsInner ? vec2Add(p1, v_hsw) : vec2Sub(p1, v_hsw);
+
+		if (lineJoin == LineJoin::Miter) {
+			const index_t firstVertexID = (index_t)stroker->m_NumVertices;
+
+			Vec2 p[2] = {
+				innerCorner,
+				leftIsInner ? vec2Sub(p1, v_hsw) : vec2Add(p1, v_hsw)
+			};
+			Vec2 uv[2] = { uvInner, uvOuter };
+
+			expandVB(stroker, 2);
+			addPosUV<2>(stroker, &p[0], &uv[0]);
+
+			const index_t leftID = leftIsInner ? firstVertexID : (index_t)(firstVertexID + 1);
+			const index_t rightID = leftIsInner ? (index_t)(firstVertexID + 1) : firstVertexID;
+			if (prevSegmentLeftID != kInvalidIndex) {
+				VG_CHECK(prevSegmentRightID != kInvalidIndex, "Invalid previous segment");
+
+				index_t id[6] = {
+					prevSegmentLeftID, prevSegmentRightID, rightID,
+					prevSegmentLeftID, rightID, leftID
+				};
+
+				expandIB(stroker, 6);
+				addIndices<6>(stroker, &id[0]);
+			} else {
+				firstSegmentLeftID = leftID;
+				firstSegmentRightID = rightID;
+			}
+
+			prevSegmentLeftID = leftID;
+			prevSegmentRightID = rightID;
+		} else {
+			// The outer side of the join is on the right of the path if the left point is the inner corner.
+			const Vec2 n01 = leftIsInner ? vec2PerpCW(d01) : vec2PerpCCW(d01);
+			const Vec2 n12 = leftIsInner ? vec2PerpCW(d12) : vec2PerpCCW(d12);
+
+			// Assume lineJoin == LineJoin::Bevel
+			float a01 = 0.0f, a12 = 0.0f, arcDa = 0.0f;
+			uint32_t numArcPoints = 1;
+			if (lineJoin == LineJoin::Round) {
+				a01 = bx::atan2(n01.y, n01.x);
+				a12 = bx::atan2(n12.y, n12.x);
+				if (leftIsInner && a12 < a01) {
+					a12 += bx::kPi2;
+				} else if (!leftIsInner && a12 > a01) {
+					a12 -= bx::kPi2;
+				}
+
+				numArcPoints = bx::uint32_max(2u, (uint32_t)(bx::abs(a12 - a01) / da));
+				arcDa = ((a12 - a01) / (float)numArcPoints);
+			}
+
+			Vec2 p[3] = {
+				innerCorner,
+				vec2Add(p1, vec2Scale(n01, hsw_aa)),
+				vec2Add(p1, vec2Scale(n12, hsw_aa))
+			};
+
+			const index_t firstFanVertexID = (index_t)stroker->m_NumVertices;
+			expandVB(stroker, numArcPoints + 2);
+			addPosUV<1>(stroker, &p[0], &uvInner);
+			addPosUV<1>(stroker, &p[1], &uvOuter);
+			for (uint32_t iArcPoint = 1; iArcPoint < numArcPoints; ++iArcPoint) {
+				float a = a01 + iArcPoint * arcDa;
+				float ca = bx::cos(a);
+				float sa = bx::sin(a);
+
+				Vec2 p = { p1.x + hsw_aa * ca, p1.y + hsw_aa * sa };
+
+				addPosUV<1>(stroker, &p, &uvOuter);
+			}
+			addPosUV<1>(stroker, &p[2], &uvOuter);
+
+			const index_t innerID = firstFanVertexID;
+			const index_t outerStartID = firstFanVertexID + 1;
+			const index_t outerEndID = firstFanVertexID + (index_t)numArcPoints + 1;
+			if (prevSegmentLeftID != kInvalidIndex) {
+				VG_CHECK(prevSegmentRightID != kInvalidIndex, "Invalid previous segment");
+
+				const index_t leftID = leftIsInner ? innerID : outerStartID;
+				const index_t rightID = leftIsInner ? outerStartID : innerID;
+				index_t id[6] = {
+					prevSegmentLeftID, prevSegmentRightID, rightID,
+					prevSegmentLeftID, rightID, leftID
+				};
+
+				expandIB(stroker, 6);
+				addIndices<6>(stroker, &id[0]);
+			} else {
+				firstSegmentLeftID = leftIsInner ? innerID : outerStartID;
+				firstSegmentRightID = leftIsInner ? outerStartID : innerID;
+			}
+
+			// Generate the triangle fan.
+			expandIB(stroker, numArcPoints * 3);
+			for (uint32_t iArcPoint = 0; iArcPoint < numArcPoints; ++iArcPoint) {
+				const index_t idBase = outerStartID + (index_t)iArcPoint;
+				index_t id[3] = {
+					innerID, idBase, (index_t)(idBase + 1)
+				};
+				addIndices<3>(stroker, &id[0]);
+			}
+
+			prevSegmentLeftID = leftIsInner ? innerID : outerEndID;
+			prevSegmentRightID = leftIsInner ? outerEndID : innerID;
+		}
+
+		d01 = d12;
+	}
+
+	if (!closed) {
+		// Last segment of an open path
+		const Vec2& p1 = vtx[numPathVertices - 1];
+
+		const Vec2 l01 = vec2PerpCCW(d01);
+		const Vec2 l01_hsw = vec2Scale(l01, hsw_aa);
+
+		const bool isRoundCap = lineCap == LineCap::Round;
+		const float capOffset = isRoundCap ? 0.0f : ((lineCap == LineCap::Square ? hsw : 0.0f) + fringeWidth * 0.5f);
+		const Vec2 e = vec2Add(p1, vec2Scale(d01, capOffset));
+		const Vec2 bodyEnd = isRoundCap ? p1 : vec2Sub(e, vec2Scale(d01, fringeWidth));
+
+		const index_t curSegmentLeftID = (index_t)stroker->m_NumVertices;
+
+		Vec2 p[2] = {
+			vec2Add(bodyEnd, l01_hsw),
+			vec2Sub(bodyEnd, l01_hsw)
+		};
+
+		expandVB(stroker, 2);
+		addPosUV<2>(stroker, &p[0], &uvLeftRight[0]);
+
+		index_t id[6] = {
+			prevSegmentLeftID, prevSegmentRightID, (index_t)(curSegmentLeftID + 1),
+			prevSegmentLeftID, (index_t)(curSegmentLeftID + 1), curSegmentLeftID
+		};
+
+		expandIB(stroker, 6);
+		addIndices<6>(stroker, &id[0]);
+
+		if (isRoundCap) {
+			const index_t centerID = (index_t)stroker->m_NumVertices;
+
+			expandVB(stroker, numPointsHalfCircle + 1);
+			addPosUV<1>(stroker, &p1, &uvRoundCapCenter);
+
+			const float startAngle = bx::atan2(l01.y, l01.x);
+			for (uint32_t i = 0; i < numPointsHalfCircle; ++i) {
+				float a = startAngle - i * bx::kPi / (float)(numPointsHalfCircle - 1);
+				float ca = bx::cos(a);
+				float sa = bx::sin(a);
+
+				Vec2 p = { p1.x + ca * hsw_aa, p1.y + sa * hsw_aa };
+
+				addPosUV<1>(stroker, &p, &uvRoundCapEdge);
+			}
+
+			expandIB(stroker, (numPointsHalfCircle - 1) * 3);
+			for (uint32_t i = 0; i < numPointsHalfCircle - 1; ++i) {
+				index_t id[3] = { centerID, (index_t)(centerID + i + 1), (index_t)(centerID + i + 2) };
+				addIndices<3>(stroker, &id[0]);
+			}
+		} else {
+			addAnalyticAACapStrip(stroker, e, vec2Scale(d01, -1.0f), l01, hsw_aa);
+		}
+	} else {
+		// Generate the first segment quad.
+		index_t id[6] = {
+			prevSegmentLeftID, prevSegmentRightID, firstSegmentRightID,
+			prevSegmentLeftID, firstSegmentRightID, firstSegmentLeftID
+		};
+
+		expandIB(stroker, 6);
+		addIndices<6>(stroker, &id[0]);
+	}
+
+	mesh->m_PosBuffer = &stroker->m_PosBuffer[0].x;
+	mesh->m_ColorBuffer = nullptr;
+	mesh->m_IndexBuffer = stroker->m_IndexBuffer;
+	mesh->m_NumVertices = stroker->m_NumVertices;
+	mesh->m_NumIndices = stroker->m_NumIndices;
+}
+
+// Generates the AA strip (one fringe wide) of a butt or square cap. e is the point of the cap edge
+// on the path and d is the direction into the stroke. Each half of the strip uses the distance
+// from the cap edge and from its own side of the stroke; the other side is far enough.
+static void addAnalyticAACapStrip(Stroker* stroker, const Vec2& e, const Vec2& d, const Vec2& l, float hsw_aa)
+{
+	const float fringeWidth = stroker->m_FringeWidth;
+	const Vec2 l_hsw = vec2Scale(l, hsw_aa);
+	const Vec2 i = vec2Add(e, vec2Scale(d, fringeWidth));
+
+	const float uvEdge = 0.0f;
+	const float uvInner = 1.0f;
+	const float uvMid = hsw_aa / fringeWidth;
+
+	const Vec2 p[8] = {
+		vec2Add(e, l_hsw), e, i, vec2Add(i, l_hsw),
+		e, vec2Sub(e, l_hsw), vec2Sub(i, l_hsw), i
+	};
+
+	const Vec2 uv[8] = {
+		{ uvEdge, uvEdge }, { uvMid, uvEdge }, { uvMid, uvInner }, { uvEdge, uvInner },
+		{ uvEdge, uvMid }, { uvEdge, uvEdge }, { uvInner, uvEdge }, { uvInner, uvMid }
+	};
+
+	const index_t firstVertexID = (index_t)stroker->m_NumVertices;
+	expandVB(stroker, 8);
+	addPosUV<8>(stroker, &p[0], &uv[0]);
+
+	index_t id[12] = {
+		firstVertexID, (index_t)(firstVertexID + 1), (index_t)(firstVertexID + 2),
+		firstVertexID, (index_t)(firstVertexID + 2), (index_t)(firstVertexID + 3),
+		(index_t)(firstVertexID + 4), (index_t)(firstVertexID + 5), (index_t)(firstVertexID + 6),
+		(index_t)(firstVertexID + 4), (index_t)(firstVertexID + 6), (index_t)(firstVertexID + 7)
+	};
+
+	expandIB(stroker, 12);
+	addIndices<12>(stroker, &id[0]);
+}
+#endif
+
 inline static void resetGeometry(Stroker* stroker)
 {
 	stroker->m_NumVertices = 0;
@@ -2317,6 +2716,9 @@ static void reallocVB(Stroker* stroker, uint32_t n)
 	stroker->m_VertexCapacity += n;
 	stroker->m_PosBuffer = (Vec2*)bx::alignedRealloc(stroker->m_Allocator, stroker->m_PosBuffer, sizeof(Vec2) * stroker->m_VertexCapacity, 16);
 	stroker->m_ColorBuffer = (uint32_t*)bx::alignedRealloc(stroker->m_Allocator, stroker->m_ColorBuffer, sizeof(uint32_t) * stroker->m_VertexCapacity, 16);
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+	stroker->m_UVBuffer = (Vec2*)bx::alignedRealloc(stroker->m_Allocator, stroker->m_UVBuffer, sizeof(Vec2) * stroker->m_VertexCapacity, 16);
+#endif
 }
 
 static BX_FORCE_INLINE void expandVB(Stroker* stroker, uint32_t n)
@@ -2329,7 +2731,7 @@ static BX_FORCE_INLINE void expandVB(Stroker* stroker, uint32_t n)
 static void reallocIB(Stroker* stroker, uint32_t n)
 {
 	stroker->m_IndexCapacity += n;
-	stroker->m_IndexBuffer = (uint16_t*)bx::alignedRealloc(stroker->m_Allocator, stroker->m_IndexBuffer, sizeof(uint16_t) * stroker->m_IndexCapacity, 16);
+	stroker->m_IndexBuffer = (index_t*)bx::alignedRealloc(stroker->m_Allocator, stroker->m_IndexBuffer, sizeof(index_t) * stroker->m_IndexCapacity, 16);
 }
 
 static BX_FORCE_INLINE void expandIB(Stroker* stroker, uint32_t n)
@@ -2364,13 +2766,29 @@ static void addPosColor(Stroker* stroker, const Vec2* srcPos, const uint32_t* sr
 	stroker->m_NumVertices += N;
 }
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+template<uint32_t N>
+static void addPosUV(Stroker* stroker, const Vec2* srcPos, const Vec2* srcUV)
+{
+	VG_CHECK(stroker->m_NumVertices + N <= stroker->m_VertexCapacity, "Not enough free space for temporary geometry");
+
+	float* dstPos = &stroker->m_PosBuffer[stroker->m_NumVertices].x;
+	memcpy(dstPos, srcPos, sizeof(Vec2) * N);
+
+	float* dstUV = &stroker->m_UVBuffer[stroker->m_NumVertices].x;
+	memcpy(dstUV, srcUV, sizeof(Vec2) * N);
+
+	stroker->m_NumVertices += N;
+}
+#endif
+
 template<uint32_t N>
-static void addIndices(Stroker* stroker, const uint16_t* src)
+static void addIndices(Stroker* stroker, const index_t* src)
 {
 	VG_CHECK(stroker->m_NumIndices + N <= stroker->m_IndexCapacity, "Not enough free space for temporary geometry");
 
-	uint16_t* dst = &stroker->m_IndexBuffer[stroker->m_NumIndices];
-	memcpy(dst, src, sizeof(uint16_t) * N);
+	index_t* dst = &stroker->m_IndexBuffer[stroker->m_NumIndices];
+	memcpy(dst, src, sizeof(index_t) * N);
 
 	stroker->m_NumIndices += N;
 }
@@ -1,5 +1,6 @@
 BX_STATIC_ASSERT(sizeof(vg_color) == sizeof(vg::Color));
 BX_STATIC_ASSERT(sizeof(vg_uv_t) == sizeof(vg::uv_t));
+BX_STATIC_ASSERT(sizeof(vg_index_t) == sizeof(vg::index_t));
 BX_STATIC_ASSERT(sizeof(vg_context_config) == sizeof(vg::ContextConfig));
 BX_STATIC_ASSERT(sizeof(vg_stats) == sizeof(vg::Stats));
 BX_STATIC_ASSERT(sizeof(vg_text_config) == sizeof(vg::TextConfig));
@@ -56,6 +57,21 @@ VG_C_API const vg_stats* vg_getStats(vg_context* ctx)
 	return (const vg_stats*)vg::getStats((vg::Context*)ctx);
 }
 
+VG_C_API void vg_setDirtyRectTracking(vg_context* ctx, bool enable)
+{
+	vg::setDirtyRectTracking((vg::Context*)ctx, enable);
+}
+
+VG_C_API void vg_addDirtyRect(vg_context* ctx, float x, float y, float w, float h)
+{
+	vg::addDirtyRect((vg::Context*)ctx, x, y, w, h);
+}
+
+VG_C_API bool vg_getDirtyRect(vg_context* ctx, float* rect)
+{
+	return vg::getDirtyRect((vg::Context*)ctx, rect);
+}
+
 VG_C_API void vg_beginPath(vg_context* ctx)
 {
 	vg::beginPath((vg::Context*)ctx);
@@ -329,12 +345,33 @@ VG_C_API int32_t vg_textGlyphPositions(vg_context* ctx, const vg_text_config* cf
 	return vg::textGlyphPositions((vg::Context*)ctx, *(vg::TextConfig*)cfg, x, y, text, end, (vg::GlyphPosition*)positions, maxPositions);
 }
 
-VG_C_API void vg_indexedTriList(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, vg_image_handle img)
+VG_C_API uint32_t vg_rasterizeGlyphs(vg_context* ctx, uint32_t maxGlyphs)
+{
+	return vg::rasterizeGlyphs((vg::Context*)ctx, maxGlyphs);
+}
+
+VG_C_API void vg_indexedTriList(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img)
 {
 	union { vg_image_handle c; vg::ImageHandle cpp; } imgHandle = { img };
 	vg::indexedTriList((vg::Context*)ctx, pos, (vg::uv_t*)uv, numVertices, (vg::Color*)color, numColors, indices, numIndices, imgHandle.cpp);
 }
 
+VG_C_API void vg_fillPathInstanced(vg_context* ctx, vg_color color, uint32_t flags, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances)
+{
+	vg::fillPathInstanced((vg::Context*)ctx, color, flags, instanceMtx, (const vg::Color*)instanceColors, numInstances);
+}
+
+VG_C_API void vg_strokePathInstanced(vg_context* ctx, vg_color color, float width, uint32_t flags, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances)
+{
+	vg::strokePathInstanced((vg::Context*)ctx, color, width, flags, instanceMtx, (const vg::Color*)instanceColors, numInstances);
+}
+
+VG_C_API void vg_indexedTriListInstanced(vg_context* ctx, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img, const float* instanceMtx, const vg_color* instanceColors, uint32_t numInstances)
+{
+	union { vg_image_handle c; vg::ImageHandle cpp; } imgHandle = { img };
+	vg::indexedTriListInstanced((vg::Context*)ctx, pos, (vg::uv_t*)uv, numVertices, (vg::Color*)color, numColors, indices, numIndices, imgHandle.cpp, instanceMtx, (const vg::Color*)instanceColors, numInstances);
+}
+
 VG_C_API bool vg_getImageSize(vg_context* ctx, vg_image_handle img, uint16_t* w, uint16_t* h)
 {
 	union { vg_image_handle c; vg::ImageHandle cpp; } imgHandle = { img };
@@ -374,6 +411,44 @@ VG_C_API bool vg_isImageValid(vg_context* ctx, vg_image_handle img)
 	return vg::isImageValid((vg::Context*)ctx, handle.cpp);
 }
 
+VG_C_API vg_layer_handle vg_createLayer(vg_context* ctx, uint16_t width, uint16_t height, uint32_t imageFlags)
+{
+	union { vg_layer_handle c; vg::LayerHandle cpp; } handle_ret;
+	handle_ret.cpp = vg::createLayer((vg::Context*)ctx, width, height, imageFlags);
+	return handle_ret.c;
+}
+
+VG_C_API void vg_destroyLayer(vg_context* ctx, vg_layer_handle handle)
+{
+	union { vg_layer_handle c; vg::LayerHandle cpp; } layerHandle = { handle };
+	vg::destroyLayer((vg::Context*)ctx, layerHandle.cpp);
+}
+
+VG_C_API void vg_invalidateLayer(vg_context* ctx, vg_layer_handle handle)
+{
+	union { vg_layer_handle c; vg::LayerHandle cpp; } layerHandle = { handle };
+	vg::invalidateLayer((vg::Context*)ctx, layerHandle.cpp);
+}
+
+VG_C_API vg_image_handle vg_getLayerImage(vg_context* ctx, vg_layer_handle handle)
+{
+	union { vg_layer_handle c; vg::LayerHandle cpp; } layerHandle = { handle };
+	union { vg_image_handle c; vg::ImageHandle cpp; } handle_ret;
+	handle_ret.cpp = vg::getLayerImage((vg::Context*)ctx, layerHandle.cpp);
+	return handle_ret.c;
+}
+
+VG_C_API bool vg_beginLayer(vg_context* ctx, vg_layer_handle handle, uint16_t viewID)
+{
+	union { vg_layer_handle c; vg::LayerHandle cpp; } layerHandle = { handle };
+	return vg::beginLayer((vg::Context*)ctx, layerHandle.cpp, viewID);
+}
+
+VG_C_API void vg_endLayer(vg_context* ctx)
+{
+	vg::endLayer((vg::Context*)ctx);
+}
+
 VG_C_API vg_command_list_handle vg_createCommandList(vg_context* ctx, uint32_t flags)
 {
 	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle_ret;
@@ -381,6 +456,13 @@ VG_C_API vg_command_list_handle vg_createCommandList(vg_context* ctx, uint32_t f
 	return handle_ret.c;
 }
 
+VG_C_API vg_command_list_handle vg_createCommandList_shard(vg_context* ctx, uint32_t flags, uint16_t shardID)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle_ret;
+	handle_ret.cpp = vg::createCommandList((vg::Context*)ctx, flags, shardID);
+	return handle_ret.c;
+}
+
 VG_C_API void vg_destroyCommandList(vg_context* ctx, vg_command_list_handle clh)
 {
 	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
@@ -399,6 +481,12 @@ VG_C_API void vg_submitCommandList(vg_context* ctx, vg_command_list_handle clh)
 	vg::submitCommandList((vg::Context*)ctx, handle.cpp);
 }
 
+VG_C_API bool vg_prepareCommandList(vg_context* ctx, vg_command_list_handle clh, uint16_t shardID)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
+	return vg::prepareCommandList((vg::Context*)ctx, handle.cpp, shardID);
+}
+
 VG_C_API void vg_clBeginPath(vg_context* ctx, vg_command_list_handle clh)
 {
 	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
@@ -483,7 +571,7 @@ VG_C_API void vg_clClosePath(vg_context* ctx, vg_command_list_handle clh)
 	vg::clClosePath((vg::Context*)ctx, handle.cpp);
 }
 
-VG_C_API void vg_clIndexedTriList(vg_context* ctx, vg_command_list_handle clh, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, vg_image_handle img)
+VG_C_API void vg_clIndexedTriList(vg_context* ctx, vg_command_list_handle clh, const float* pos, const vg_uv_t* uv, uint32_t numVertices, const vg_color* color, uint32_t numColors, const vg_index_t* indices, uint32_t numIndices, vg_image_handle img)
 {
 	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
 	union { vg_image_handle c; vg::ImageHandle cpp; } imgHandle = { img };
@@ -665,6 +753,43 @@ VG_C_API void vg_clSubmitCommandList(vg_context* ctx, vg_command_list_handle par
 	vg::clSubmitCommandList((vg::Context*)ctx, parentHandle.cpp, childHandle.cpp);
 }
 
+VG_C_API void vg_clBeginLayer(vg_context* ctx, vg_command_list_handle handle, vg_layer_handle layer, uint16_t viewID)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } clHandle = { handle };
+	union { vg_layer_handle c; vg::LayerHandle cpp; } layerHandle = { layer };
+	vg::clBeginLayer((vg::Context*)ctx, clHandle.cpp, layerHandle.cpp, viewID);
+}
+
+VG_C_API void vg_clEndLayer(vg_context* ctx, vg_command_list_handle handle)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } clHandle = { handle };
+	vg::clEndLayer((vg::Context*)ctx, clHandle.cpp);
+}
+
+VG_C_API uint32_t vg_clGetNextCommandID(vg_context* ctx, vg_command_list_handle clh)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
+	return vg::clGetNextCommandID((vg::Context*)ctx, handle.cpp);
+}
+
+VG_C_API void vg_clSetCommandColor(vg_context* ctx, vg_command_list_handle clh, uint32_t cmdID, vg_color color)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
+	vg::clSetCommandColor((vg::Context*)ctx, handle.cpp, cmdID, color);
+}
+
+VG_C_API void vg_clSetCommandVisible(vg_context* ctx, vg_command_list_handle clh, uint32_t cmdID, bool visible)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh };
+	vg::clSetCommandVisible((vg::Context*)ctx, handle.cpp, cmdID, visible);
+}
+
+VG_C_API void vg_clReplaceCommandPath(vg_context* ctx, vg_command_list_handle clh, uint32_t cmdID, vg_command_list_handle pathList)
+{
+	union { vg_command_list_handle c; vg::CommandListHandle cpp; } handle = { clh }, pathHandle = { pathList };
+	vg::clReplaceCommandPath((vg::Context*)ctx, handle.cpp, cmdID, pathHandle.cpp);
+}
+
 VG_C_API vg_api* vg_getAPI()
 {
 	static vg_api s_vg = {
@@ -733,9 +858,11 @@ VG_C_API vg_api* vg_getAPI()
 		vg_destroyImage,
 		vg_isImageValid,
 		vg_createCommandList,
+		vg_createCommandList_shard,
 		vg_destroyCommandList,
 		vg_resetCommandList,
 		vg_submitCommandList,
+		vg_prepareCommandList,
 		vg_clBeginPath,
 		vg_clMoveTo,
 		vg_clLineTo,
@@ -778,6 +905,25 @@ VG_C_API vg_api* vg_getAPI()
 		vg_clText,
 		vg_clTextBox,
 		vg_clSubmitCommandList,
+		vg_clGetNextCommandID,
+		vg_clSetCommandColor,
+		vg_clSetCommandVisible,
+		vg_clReplaceCommandPath,
+		vg_fillPathInstanced,
+		vg_strokePathInstanced,
+		vg_indexedTriListInstanced,
+		vg_setDirtyRectTracking,
+		vg_addDirtyRect,
+		vg_getDirtyRect,
+		vg_createLayer,
+		vg_destroyLayer,
+		vg_invalidateLayer,
+		vg_getLayerImage,
+		vg_beginLayer,
+		vg_endLayer,
+		vg_clBeginLayer,
+		vg_clEndLayer,
+		vg_rasterizeGlyphs,
 	};
 
 	return &s_vg;
@@ -2,9 +2,6 @@
 // - More than 254 clip regions: Either use another view (extra parameter in createContext)
 // or draw a fullscreen quad to reset the stencil buffer to 0.
 // - Recycle the memory of cached meshes so resetting a cached mesh is faster.
-// - Find a way to move stroker operations into separate functions (i.e. all strokePath
-// functions differ only on the createDrawCommand_XXX() call; strokerXXX calls are the same
-// and the code is duplicated).
 // - Allow strokes and fills with gradients and image patterns to be used as clip masks (might
 // be useful if the same command list is used both inside and outside a beginClip()/endClip()
 // block)
@@ -14,7 +11,7 @@
 #include "vg_util.h"
 #include "font_system.h"
 #include <bx/allocator.h>
-#include <bx/mutex.h>
+#include <bx/cpu.h>
 #include <bx/handlealloc.h>
 #include <bx/string.h>
 #include <bgfx/bgfx.h>
@@ -29,6 +26,9 @@
 #include "shaders/fs_image_pattern.bin.h"
 #include "shaders/vs_stencil.bin.h"
 #include "shaders/fs_stencil.bin.h"
+#include "shaders/vs_textured_instanced.bin.h"
+#include "shaders/fs_coverage.bin.h"
+#include "shaders/fs_text_sdf.bin.h"
 
 BX_PRAGMA_DIAGNOSTIC_IGNORED_MSVC(4706) // assignment within conditional expression
 
@@ -37,9 +37,31 @@ BX_PRAGMA_DIAGNOSTIC_IGNORED_MSVC(4706) // assignment within conditional express
 #define VG_CONFIG_MIN_FONT_ATLAS_SIZE            512
 #define VG_CONFIG_COMMAND_LIST_CACHE_STACK_SIZE  32
 #define VG_CONFIG_COMMAND_LIST_ALIGNMENT         16
+#define VG_CONFIG_DRAW_COMMAND_MERGE_WINDOW      32 // Max number of batches a draw command is moved back over
+#define VG_CONFIG_MIN_VB_VERTICES                1024
+#define VG_CONFIG_VB_USAGE_HISTORY_LENGTH        64 // Number of frames used to calculate the vertex buffer high-water mark
+#define VG_CONFIG_LAYER_STACK_SIZE               8  // Max number of nested beginLayer() calls
+
+#if VG_CONFIG_INDEX_UINT32
+#define VG_INDEX_BUFFER_FLAGS BGFX_BUFFER_INDEX32
+#else
+#define VG_INDEX_BUFFER_FLAGS BGFX_BUFFER_NONE
+#endif
+
+#if VG_CONFIG_POSITION_INT16
+#define VG_POSITION_SCALE ((float)(1 << VG_CONFIG_POSITION_INT16_FRAC_BITS))
+#endif
+
+BX_STATIC_ASSERT(!VG_CONFIG_ENABLE_ANALYTIC_AA || !VG_CONFIG_UV_INT16, "VG_CONFIG_ENABLE_ANALYTIC_AA requires VG_CONFIG_UV_INT16 = 0");
 
 namespace vg
 {
+#if VG_CONFIG_POSITION_INT16
+typedef int16_t pos_t;
+#else
+typedef float pos_t;
+#endif
+
 static const bgfx::EmbeddedShader s_EmbeddedShaders[] =
 {
 	BGFX_EMBEDDED_SHADER(vs_textured),
@@ -50,6 +72,9 @@ static const bgfx::EmbeddedShader s_EmbeddedShaders[] =
 	BGFX_EMBEDDED_SHADER(fs_image_pattern),
 	BGFX_EMBEDDED_SHADER(vs_stencil),
 	BGFX_EMBEDDED_SHADER(fs_stencil),
+	BGFX_EMBEDDED_SHADER(vs_textured_instanced),
+	BGFX_EMBEDDED_SHADER(fs_coverage),
+	BGFX_EMBEDDED_SHADER(fs_text_sdf),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
@@ -104,12 +129,17 @@ struct DrawCommand
 		// The idea is that when using multiple image patterns, a new draw call will always be created
 		// for each image, so there's little harm in changing shader program as well (?!?). In other words,
 		// 2 paths with different image patterns wouldn't have been batched together either way.
+		// Coverage commands (VG_CONFIG_ENABLE_ANALYTIC_AA) draw solid colors using the distances
+		// stored in the UVs instead of a texture. TextSDF commands (VG_CONFIG_ENABLE_SDF_TEXT) draw
+		// text quads sampling distance field glyphs from a font atlas image.
 		enum Enum : uint32_t
 		{
 			Textured = 0,
 			ColorGradient,
 			ImagePattern,
 			Clip,
+			Coverage,
+			TextSDF,
 
 			NumTypes
 		};
@@ -123,34 +153,145 @@ struct DrawCommand
 	uint32_t m_NumVertices;
 	uint32_t m_NumIndices;
 	uint16_t m_ScissorRect[4];
-	uint16_t m_HandleID; // Type::Textured => ImageHandle, Type::ColorGradient => GradientHandle, Type::ImagePattern => ImagePatternHandle
+	uint16_t m_HandleID; // Type::Textured => ImageHandle, Type::ColorGradient => GradientHandle, Type::ImagePattern => ImagePatternHandle, Type::Coverage => UINT16_MAX, Type::TextSDF => ImageHandle
+	uint32_t m_RetainedDrawID; // Index in Context::m_RetainedDraws or UINT32_MAX if the geometry lives in the per-frame buffers
+	uint32_t m_TransformID; // Index in Context::m_DrawTransforms or UINT32_MAX if the vertices are already in canvas space
+	uint16_t m_LayerID; // Index in Context::m_Layers, kMainLayerID for the view passed to begin() or kDiscardLayerID
+	uint32_t m_NumStencilIndices; // Stencil-and-cover fills: number of triangle fan indices preceding the cover quad; 0 otherwise
+	FillRule::Enum m_StencilFillRule;
+	uint32_t m_FirstInstanceID; // Index in Context::m_InstanceData
+	uint32_t m_NumInstances; // Instanced Textured commands: number of instances drawn with a single submit; 0 otherwise
+	float m_SDFBlur; // Type::TextSDF: half width of the blurred glyph edges in distance field units; 0 otherwise
+#if VG_CONFIG_POSITION_INT16
+	float m_PosQuant[3]; // Origin (x, y) and scale of the quantized positions (see setPosQuantization())
+#endif
+};
+
+static const uint16_t kMainLayerID = UINT16_MAX;
+static const uint16_t kDiscardLayerID = UINT16_MAX - 1; // Commands drawn inside a layer with valid cached content
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+struct Vertex
+{
+	pos_t m_Pos[2];
+	uv_t m_UV[2];
+	uint32_t m_Color;
+};
+
+BX_STATIC_ASSERT(sizeof(Vertex) == sizeof(pos_t) * 2 + sizeof(uv_t) * 2 + sizeof(uint32_t), "Vertex must be tightly packed");
+#endif
+
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+// Identifies the data last uploaded to a GPU buffer.
+struct BufferContent
+{
+	uint64_t m_Hash;
+	uint32_t m_Count;   // Number of vertices/indices (0 if unknown)
+	uint8_t m_Head[16]; // First bytes of the data; cheap extra check against hash collisions
 };
+#endif
 
 struct GPUVertexBuffer
 {
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	bgfx::DynamicVertexBufferHandle m_bgfxHandle;
+#else
 	bgfx::DynamicVertexBufferHandle m_PosBufferHandle;
 	bgfx::DynamicVertexBufferHandle m_UVBufferHandle;
 	bgfx::DynamicVertexBufferHandle m_ColorBufferHandle;
+#endif
+	uint32_t m_Capacity;
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+	BufferContent m_Content; // Vertices last uploaded to the GPU buffers
+#endif
+};
+
+struct VertexBufferUsage
+{
+	uint32_t m_MaxVertices; // Max number of vertices in a single vertex buffer
+	uint32_t m_NumBuffers;
 };
 
 struct GPUIndexBuffer
 {
 	bgfx::DynamicIndexBufferHandle m_bgfxHandle;
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+	BufferContent m_Content; // Indices last uploaded to the GPU buffer
+#endif
+};
+
+// Buffers of a draw command which references the static GPU buffers of a Retained command
+// list (see CommandListCache).
+struct RetainedDraw
+{
+	bgfx::VertexBufferHandle m_PosBufferHandle;
+	bgfx::VertexBufferHandle m_UVBufferHandle;
+	bgfx::VertexBufferHandle m_ColorBufferHandle;
+	bgfx::IndexBufferHandle m_IndexBufferHandle;
+};
+
+// Model matrix applied by the vertex shader to the vertices of a draw command. Used for cached
+// meshes which are stored in local space so they don't have to be transformed on the CPU.
+struct DrawTransform
+{
+	float m_ModelMtx[16];
+};
+
+// Per-instance vertex shader input of the instanced Textured program (i_data0..i_data2).
+struct InstanceData
+{
+	float m_MtxRow0[4]; // { mtx[0], mtx[2], mtx[4], 0 }
+	float m_MtxRow1[4]; // { mtx[1], mtx[3], mtx[5], 0 }
+	float m_Color[4];   // Multiplied with the vertex color
+};
+
+// bgfx::makeRef() user data for vertex and index buffer memory. The release callbacks (which
+// are called from the render thread in multithreaded bgfx builds) push the ref back to its
+// free list once all bgfx::Memory objects referencing the buffer have been released. Pushing
+// is lock-free and only the thread calling begin()/end() pops, so there's no ABA problem.
+struct BufferRef
+{
+	Context* m_Context;
+	volatile uint32_t* m_FreeList; // Context::m_FreeVertexBufferDataList or Context::m_FreeIndexBufferList
+	uint32_t m_ID;                 // Index in Context::m_BufferRefs
+	uint32_t m_ResourceID;         // Index in Context::m_VertexBufferData or Context::m_IndexBuffers
+	uint32_t m_NextFreeID;
+	int32_t m_NumPendingReleases;
+};
+
+struct VertexBufferData
+{
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	Vertex* m_Vertices;
+#else
+	pos_t* m_Pos;
+	uint32_t* m_Color;
+	uv_t* m_UV;
+#endif
+	uint32_t m_Capacity;
+	BufferRef* m_Ref;
 };
 
 struct VertexBuffer
 {
-	float* m_Pos;
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	Vertex* m_Vertices;
+#else
+	pos_t* m_Pos;
 	uv_t* m_UV;
 	uint32_t* m_Color;
+#endif
 	uint32_t m_Count;
+	uint32_t m_Capacity;
+	BufferRef* m_Ref;
 };
 
 struct IndexBuffer
 {
-	uint16_t* m_Indices;
+	index_t* m_Indices;
 	uint32_t m_Count;
 	uint32_t m_Capacity;
+	BufferRef* m_Ref;
 };
 
 struct Image
@@ -160,6 +301,26 @@ struct Image
 	uint32_t m_Flags;
 	bgfx::TextureHandle m_bgfxHandle;
 	bool m_Owned;
+	bool m_PremultipliedAlpha; // Drawn with premultiplied alpha blending (layer images)
+};
+
+struct Layer
+{
+	bgfx::FrameBufferHandle m_FrameBufferHandle;
+	ImageHandle m_Image;
+	uint16_t m_Width;  // in pixels
+	uint16_t m_Height; // in pixels
+	uint16_t m_ViewID; // The view passed to the last beginLayer() which rendered the layer
+	bool m_IsValid;    // The framebuffer holds the content of the layer
+};
+
+struct LayerStackEntry
+{
+	ClipState m_ClipState;
+	uint16_t m_LayerID;
+	uint16_t m_PrevLayerID;
+	uint16_t m_CanvasWidth;
+	uint16_t m_CanvasHeight;
 };
 
 struct CommandType
@@ -224,38 +385,149 @@ struct CommandType
 
 		// Command lists
 		SubmitCommandList,
+
+		// Layers
+		BeginLayer,
+		EndLayer,
+	};
+};
+
+struct CommandFlags
+{
+	enum Enum : uint32_t
+	{
+		Hidden = 1 << 0, // Stroker commands only. Set by clSetCommandVisible().
+	};
+};
+
+struct CommandListBoundsFlags
+{
+	enum Enum : uint32_t
+	{
+		HasGeometry   = 1 << 0, // CommandList::m_Bounds is valid
+		Unbounded     = 1 << 1, // Text, state changes which cannot be tracked or leak to the caller, invalid children. Never culled.
+		ResetsScissor = 1 << 2, // Set/ResetScissor commands; can draw outside the caller's scissor rect
+		MiterJoins    = 1 << 3, // At least one stroke uses miter joins
+		HasChildren   = 1 << 4, // Includes the bounds of child lists; valid while their generations match CommandList::m_BoundsChildren
 	};
 };
 
+struct CommandListBoundsChild
+{
+	CommandListHandle m_Handle;
+	uint32_t m_Generation;      // CommandList::m_BoundsGeneration of the child when its bounds were added
+};
+
 struct CommandHeader
 {
 	CommandType::Enum m_Type;
 	uint32_t m_Size;
+	uint32_t m_Flags; // CommandFlags
 };
 
+// AA meshes store their per-vertex coverage instead of colors. The final vertex colors are
+// calculated at submit time from the paint color of the command so changing the color (or
+// the global alpha) of a cached command doesn't require tessellating it again.
 struct CachedMesh
 {
 	float* m_Pos;
-	uint32_t* m_Colors;
-	uint16_t* m_Indices;
+	uint8_t* m_Coverage; // nullptr if all vertices are fully covered
+	index_t* m_Indices;
 	uint32_t m_NumVertices;
 	uint32_t m_NumIndices;
 };
 
 struct CachedCommand
 {
-	uint16_t m_FirstMeshID;
-	uint16_t m_NumMeshes;
+	CachedMesh* m_Meshes;
+	uint32_t m_NumMeshes;
 	float m_InvTransformMtx[6];
+	bool m_IsDirty; // The command has been modified after caching and should be tessellated again.
+
+	// Range of the command's meshes in the CommandListCache GPU buffers. m_GPUNumIndices is 0
+	// if the command cannot be drawn from the GPU buffers (e.g. non-color paints).
+	uint32_t m_GPUFirstVertexID;
+	uint32_t m_GPUNumVertices;
+	uint32_t m_GPUFirstIndexID;
+	uint32_t m_GPUNumIndices;
 };
 
 struct CommandListCache
 {
-	CachedMesh* m_Meshes;
-	uint32_t m_NumMeshes;
 	CachedCommand* m_Commands;
 	uint32_t m_NumCommands;
+	CachedCommand* m_ActiveCommand;  // Between beginCachedCommand() and endCachedCommand()
+	CachedCommand* m_RebuildCommand; // If set, beginCachedCommand() reuses this command instead of appending a new one.
 	float m_AvgScale;
+	uint32_t m_LastUsed;   // Context::m_CmdListCacheClock value of the last submission; 0 if the LOD is empty
+	uint32_t m_MemoryUsed; // Size of the cached meshes (see ContextConfig::m_MaxCacheMemory)
+
+	// CommandListFlags::Retained geometry. Uploaded by the first clCacheRender() call without modified
+	// commands and destroyed when commands are modified.
+	bgfx::VertexBufferHandle m_GPUPosBufferHandle;
+	bgfx::VertexBufferHandle m_GPUUVBufferHandle;
+	bgfx::VertexBufferHandle m_GPUColorBufferHandle;
+	bgfx::IndexBufferHandle m_GPUIndexBufferHandle;
+	uv_t m_GPUWhitePixelUV[2];
+	bool m_GPUPremultipliedAlpha; // Colors have been premultiplied (see premultiplyDrawCommandColors())
+};
+
+struct PreparedMesh
+{
+	uint32_t m_FirstVertexID;
+	uint32_t m_NumVertices;
+	uint32_t m_FirstColorID;
+	uint32_t m_NumColors;
+	uint32_t m_FirstIndexID;
+	uint32_t m_NumIndices;
+};
+
+struct PreparedCommand
+{
+	uint32_t m_FirstMeshID;
+	uint32_t m_NumMeshes;
+};
+
+// A child list submitted by a prepared command list. The prepared meshes include the child's
+// commands so they are only valid while the child stays the same.
+struct PreparedCommandListChild
+{
+	CommandListHandle m_Handle;
+	uint32_t m_Revision;         // CommandList::m_Revision of the child when it was prepared
+	uint32_t m_CommandBufferPos; // CommandList::m_CommandBufferPos of the child when it was prepared
+	bool m_IsValid;              // false if the handle was invalid (i.e. the child was skipped)
+};
+
+// Meshes generated by prepareCommandList() for every stroker command of a command list
+// (including the commands of its children), in submission order.
+struct PreparedCommandList
+{
+	bx::AllocatorI* m_Allocator;
+	float* m_Pos;
+	uint32_t* m_Colors;
+	index_t* m_Indices;
+	PreparedMesh* m_Meshes;
+	PreparedCommand* m_Commands;
+	PreparedCommandListChild* m_Children;
+	uint32_t m_NumVertices;
+	uint32_t m_VertexCapacity;
+	uint32_t m_NumColors;
+	uint32_t m_ColorCapacity;
+	uint32_t m_NumIndices;
+	uint32_t m_IndexCapacity;
+	uint32_t m_NumMeshes;
+	uint32_t m_MeshCapacity;
+	uint32_t m_NumCommands;
+	uint32_t m_CommandCapacity;
+	uint32_t m_NumChildren;
+	uint32_t m_ChildCapacity;
+	uint32_t m_CommandBufferPos;
+	uint32_t m_Revision;
+	float m_TesselationTolerance;
+	float m_FringeWidth;
+	uint16_t m_CanvasWidth;
+	uint16_t m_CanvasHeight;
+	bool m_IsValid;
 };
 
 struct CommandList
@@ -269,10 +541,65 @@ struct CommandList
 	uint32_t m_StringBufferPos;
 
 	uint32_t m_Flags;
+	uint32_t m_NumStrokerCommands;
 	uint16_t m_NumGradients;
 	uint16_t m_NumImagePatterns;
+	uint16_t m_ShardID;
+
+	CommandListCache* m_Cache; // ContextConfig::m_MaxCachedLODs entries, one per tessellation scale
+	PreparedCommandList* m_Prepared;
+
+	// Conservative bounds of everything recorded so far, relative to the transform the list
+	// is submitted with. Updated by the cl*() functions and checked by ctxSubmitCommandList().
+	float m_Bounds[4];              // minx, miny, maxx, maxy
+	float m_BoundsMtx[6];           // Transform of the next recorded command
+	float* m_BoundsMtxStack;        // m_BoundsMtx of each open clPushState()
+	uint32_t m_BoundsMtxStackSize;
+	uint32_t m_BoundsMtxStackCapacity;
+	float m_BoundsStrokeWidth;      // Max stroke width, in list units
+	float m_BoundsFixedStrokeWidth; // Max StrokeFlags::FixedWidth stroke width, in pixels
+	uint32_t m_BoundsFlags;         // CommandListBoundsFlags
+	uint32_t m_BoundsGeneration;    // Bumped every time the bounds grow and when the list is reset or destroyed
+	CommandListBoundsChild* m_BoundsChildren; // Every child list included in m_Bounds
+	uint32_t m_NumBoundsChildren;
+	uint32_t m_BoundsChildrenCapacity;
+
+	// Dirty rect tracking (see clUpdateDirtyRect()).
+	uint32_t m_Revision;            // Bumped every time the commands of the list are modified
+	uint32_t m_DirtyRevision;       // m_Revision at the last tracked submission
+	uint32_t m_DirtyFrameID;        // Context::m_DirtyFrameID of the last tracked submission (0 if never submitted)
+	float m_DirtyBounds[4];         // Canvas space bounds of the submissions of m_DirtyFrameID
+	float m_DirtyPrevBounds[4];     // Canvas space bounds of the submissions of the frame before
+	float m_DirtyMtx[6];            // Transform of the first submission of m_DirtyFrameID
+};
+
+// Everything needed to turn a path into meshes.
+struct Tessellator
+{
+	bx::AllocatorI* m_Allocator;
+	Path* m_Path;
+	Stroker* m_Stroker;
+	float* m_TransformedVertices;
+	uint32_t m_TransformedVertexCapacity;
+	uint32_t* m_Colors;
+	uint32_t m_ColorCapacity;
+	bool m_PathTransformed;
+};
+
+typedef void (*TessMeshCallback)(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors);
+
+// Everything a thread needs in order to record or prepare command lists without touching
+// shared Context state. Stats are merged in getStats().
+struct RecordingShard
+{
+	bx::AllocatorI* m_Allocator;
+	Stats m_Stats;
 
-	CommandListCache* m_Cache;
+	// prepareCommandList() state. Lazily allocated.
+	Tessellator m_Tessellator;
+	State* m_StateStack;
+	uint32_t m_StateStackTop;
+	bool m_RecordClipCommands;
 };
 
 struct Context
@@ -287,48 +614,72 @@ struct Context
 	float m_TesselationTolerance;
 	float m_FringeWidth;
 
-	Stroker* m_Stroker;
-	Path* m_Path;
+	Tessellator m_Tessellator;
 
 	VertexBuffer* m_VertexBuffers;
 	GPUVertexBuffer* m_GPUVertexBuffers;
 	uint32_t m_NumVertexBuffers;
 	uint32_t m_VertexBufferCapacity;
 	uint32_t m_FirstVertexBufferID;
+	uint32_t m_VBVertexCapacity; // Capacity of newly allocated vertex buffers (see vbUpdateUsageHistory())
+	VertexBufferUsage m_VBUsageHistory[VG_CONFIG_VB_USAGE_HISTORY_LENGTH];
+	uint32_t m_VBUsageHistoryPos;
 
 	IndexBuffer* m_IndexBuffers;
 	GPUIndexBuffer* m_GPUIndexBuffers;
 	uint32_t m_NumIndexBuffers;
 	uint16_t m_ActiveIndexBufferID;
 
-	bx::AllocatorI* m_PosBufferPool;
-	bx::AllocatorI* m_ColorBufferPool;
-	bx::AllocatorI* m_UVBufferPool;
+	VertexBufferData* m_VertexBufferData;
+	uint32_t m_NumVertexBufferData;
 
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::Mutex* m_DataPoolMutex;
-#endif
+	BufferRef** m_BufferRefs;
+	uint32_t m_NumBufferRefs;
+	volatile uint32_t m_FreeVertexBufferDataList;
+	volatile uint32_t m_FreeIndexBufferList;
 
 	Image* m_Images;
 	uint32_t m_ImageCapacity;
 	bx::HandleAlloc* m_ImageHandleAlloc;
 
+	Layer* m_Layers;
+	bx::HandleAlloc* m_LayerHandleAlloc;
+	LayerStackEntry m_LayerStack[VG_CONFIG_LAYER_STACK_SIZE];
+	uint32_t m_LayerStackTop;
+	uint16_t m_ActiveLayerID;       // Assigned to new draw commands
+	bool m_HasLayerCommands;        // Some draw commands of the current frame render layers
+
 	CommandList* m_CmdLists;
 	bx::HandleAlloc* m_CmdListHandleAlloc;
+	RecordingShard* m_RecordingShards;
 	uint32_t m_SubmitCmdListRecursionDepth;
+	PreparedCommandList* m_ActivePreparedCmdList;
+	uint32_t m_NextPreparedCmdID;
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
 	CommandListCache* m_CmdListCacheStack[VG_CONFIG_COMMAND_LIST_CACHE_STACK_SIZE];
 	uint32_t m_CmdListCacheStackTop;
+	uint32_t m_CmdListCacheClock;
+	uint32_t m_CmdListCacheFrameClock; // m_CmdListCacheClock at begin()
+	uint32_t m_CmdListCacheMemory;     // Sum of CommandListCache::m_MemoryUsed of all LODs
 #endif
 
-	float* m_TransformedVertices;
-	uint32_t m_TransformedVertexCapacity;
-	bool m_PathTransformed;
-
 	DrawCommand* m_DrawCommands;
 	uint32_t m_NumDrawCommands;
 	uint32_t m_DrawCommandCapacity;
 
+	RetainedDraw* m_RetainedDraws;
+	uint32_t m_NumRetainedDraws;
+	uint32_t m_RetainedDrawCapacity;
+
+	DrawTransform* m_DrawTransforms;
+	uint32_t m_NumDrawTransforms;
+	uint32_t m_DrawTransformCapacity;
+	uint32_t m_ActiveDrawTransformID; // Assigned to new draw commands
+
+	InstanceData* m_InstanceData;
+	uint32_t m_NumInstances;
+	uint32_t m_InstanceCapacity;
+
 	State* m_StateStack;
 	uint32_t m_StateStackTop;
 
@@ -339,6 +690,9 @@ struct Context
 	bool m_RecordClipCommands;
 	bool m_ForceNewClipCommand;
 	bool m_ForceNewDrawCommand;
+#if VG_CONFIG_POSITION_INT16
+	float m_PosQuant[3]; // DrawCommand::m_PosQuant of the next draw/clip command
+#endif
 
 	Gradient* m_Gradients;
 	uint32_t m_NextGradientID;
@@ -346,6 +700,13 @@ struct Context
 	ImagePattern* m_ImagePatterns;
 	uint32_t m_NextImagePatternID;
 
+	bool m_DirtyRectTracking;
+	bool m_HasDirtyRect;
+	float m_DirtyRect[4];           // minx, miny, maxx, maxy; accumulated since the last end()
+	uint16_t m_RedrawRect[4];       // x, y, w, h; the area rendered by the last end()
+	uint16_t m_DirtyCanvasSize[2];  // Canvas size of the last end(); a different size redraws everything
+	uint32_t m_DirtyFrameID;        // Incremented by begin()
+
 	FontSystem* m_FontSystem;
 	float* m_TextVertices;
 	uint32_t m_TextVertexCapacity;
@@ -353,50 +714,156 @@ struct Context
 	bgfx::VertexLayout m_PosVertexDecl;
 	bgfx::VertexLayout m_UVVertexDecl;
 	bgfx::VertexLayout m_ColorVertexDecl;
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	bgfx::VertexLayout m_VertexDecl;
+#elif VG_CONFIG_POSITION_INT16
+	bgfx::VertexLayout m_QuantizedPosVertexDecl;
+#endif
 	bgfx::ProgramHandle m_ProgramHandle[DrawCommand::Type::NumTypes];
+	bgfx::ProgramHandle m_InstancedProgramHandle; // Textured program reading the model matrix and color from the instance data; invalid if bgfx doesn't support instancing
 	bgfx::UniformHandle m_TexUniform;
 	bgfx::UniformHandle m_PaintMatUniform;
 	bgfx::UniformHandle m_ExtentRadiusFeatherUniform;
 	bgfx::UniformHandle m_InnerColorUniform;
 	bgfx::UniformHandle m_OuterColorUniform;
+	bgfx::UniformHandle m_SDFParamsUniform;
+};
+
+// TessMeshCallback user data for turning meshes into draw commands.
+struct DrawCommandMeshSink
+{
+	Context* m_Context;
+	DrawCommand::Type::Enum m_Type;
+	uint16_t m_Handle;
+	Color m_Color; // Paint color of meshes tessellated for the cache (see ctxFillPath())
+	bool m_AddToCache;
+};
+
+struct InstancedMeshSink
+{
+	Context* m_Context;
+	const float* m_InstanceMtx;
+	const Color* m_InstanceColors;
+	uint32_t m_NumInstances;
+	float m_InvTransformMtx[6];
+	float* m_LocalPos;
+	uint32_t m_LocalPosCapacity;
 };
 
 static State* getState(Context* ctx);
 static void updateState(State* state);
 
-static float* allocTransformedVertices(Context* ctx, uint32_t numVertices);
-static const float* transformPath(Context* ctx);
+static void stateTransformIdentity(State* state);
+static void stateTransformScale(State* state, float x, float y);
+static void stateTransformTranslate(State* state, float x, float y);
+static void stateTransformRotate(State* state, float ang_rad);
+static void stateTransformMult(State* state, const float* mtx, TransformOrder::Enum order);
+static void stateSetViewBox(State* state, float canvasWidth, float canvasHeight, float x, float y, float w, float h);
+
+static void tessInit(Tessellator* tess, bx::AllocatorI* allocator);
+static void tessShutdown(Tessellator* tess);
+static void tessBeginPath(Tessellator* tess, float avgScale, float tesselationTolerance, float fringeWidth);
+static float* tessAllocTransformedVertices(Tessellator* tess, uint32_t numVertices);
+static uint32_t* tessAllocColors(Tessellator* tess, uint32_t numColors);
+static const float* tessTransformPath(Tessellator* tess, const float* mtx);
+static bool tessIsPathVisible(Tessellator* tess, const float* mtx, const float* rect, float margin);
+static float tessCalcStrokeMargin(const State* state, float fringeWidth, float width, uint32_t flags);
+static void tessFillPath(Tessellator* tess, const State* state, DrawCommand::Type::Enum paintType, Color color, uint32_t flags, bool recordClipCommands, bool hasCache, TessMeshCallback callback, void* userData);
+static void tessStrokePath(Tessellator* tess, const State* state, float fringeWidth, DrawCommand::Type::Enum paintType, Color color, float width, uint32_t flags, bool recordClipCommands, bool hasCache, TessMeshCallback callback, void* userData);
+static void drawCommandMeshCallback(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors);
+static bool beginInstancedMeshSink(Context* ctx, InstancedMeshSink* sink, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
+static void endInstancedMeshSink(Context* ctx, InstancedMeshSink* sink);
+static void instancedMeshCallback(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors);
+
+static BufferRef* createBufferRef(Context* ctx, volatile uint32_t* freeList, uint32_t resourceID);
+static void pushBufferRef(BufferRef* ref);
+static BufferRef* popBufferRef(Context* ctx, volatile uint32_t* freeList);
+static void releaseBufferCallback(void* ptr, void* userData);
 
 static VertexBuffer* allocVertexBuffer(Context* ctx);
-static void releaseVertexBufferPosCallback(void* ptr, void* userData);
-static void releaseVertexBufferColorCallback(void* ptr, void* userData);
-static void releaseVertexBufferUVCallback(void* ptr, void* userData);
-
+static void vbDataResize(Context* ctx, VertexBufferData* data, uint32_t capacity);
+static void vbUpdateUsageHistory(Context* ctx);
+static void destroyGPUVertexBuffer(GPUVertexBuffer* gpuvb);
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+static void vbCalcContent(const VertexBuffer* vb, BufferContent* content);
+static void ibCalcContent(const IndexBuffer* ib, BufferContent* content);
+#endif
 static uint16_t allocIndexBuffer(Context* ctx);
-static void releaseIndexBuffer(Context* ctx, uint16_t* data);
-static void releaseIndexBufferCallback(void* ptr, void* userData);
+static void vbWriteVertices(VertexBuffer* vb, const DrawCommand* cmd, uint32_t firstVertexID, uint32_t numVertices, const float* pos, const float* mtx, const uv_t* uv, uint32_t numUVs, const uint32_t* colors, uint32_t numColors);
 
 static DrawCommand* allocDrawCommand(Context* ctx, uint32_t numVertices, uint32_t numIndices, DrawCommand::Type::Enum type, uint16_t handle);
 static DrawCommand* allocClipCommand(Context* ctx, uint32_t numVertices, uint32_t numIndices);
-static void createDrawCommand_VertexColor(Context* ctx, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices);
-static void createDrawCommand_ImagePattern(Context* ctx, ImagePatternHandle handle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices);
-static void createDrawCommand_ColorGradient(Context* ctx, GradientHandle handle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices);
-static void createDrawCommand_Clip(Context* ctx, const float* vtx, uint32_t numVertices, const uint16_t* indices, uint32_t numIndices);
+static void createDrawCommand_VertexColor(Context* ctx, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices);
+static void createDrawCommand_ImagePattern(Context* ctx, ImagePatternHandle handle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices);
+static void createDrawCommand_ColorGradient(Context* ctx, GradientHandle handle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices);
+static void createDrawCommand_Clip(Context* ctx, const float* vtx, uint32_t numVertices, const index_t* indices, uint32_t numIndices);
+static void createDrawCommand_StencilCover(Context* ctx, DrawCommand::Type::Enum type, uint16_t handle, const float* pathVertices, const SubPath* subPaths, uint32_t numSubPaths, uint32_t color, FillRule::Enum fillRule);
+static void premultiplyDrawCommandColors(Context* ctx);
+#if VG_CONFIG_ENABLE_DRAW_COMMAND_MERGING
+static void mergeDrawCommands(Context* ctx);
+#endif
+static void createDrawCommand_Textured(Context* ctx, ImageHandle img, const float* vtx, const uv_t* uv, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices);
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+static void createDrawCommand_Coverage(Context* ctx, const float* vtx, const float* uv, uint32_t numVertices, Color color, const index_t* indices, uint32_t numIndices);
+#endif
+static uint32_t pushDrawTransform(Context* ctx, const float* mtx);
+#if VG_CONFIG_POSITION_INT16
+static void setPosQuantization(Context* ctx, const float* vtx, uint32_t numVertices, const float* mtx);
+static void setPositionDecodeTransform(const float* quant, uint32_t* cacheID);
+static void paintMatrixDecodePositions(const float* paintMtx, const float* quant, float* res);
+static void transformRect(const float* rect, const float* mtx, float* res);
+#endif
+static void submitInstancedMesh(Context* ctx, ImageHandle img, const float* pos, const uv_t* uv, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances, bool colorsAreCoverage);
+static void submitInstancedMeshCPU(Context* ctx, ImageHandle img, const float* pos, const uv_t* uv, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances, bool colorsAreCoverage);
+static uint32_t allocInstances(Context* ctx, uint32_t numInstances);
 
 static ImageHandle allocImage(Context* ctx);
 static void resetImage(Image* img);
+static bool isLayerHandleValid(Context* ctx, LayerHandle handle);
 
-static void renderTextQuads(Context* ctx, const TextQuad* quads, uint32_t numQuads, Color color, ImageHandle img);
+static void renderTextQuads(Context* ctx, const TextQuad* quads, uint32_t numQuads, Color color, ImageHandle img, bool distanceField, float distanceFieldBlur);
 
 static CommandListHandle allocCommandList(Context* ctx);
 static bool isCommandListHandleValid(Context* ctx, CommandListHandle handle);
 static uint8_t* clAllocCommand(Context* ctx, CommandList* cl, CommandType::Enum cmdType, uint32_t dataSize);
 static uint32_t clStoreString(Context* ctx, CommandList* cl, const char* str, uint32_t len);
+static CommandHeader* clFindStrokerCommand(CommandList* cl, uint32_t cmdID);
+static void clInvalidateCommands(Context* ctx, CommandList* cl, uint32_t firstCmdID, uint32_t lastCmdID);
+static uint8_t* clCopyPathCommands(const CommandList* pathList, uint8_t* dst);
+static bool clPrepare(Context* ctx, RecordingShard* shard, PreparedCommandList* prepared, const CommandList* cl, uint32_t depth);
+static bool clCanUsePrepared(Context* ctx, const CommandList* cl);
+static void clFreePrepared(CommandList* cl);
+static void clPreparedAddChild(Context* ctx, PreparedCommandList* prepared, CommandListHandle handle);
+static void clBoundsReset(CommandList* cl);
+static void clBoundsSetFlags(CommandList* cl, uint32_t flags);
+static void clBoundsAddRect(CommandList* cl, float minx, float miny, float maxx, float maxy);
+static void clBoundsAddStroke(CommandList* cl, float width, uint32_t flags);
+static void clBoundsAddChild(Context* ctx, CommandList* cl, CommandListHandle child);
+static void clBoundsStateChanged(CommandList* cl);
+static void clBoundsTransformMult(CommandList* cl, const float* mtx);
+static void clBoundsPushState(Context* ctx, CommandList* cl);
+static void clBoundsPopState(CommandList* cl);
+static bool clIsVisible(Context* ctx, const CommandList* cl);
+static bool clCalcCanvasBounds(Context* ctx, const CommandList* cl, float* bounds);
+static bool clBoundsChildrenValid(Context* ctx, const CommandList* cl, uint32_t depth);
+static void clUpdateDirtyRect(Context* ctx, CommandList* cl);
+static void addDirtyRectMinMax(Context* ctx, const float* rect);
+static void preparedMeshCallback(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors);
+static void submitPreparedCommand(Context* ctx, const PreparedCommandList* prepared, const PreparedCommand* cmd, DrawCommand::Type::Enum type, uint16_t handle);
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
-static void clCacheRender(Context* ctx, CommandList* cl);
+static void clCacheRender(Context* ctx, CommandList* cl, CommandListCache* clCache);
 static void clCacheReset(Context* ctx, CommandListCache* cache);
-static CommandListCache* clGetCache(Context* ctx, CommandList* cl);
+static void clCacheRebuildCommand(Context* ctx, CommandListCache* cache, CachedCommand* cachedCmd, const uint8_t* pathFirstCmd, const CommandHeader* strokerCmdHeader, uint16_t firstGradientID, uint16_t firstImagePatternID);
+static uint32_t clCacheFreeCommandMeshes(bx::AllocatorI* allocator, CachedCommand* cachedCmd);
+static uint32_t clCacheMeshSize(uint32_t numVertices, bool hasCoverage, uint32_t numIndices);
+static void ctxTrimCommandListCaches(Context* ctx);
+static void clCacheInvalidateCommands(Context* ctx, CommandList* cl, uint32_t firstCmdID, uint32_t lastCmdID);
+static void clCacheInvalidateColors(Context* ctx, CommandList* cl);
+static void clCacheUpdateGPUBuffers(Context* ctx, CommandList* cl, CommandListCache* cache);
+static void clCacheDestroyGPUBuffers(CommandListCache* cache);
+static bool submitRetainedCommand(Context* ctx, const CommandListCache* cache, const CachedCommand* cachedCmd);
+static CommandListCache* clGetCache(Context* ctx, CommandList* cl, float avgScale, bool* isCached);
 static CommandListCache* allocCommandListCache(Context* ctx);
 static void freeCommandListCache(Context* ctx, CommandListCache* cache);
 static void pushCommandListCache(Context* ctx, CommandListCache* cache);
@@ -404,8 +871,8 @@ static void popCommandListCache(Context* ctx);
 static CommandListCache* getCommandListCacheStackTop(Context* ctx);
 static void beginCachedCommand(Context* ctx);
 static void endCachedCommand(Context* ctx);
-static void addCachedCommand(Context* ctx, const float* pos, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices);
-static void submitCachedMesh(Context* ctx, Color col, const CachedMesh* meshList, uint32_t numMeshes);
+static void addCachedCommand(Context* ctx, const float* pos, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices);
+static void submitCachedMesh(Context* ctx, Color col, const CachedMesh* meshList, uint32_t numMeshes, bool gpuTransform);
 static void submitCachedMesh(Context* ctx, GradientHandle gradientHandle, const CachedMesh* meshList, uint32_t numMeshes);
 static void submitCachedMesh(Context* ctx, ImagePatternHandle imgPatter, Color color, const CachedMesh* meshList, uint32_t numMeshes);
 #endif
@@ -424,12 +891,20 @@ static void ctxCircle(Context* ctx, float cx, float cy, float radius);
 static void ctxEllipse(Context* ctx, float cx, float cy, float rx, float ry);
 static void ctxPolyline(Context* ctx, const float* coords, uint32_t numPoints);
 static void ctxClosePath(Context* ctx);
+static void ctxFillPath(Context* ctx, DrawCommand::Type::Enum paintType, uint16_t paintHandle, Color color, uint32_t flags);
+static void ctxStrokePath(Context* ctx, DrawCommand::Type::Enum paintType, uint16_t paintHandle, Color color, float width, uint32_t flags);
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+static void ctxFillPathAnalyticAA(Context* ctx, const State* state, Color color, uint32_t flags);
+static void ctxStrokePathAnalyticAA(Context* ctx, const State* state, Color color, float width, uint32_t flags);
+#endif
 static void ctxFillPathColor(Context* ctx, Color color, uint32_t flags);
 static void ctxFillPathGradient(Context* ctx, GradientHandle gradientHandle, uint32_t flags);
 static void ctxFillPathImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, Color color, uint32_t flags);
 static void ctxStrokePathColor(Context* ctx, Color color, float width, uint32_t flags);
 static void ctxStrokePathGradient(Context* ctx, GradientHandle gradientHandle, float width, uint32_t flags);
 static void ctxStrokePathImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, Color color, float width, uint32_t flags);
+static void ctxExecPathCommand(Context* ctx, CommandType::Enum type, const uint8_t* cmd);
+static void ctxExecStrokerCommand(Context* ctx, CommandType::Enum type, const uint8_t* cmd, uint16_t firstGradientID, uint16_t firstImagePatternID);
 static void ctxBeginClip(Context* ctx, ClipRule::Enum rule);
 static void ctxEndClip(Context* ctx);
 static void ctxResetClip(Context* ctx);
@@ -448,10 +923,15 @@ static void ctxTransformTranslate(Context* ctx, float x, float y);
 static void ctxTransformRotate(Context* ctx, float ang_rad);
 static void ctxTransformMult(Context* ctx, const float* mtx, TransformOrder::Enum order);
 static void ctxSetViewBox(Context* ctx, float x, float y, float w, float h);
-static void ctxIndexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, ImageHandle img);
+static void ctxIndexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img);
+static void ctxFillPathInstanced(Context* ctx, Color color, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
+static void ctxStrokePathInstanced(Context* ctx, Color color, float width, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
+static void ctxIndexedTriListInstanced(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances);
 static void ctxText(Context* ctx, const TextConfig& cfg, float x, float y, const char* str, const char* end);
 static void ctxTextBox(Context* ctx, const TextConfig& cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textboxFlags);
 static void ctxSubmitCommandList(Context* ctx, CommandListHandle handle);
+static bool ctxBeginLayer(Context* ctx, LayerHandle handle, uint16_t viewID);
+static void ctxEndLayer(Context* ctx);
 
 #define CMD_WRITE(ptr, type, value) *(type*)(ptr) = (value); ptr += sizeof(type)
 #define CMD_READ(ptr, type) *(type*)(ptr); ptr += sizeof(type)
@@ -469,6 +949,37 @@ inline bool isAligned(uint32_t sz, uint32_t alignment)
 	return (sz & (alignment - 1)) == 0;
 }
 
+// Intersects a scissor rect (x, y, w, h) with the redraw rect of the frame. Returns false if
+// the intersection is empty.
+inline bool intersectRedrawRect(const uint16_t* scissor, const uint16_t* redrawRect, uint16_t* result)
+{
+	const uint16_t minx = bx::max<uint16_t>(scissor[0], redrawRect[0]);
+	const uint16_t miny = bx::max<uint16_t>(scissor[1], redrawRect[1]);
+	const uint16_t maxx = bx::min<uint16_t>(scissor[0] + scissor[2], redrawRect[0] + redrawRect[2]);
+	const uint16_t maxy = bx::min<uint16_t>(scissor[1] + scissor[3], redrawRect[1] + redrawRect[3]);
+	if (minx >= maxx || miny >= maxy) {
+		return false;
+	}
+
+	result[0] = minx;
+	result[1] = miny;
+	result[2] = maxx - minx;
+	result[3] = maxy - miny;
+	return true;
+}
+
+// Sets the scissor rect (x, y, w, h) of the next draw call. Reuses bgfx's cached rect if it's the
+// same as the previous one.
+inline void setDrawScissor(const uint16_t* rect, float devicePixelRatio, uint16_t* prevRect, uint16_t* prevID)
+{
+	if (!bx::memCmp(rect, prevRect, sizeof(uint16_t) * 4)) {
+		bgfx::setScissor(*prevID);
+	} else {
+		*prevID = bgfx::setScissor(rect[0] * devicePixelRatio, rect[1] * devicePixelRatio, rect[2] * devicePixelRatio, rect[3] * devicePixelRatio);
+		bx::memCopy(prevRect, rect, sizeof(uint16_t) * 4);
+	}
+}
+
 static const uint32_t kAlignedCommandHeaderSize = alignSize(sizeof(CommandHeader), VG_CONFIG_COMMAND_LIST_ALIGNMENT);
 
 inline bool isLocal(uint16_t handleFlags)      { return (handleFlags & HandleFlags::LocalHandle) != 0; }
@@ -489,12 +1000,22 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 		256,                         // m_MaxCommandLists
 		65536,                       // m_MaxVBVertices
 		ImageFlags::Filter_Bilinear, // m_FontAtlasImageFlags
-		16                           // m_MaxCommandListDepth
+		16,                          // m_MaxCommandListDepth
+		1,                           // m_NumRecordingShards
+		4,                           // m_MaxCachedLODs
+		0.1f,                        // m_CacheScaleTolerance
+		64 << 20,                    // m_MaxCacheMemory
+		8,                           // m_MaxLayers
+		GlyphRasterization::Immediate // m_GlyphRasterization
 	};
 
 	const ContextConfig* cfg = userCfg ? userCfg : &defaultConfig;
 
-	VG_CHECK(cfg->m_MaxVBVertices <= 65536, "Vertex buffers cannot be larger than 64k vertices because indices are always uint16");
+#if !VG_CONFIG_INDEX_UINT32
+	VG_CHECK(cfg->m_MaxVBVertices <= 65536, "Vertex buffers cannot be larger than 64k vertices with 16-bit indices (see VG_CONFIG_INDEX_UINT32)");
+#endif
+
+	const uint32_t numRecordingShards = bx::max<uint32_t>(cfg->m_NumRecordingShards, 1);
 
 	const uint32_t alignment = 16;
 	const uint32_t totalMem = 0
@@ -502,7 +1023,9 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 		+ alignSize(sizeof(Gradient) * cfg->m_MaxGradients, alignment)
 		+ alignSize(sizeof(ImagePattern) * cfg->m_MaxImagePatterns, alignment)
 		+ alignSize(sizeof(State) * cfg->m_MaxStateStackSize, alignment)
-		+ alignSize(sizeof(CommandList) * cfg->m_MaxCommandLists, alignment);
+		+ alignSize(sizeof(CommandList) * cfg->m_MaxCommandLists, alignment)
+		+ alignSize(sizeof(Layer) * cfg->m_MaxLayers, alignment)
+		+ alignSize(sizeof(RecordingShard) * numRecordingShards, alignment);
 
 	uint8_t* mem = (uint8_t*)bx::alignedAlloc(allocator, totalMem, alignment);
 	bx::memSet(mem, 0, totalMem);
@@ -512,9 +1035,16 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 	ctx->m_ImagePatterns = (ImagePattern*)mem; mem += alignSize(sizeof(ImagePattern) * cfg->m_MaxImagePatterns, alignment);
 	ctx->m_StateStack = (State*)mem;           mem += alignSize(sizeof(State) * cfg->m_MaxStateStackSize, alignment);
 	ctx->m_CmdLists = (CommandList*)mem;       mem += alignSize(sizeof(CommandList) * cfg->m_MaxCommandLists, alignment);
+	ctx->m_Layers = (Layer*)mem;               mem += alignSize(sizeof(Layer) * cfg->m_MaxLayers, alignment);
+	ctx->m_RecordingShards = (RecordingShard*)mem; mem += alignSize(sizeof(RecordingShard) * numRecordingShards, alignment);
 
 	bx::memCopy(&ctx->m_Config, cfg, sizeof(ContextConfig));
+	ctx->m_Config.m_NumRecordingShards = numRecordingShards;
+	ctx->m_Config.m_MaxCachedLODs = bx::max<uint32_t>(cfg->m_MaxCachedLODs, 1);
 	ctx->m_Allocator = allocator;
+	for (uint32_t i = 0; i < numRecordingShards; ++i) {
+		ctx->m_RecordingShards[i].m_Allocator = allocator;
+	}
 	ctx->m_ViewID = 0;
 	ctx->m_DevicePixelRatio = 1.0f;
 	ctx->m_TesselationTolerance = 0.25f;
@@ -528,18 +1058,17 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 	ctx->m_CmdListCacheStackTop = ~0u;
 #endif
 
-	ctx->m_PosBufferPool = BX_NEW(allocator, vgutil::PoolAllocator)(sizeof(float) * 2 * ctx->m_Config.m_MaxVBVertices, 4, allocator);
-	ctx->m_ColorBufferPool = BX_NEW(allocator, vgutil::PoolAllocator)(sizeof(uint32_t) * ctx->m_Config.m_MaxVBVertices, 4, allocator);
-	ctx->m_UVBufferPool = BX_NEW(allocator, vgutil::PoolAllocator)(sizeof(uv_t) * 2 * ctx->m_Config.m_MaxVBVertices, 4, allocator);
+	ctx->m_FreeVertexBufferDataList = UINT32_MAX;
+	ctx->m_FreeIndexBufferList = UINT32_MAX;
+	ctx->m_VBVertexCapacity = bx::min<uint32_t>(VG_CONFIG_MIN_VB_VERTICES, ctx->m_Config.m_MaxVBVertices);
+	ctx->m_VBUsageHistoryPos = 0;
 
-#if BX_CONFIG_SUPPORTS_THREADING
-	ctx->m_DataPoolMutex = BX_NEW(allocator, bx::Mutex)();
-#endif
-	ctx->m_Path = createPath(allocator);
-	ctx->m_Stroker = createStroker(allocator);
+	tessInit(&ctx->m_Tessellator, allocator);
 
 	ctx->m_ImageHandleAlloc = bx::createHandleAlloc(allocator, cfg->m_MaxImages);
 	ctx->m_CmdListHandleAlloc = bx::createHandleAlloc(allocator, cfg->m_MaxCommandLists);
+	ctx->m_LayerHandleAlloc = bx::createHandleAlloc(allocator, cfg->m_MaxLayers);
+	ctx->m_ActiveLayerID = kMainLayerID;
 
 	// bgfx setup
 	ctx->m_PosVertexDecl.begin().add(bgfx::Attrib::Position, 2, bgfx::AttribType::Float).end();
@@ -549,6 +1078,26 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 #else
 	ctx->m_UVVertexDecl.begin().add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float).end();
 #endif
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	ctx->m_VertexDecl.begin()
+#if VG_CONFIG_POSITION_INT16
+		.add(bgfx::Attrib::Position, 2, bgfx::AttribType::Int16)
+#else
+		.add(bgfx::Attrib::Position, 2, bgfx::AttribType::Float)
+#endif
+#if VG_CONFIG_UV_INT16
+		.add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Int16, true)
+#else
+		.add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float)
+#endif
+		.add(bgfx::Attrib::Color0, 4, bgfx::AttribType::Uint8, true)
+		.end();
+	VG_CHECK(ctx->m_VertexDecl.getStride() == sizeof(Vertex), "Vertex layout doesn't match the Vertex struct");
+#elif VG_CONFIG_POSITION_INT16
+	// NOTE: Not normalized. The vertex shader gets the fixed point values as floats and the model
+	// matrix set in end() scales them back to canvas space.
+	ctx->m_QuantizedPosVertexDecl.begin().add(bgfx::Attrib::Position, 2, bgfx::AttribType::Int16).end();
+#endif
 
 	// NOTE: A couple of shaders can be shared between programs. Since bgfx
 	// cares only whether the program handle changed and not (at least the D3D11 backend
@@ -574,11 +1123,38 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 		bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "fs_stencil"),
 		true);
 
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+	ctx->m_ProgramHandle[DrawCommand::Type::Coverage] = bgfx::createProgram(
+		bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "vs_textured"),
+		bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "fs_coverage"),
+		true);
+#else
+	ctx->m_ProgramHandle[DrawCommand::Type::Coverage] = BGFX_INVALID_HANDLE;
+#endif
+
+#if VG_CONFIG_ENABLE_SDF_TEXT
+	ctx->m_ProgramHandle[DrawCommand::Type::TextSDF] = bgfx::createProgram(
+		bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "vs_textured"),
+		bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "fs_text_sdf"),
+		true);
+#else
+	ctx->m_ProgramHandle[DrawCommand::Type::TextSDF] = BGFX_INVALID_HANDLE;
+#endif
+
+	ctx->m_InstancedProgramHandle = BGFX_INVALID_HANDLE;
+	if ((bgfx::getCaps()->supported & BGFX_CAPS_INSTANCING) != 0) {
+		ctx->m_InstancedProgramHandle = bgfx::createProgram(
+			bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "vs_textured_instanced"),
+			bgfx::createEmbeddedShader(s_EmbeddedShaders, bgfxRendererType, "fs_textured"),
+			true);
+	}
+
 	ctx->m_TexUniform = bgfx::createUniform("s_tex", bgfx::UniformType::Sampler, 1);
 	ctx->m_PaintMatUniform = bgfx::createUniform("u_paintMat", bgfx::UniformType::Mat3, 1);
 	ctx->m_ExtentRadiusFeatherUniform = bgfx::createUniform("u_extentRadiusFeather", bgfx::UniformType::Vec4, 1);
 	ctx->m_InnerColorUniform = bgfx::createUniform("u_innerCol", bgfx::UniformType::Vec4, 1);
 	ctx->m_OuterColorUniform = bgfx::createUniform("u_outerCol", bgfx::UniformType::Vec4, 1);
+	ctx->m_SDFParamsUniform = bgfx::createUniform("u_sdfParams", bgfx::UniformType::Vec4, 1);
 
 	// Initialize font system
 	const bgfx::Caps* caps = bgfx::getCaps();
@@ -587,6 +1163,7 @@ Context* createContext(bx::AllocatorI* allocator, const ContextConfig* userCfg)
 	fsCfg.m_AtlasHeight = VG_CONFIG_MIN_FONT_ATLAS_SIZE;
 	fsCfg.m_Flags = FontSystemFlags::Origin_TopLeft;
 	fsCfg.m_FontAtlasImageFlags = cfg->m_FontAtlasImageFlags;
+	fsCfg.m_GlyphRasterization = cfg->m_GlyphRasterization;
 	// NOTE: White rect might get too large but since the atlas limit is the texture size limit
 	// it should be that large. Otherwise shapes cached when the atlas was 512x512 will get wrong
 	// white pixel UVs when the atlas gets to the texture size limit (should not happen but better
@@ -614,26 +1191,20 @@ void destroyContext(Context* ctx)
 		}
 	}
 
+	if (bgfx::isValid(ctx->m_InstancedProgramHandle)) {
+		bgfx::destroy(ctx->m_InstancedProgramHandle);
+		ctx->m_InstancedProgramHandle = BGFX_INVALID_HANDLE;
+	}
+
 	bgfx::destroy(ctx->m_TexUniform);
 	bgfx::destroy(ctx->m_PaintMatUniform);
 	bgfx::destroy(ctx->m_ExtentRadiusFeatherUniform);
 	bgfx::destroy(ctx->m_InnerColorUniform);
 	bgfx::destroy(ctx->m_OuterColorUniform);
+	bgfx::destroy(ctx->m_SDFParamsUniform);
 
 	for (uint32_t i = 0; i < ctx->m_VertexBufferCapacity; ++i) {
-		GPUVertexBuffer* vb = &ctx->m_GPUVertexBuffers[i];
-		if (bgfx::isValid(vb->m_PosBufferHandle)) {
-			bgfx::destroy(vb->m_PosBufferHandle);
-			vb->m_PosBufferHandle = BGFX_INVALID_HANDLE;
-		}
-		if (bgfx::isValid(vb->m_UVBufferHandle)) {
-			bgfx::destroy(vb->m_UVBufferHandle);
-			vb->m_UVBufferHandle = BGFX_INVALID_HANDLE;
-		}
-		if (bgfx::isValid(vb->m_ColorBufferHandle)) {
-			bgfx::destroy(vb->m_ColorBufferHandle);
-			vb->m_ColorBufferHandle = BGFX_INVALID_HANDLE;
-		}
+		destroyGPUVertexBuffer(&ctx->m_GPUVertexBuffers[i]);
 	}
 	bx::free(allocator, ctx->m_GPUVertexBuffers);
 	bx::free(allocator, ctx->m_VertexBuffers);
@@ -661,24 +1232,41 @@ void destroyContext(Context* ctx)
 	ctx->m_IndexBuffers = nullptr;
 	ctx->m_ActiveIndexBufferID = UINT16_MAX;
 
-	if (ctx->m_UVBufferPool) {
-		bx::deleteObject(allocator, ctx->m_UVBufferPool);
-		ctx->m_UVBufferPool = nullptr;
+	for (uint32_t i = 0; i < ctx->m_NumVertexBufferData; ++i) {
+		VertexBufferData* data = &ctx->m_VertexBufferData[i];
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+		bx::alignedFree(allocator, data->m_Vertices, 16);
+#else
+		bx::alignedFree(allocator, data->m_Pos, 16);
+		bx::alignedFree(allocator, data->m_Color, 16);
+		bx::alignedFree(allocator, data->m_UV, 16);
+#endif
 	}
+	bx::free(allocator, ctx->m_VertexBufferData);
+	ctx->m_VertexBufferData = nullptr;
+	ctx->m_NumVertexBufferData = 0;
 
-	if (ctx->m_ColorBufferPool) {
-		bx::deleteObject(allocator, ctx->m_ColorBufferPool);
-		ctx->m_ColorBufferPool = nullptr;
+	for (uint32_t i = 0; i < ctx->m_NumBufferRefs; ++i) {
+		bx::free(allocator, ctx->m_BufferRefs[i]);
 	}
-
-	if (ctx->m_PosBufferPool) {
-		bx::deleteObject(allocator, ctx->m_PosBufferPool);
-		ctx->m_PosBufferPool = nullptr;
- 	}
+	bx::free(allocator, ctx->m_BufferRefs);
+	ctx->m_BufferRefs = nullptr;
+	ctx->m_NumBufferRefs = 0;
+	ctx->m_FreeVertexBufferDataList = UINT32_MAX;
+	ctx->m_FreeIndexBufferList = UINT32_MAX;
 
 	bx::free(allocator, ctx->m_DrawCommands);
 	ctx->m_DrawCommands = nullptr;
 
+	bx::free(allocator, ctx->m_RetainedDraws);
+	ctx->m_RetainedDraws = nullptr;
+
+	bx::free(allocator, ctx->m_DrawTransforms);
+	ctx->m_DrawTransforms = nullptr;
+
+	bx::free(allocator, ctx->m_InstanceData);
+	ctx->m_InstanceData = nullptr;
+
 	bx::free(allocator, ctx->m_ClipCommands);
 	ctx->m_ClipCommands = nullptr;
 
@@ -687,6 +1275,15 @@ void destroyContext(Context* ctx)
 		ctx->m_FontSystem = nullptr;
 	}
 
+	// NOTE: Layer images don't own their textures so layers should be destroyed before the images.
+	const uint16_t numLayers = ctx->m_LayerHandleAlloc->getNumHandles();
+	for (uint16_t i = numLayers; i > 0; --i) {
+		const LayerHandle layer = { ctx->m_LayerHandleAlloc->getHandles()[i - 1] };
+		destroyLayer(ctx, layer);
+	}
+	bx::destroyHandleAlloc(allocator, ctx->m_LayerHandleAlloc);
+	ctx->m_LayerHandleAlloc = nullptr;
+
 	for (uint32_t i = 0; i < ctx->m_ImageCapacity; ++i) {
 		Image* img = &ctx->m_Images[i];
 		if (bgfx::isValid(img->m_bgfxHandle)) {
@@ -702,22 +1299,21 @@ void destroyContext(Context* ctx)
 	bx::destroyHandleAlloc(allocator, ctx->m_CmdListHandleAlloc);
 	ctx->m_CmdListHandleAlloc = nullptr;
 
-	destroyPath(ctx->m_Path);
-	ctx->m_Path = nullptr;
+	tessShutdown(&ctx->m_Tessellator);
 
-	destroyStroker(ctx->m_Stroker);
-	ctx->m_Stroker = nullptr;
+	const uint32_t numRecordingShards = ctx->m_Config.m_NumRecordingShards;
+	for (uint32_t i = 0; i < numRecordingShards; ++i) {
+		RecordingShard* shard = &ctx->m_RecordingShards[i];
+		if (shard->m_Tessellator.m_Allocator) {
+			bx::free(shard->m_Tessellator.m_Allocator, shard->m_StateStack);
+			shard->m_StateStack = nullptr;
+			tessShutdown(&shard->m_Tessellator);
+		}
+	}
 
 	bx::alignedFree(allocator, ctx->m_TextVertices, 16);
 	ctx->m_TextVertices = nullptr;
 
-	bx::alignedFree(allocator, ctx->m_TransformedVertices, 16);
-	ctx->m_TransformedVertices = nullptr;
-
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::deleteObject(allocator, ctx->m_DataPoolMutex);
-#endif
-
 	bx::alignedFree(allocator, ctx, 16);
 }
 
@@ -730,6 +1326,15 @@ void begin(Context* ctx, uint16_t viewID, uint16_t canvasWidth, uint16_t canvasH
 	ctx->m_TesselationTolerance = 0.25f / devicePixelRatio;
 	ctx->m_FringeWidth = 1.0f / devicePixelRatio;
 	ctx->m_SubmitCmdListRecursionDepth = 0;
+	ctx->m_ActivePreparedCmdList = nullptr;
+	ctx->m_DirtyFrameID++;
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	ctx->m_CmdListCacheFrameClock = ctx->m_CmdListCacheClock;
+#endif
+
+#if VG_CONFIG_POSITION_INT16
+	VG_CHECK((float)canvasWidth <= 32768.0f / VG_POSITION_SCALE && (float)canvasHeight <= 32768.0f / VG_POSITION_SCALE, "Canvas too large for VG_CONFIG_POSITION_INT16_FRAC_BITS fractional bits");
+#endif
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
 	ctx->m_CmdListCacheStackTop = ~0u;
@@ -746,8 +1351,16 @@ void begin(Context* ctx, uint16_t viewID, uint16_t canvasWidth, uint16_t canvasH
 	VG_CHECK(ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID].m_Count == 0, "Not empty index buffer");
 
 	ctx->m_NumDrawCommands = 0;
+	ctx->m_NumRetainedDraws = 0;
+	ctx->m_NumDrawTransforms = 0;
+	ctx->m_ActiveDrawTransformID = UINT32_MAX;
+	ctx->m_NumInstances = 0;
 	ctx->m_ForceNewDrawCommand = true;
 
+	ctx->m_LayerStackTop = 0;
+	ctx->m_ActiveLayerID = kMainLayerID;
+	ctx->m_HasLayerCommands = false;
+
 	ctx->m_NumClipCommands = 0;
 	ctx->m_ForceNewClipCommand = true;
 	ctx->m_ClipState.m_FirstCmdID = ~0u;
@@ -762,15 +1375,87 @@ void end(Context* ctx)
 {
 	VG_CHECK(ctx->m_StateStackTop == 0, "pushState()/popState() mismatch");
 	VG_CHECK(!isValid(ctx->m_ActiveCommandList), "endCommandList() hasn't been called");
+	VG_CHECK(ctx->m_LayerStackTop == 0, "beginLayer()/endLayer() mismatch");
+
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	ctxTrimCommandListCaches(ctx);
+#endif
+
+	// NOTE: Before merging, which makes commands span the vertices of the commands between them.
+	premultiplyDrawCommandColors(ctx);
+
+#if VG_CONFIG_ENABLE_DRAW_COMMAND_MERGING
+	mergeDrawCommands(ctx);
+#endif
+
+	// Copy the glyphs rasterized by rasterizeGlyphs() to the font atlas. Has to happen even if
+	// nothing is drawn this frame because their atlas rects are already in use.
+	fsResolveGlyphJobs(ctx->m_FontSystem);
+
+	// Command lists submitted by the previous frame but not by this one leave their area behind.
+	if (ctx->m_DirtyRectTracking) {
+		const uint32_t prevFrameID = ctx->m_DirtyFrameID - 1;
+		const uint16_t numCmdLists = ctx->m_CmdListHandleAlloc->getNumHandles();
+		const uint16_t* cmdListHandles = ctx->m_CmdListHandleAlloc->getHandles();
+		for (uint16_t i = 0; i < numCmdLists; ++i) {
+			const CommandList* cl = &ctx->m_CmdLists[cmdListHandles[i]];
+			if (cl->m_DirtyFrameID != 0 && cl->m_DirtyFrameID == prevFrameID) {
+				addDirtyRectMinMax(ctx, cl->m_DirtyBounds);
+			}
+		}
+	}
+
+	// Area of the canvas to render. Everything outside it is expected to still hold the previous
+	// frame when dirty rect tracking is enabled.
+	const uint16_t canvasWidth = ctx->m_CanvasWidth;
+	const uint16_t canvasHeight = ctx->m_CanvasHeight;
+	uint16_t* redrawRect = ctx->m_RedrawRect;
+	redrawRect[0] = 0;
+	redrawRect[1] = 0;
+	redrawRect[2] = canvasWidth;
+	redrawRect[3] = canvasHeight;
+	if (ctx->m_DirtyRectTracking) {
+		if (ctx->m_DirtyCanvasSize[0] == canvasWidth && ctx->m_DirtyCanvasSize[1] == canvasHeight) {
+			if (ctx->m_HasDirtyRect) {
+				const float* dirtyRect = ctx->m_DirtyRect;
+				const int32_t minx = bx::clamp<int32_t>((int32_t)bx::floor(dirtyRect[0]), 0, canvasWidth);
+				const int32_t miny = bx::clamp<int32_t>((int32_t)bx::floor(dirtyRect[1]), 0, canvasHeight);
+				const int32_t maxx = bx::clamp<int32_t>((int32_t)bx::ceil(dirtyRect[2]), minx, canvasWidth);
+				const int32_t maxy = bx::clamp<int32_t>((int32_t)bx::ceil(dirtyRect[3]), miny, canvasHeight);
+				redrawRect[0] = (uint16_t)minx;
+				redrawRect[1] = (uint16_t)miny;
+				redrawRect[2] = (uint16_t)(maxx - minx);
+				redrawRect[3] = (uint16_t)(maxy - miny);
+			} else {
+				redrawRect[2] = 0;
+				redrawRect[3] = 0;
+			}
+		}
+
+		ctx->m_DirtyCanvasSize[0] = canvasWidth;
+		ctx->m_DirtyCanvasSize[1] = canvasHeight;
+		ctx->m_HasDirtyRect = false;
+	}
 
 	const uint32_t numDrawCommands = ctx->m_NumDrawCommands;
-	if (numDrawCommands == 0) {
-		// Release the vertex buffer allocated in beginFrame()
-		VertexBuffer* vb = &ctx->m_VertexBuffers[ctx->m_FirstVertexBufferID];
+	if (numDrawCommands == 0 || ((redrawRect[2] == 0 || redrawRect[3] == 0) && !ctx->m_HasLayerCommands)) {
+		// Release the vertex and index buffers allocated since begin()
+		const uint32_t numVertexBuffers = ctx->m_NumVertexBuffers;
+		for (uint32_t iVB = ctx->m_FirstVertexBufferID; iVB < numVertexBuffers; ++iVB) {
+			VertexBuffer* vb = &ctx->m_VertexBuffers[iVB];
+			pushBufferRef(vb->m_Ref);
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+			vb->m_Vertices = nullptr;
+#else
+			vb->m_Pos = nullptr;
+			vb->m_UV = nullptr;
+			vb->m_Color = nullptr;
+#endif
+			vb->m_Ref = nullptr;
+		}
 
-		bx::free(ctx->m_PosBufferPool, vb->m_Pos);
-		bx::free(ctx->m_ColorBufferPool, vb->m_Color);
-		bx::free(ctx->m_UVBufferPool, vb->m_UV);
+		IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+		pushBufferRef(ib->m_Ref);
 
 		return;
 	}
@@ -783,20 +1468,62 @@ void end(Context* ctx)
 		VertexBuffer* vb = &ctx->m_VertexBuffers[iVB];
 		GPUVertexBuffer* gpuvb = &ctx->m_GPUVertexBuffers[iVB];
 
-		const uint32_t maxVBVertices = ctx->m_Config.m_MaxVBVertices;
+		// Recreate GPU buffers which are much larger than what recent frames needed. Otherwise
+		// bgfx grows them on update if needed.
+		const uint32_t gpuCapacity = bx::max<uint32_t>(ctx->m_VBVertexCapacity, vb->m_Count);
+		if (gpuvb->m_Capacity > gpuCapacity * 2) {
+			destroyGPUVertexBuffer(gpuvb);
+		}
+		gpuvb->m_Capacity = bx::max<uint32_t>(gpuvb->m_Capacity, gpuCapacity);
+
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+		// Skip the upload if the GPU buffers already hold the same vertices (e.g. static UI). The
+		// data is released immediately since bgfx won't reference it.
+		BufferContent vbContent;
+		vbCalcContent(vb, &vbContent);
+		if (vb->m_Count != 0 && !bx::memCmp(&gpuvb->m_Content, &vbContent, sizeof(BufferContent))) {
+			pushBufferRef(vb->m_Ref);
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+			vb->m_Vertices = nullptr;
+#else
+			vb->m_Pos = nullptr;
+			vb->m_UV = nullptr;
+			vb->m_Color = nullptr;
+#endif
+			vb->m_Ref = nullptr;
+			continue;
+		}
+
+		bx::memCopy(&gpuvb->m_Content, &vbContent, sizeof(BufferContent));
+#endif
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+		if (!bgfx::isValid(gpuvb->m_bgfxHandle)) {
+			gpuvb->m_bgfxHandle = bgfx::createDynamicVertexBuffer(gpuCapacity, ctx->m_VertexDecl, BGFX_BUFFER_ALLOW_RESIZE);
+		}
+
+		const bgfx::Memory* vertexMem = bgfx::makeRef(vb->m_Vertices, sizeof(Vertex) * vb->m_Count, releaseBufferCallback, vb->m_Ref);
+		bgfx::update(gpuvb->m_bgfxHandle, 0, vertexMem);
+
+		vb->m_Vertices = nullptr;
+#else
 		if (!bgfx::isValid(gpuvb->m_PosBufferHandle)) {
-			gpuvb->m_PosBufferHandle = bgfx::createDynamicVertexBuffer(maxVBVertices, ctx->m_PosVertexDecl, 0);
+#if VG_CONFIG_POSITION_INT16
+			gpuvb->m_PosBufferHandle = bgfx::createDynamicVertexBuffer(gpuCapacity, ctx->m_QuantizedPosVertexDecl, BGFX_BUFFER_ALLOW_RESIZE);
+#else
+			gpuvb->m_PosBufferHandle = bgfx::createDynamicVertexBuffer(gpuCapacity, ctx->m_PosVertexDecl, BGFX_BUFFER_ALLOW_RESIZE);
+#endif
 		}
 		if (!bgfx::isValid(gpuvb->m_UVBufferHandle)) {
-			gpuvb->m_UVBufferHandle = bgfx::createDynamicVertexBuffer(maxVBVertices, ctx->m_UVVertexDecl, 0);
+			gpuvb->m_UVBufferHandle = bgfx::createDynamicVertexBuffer(gpuCapacity, ctx->m_UVVertexDecl, BGFX_BUFFER_ALLOW_RESIZE);
 		}
 		if (!bgfx::isValid(gpuvb->m_ColorBufferHandle)) {
-			gpuvb->m_ColorBufferHandle = bgfx::createDynamicVertexBuffer(maxVBVertices, ctx->m_ColorVertexDecl, 0);
+			gpuvb->m_ColorBufferHandle = bgfx::createDynamicVertexBuffer(gpuCapacity, ctx->m_ColorVertexDecl, BGFX_BUFFER_ALLOW_RESIZE);
 		}
 
-		const bgfx::Memory* posMem = bgfx::makeRef(vb->m_Pos, sizeof(float) * 2 * vb->m_Count, releaseVertexBufferPosCallback, ctx);
-		const bgfx::Memory* colorMem = bgfx::makeRef(vb->m_Color, sizeof(uint32_t) * vb->m_Count, releaseVertexBufferColorCallback, ctx);
-		const bgfx::Memory* uvMem = bgfx::makeRef(vb->m_UV, sizeof(uv_t) * 2 * vb->m_Count, releaseVertexBufferUVCallback, ctx);
+		const bgfx::Memory* posMem = bgfx::makeRef(vb->m_Pos, sizeof(pos_t) * 2 * vb->m_Count, releaseBufferCallback, vb->m_Ref);
+		const bgfx::Memory* colorMem = bgfx::makeRef(vb->m_Color, sizeof(uint32_t) * vb->m_Count, releaseBufferCallback, vb->m_Ref);
+		const bgfx::Memory* uvMem = bgfx::makeRef(vb->m_UV, sizeof(uv_t) * 2 * vb->m_Count, releaseBufferCallback, vb->m_Ref);
 
 		bgfx::update(gpuvb->m_PosBufferHandle, 0, posMem);
 		bgfx::update(gpuvb->m_UVBufferHandle, 0, uvMem);
@@ -805,21 +1532,34 @@ void end(Context* ctx)
 		vb->m_Pos = nullptr;
 		vb->m_UV = nullptr;
 		vb->m_Color = nullptr;
+#endif
+		vb->m_Ref = nullptr;
 	}
 
 	// Update bgfx index buffer...
 	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
 	GPUIndexBuffer* gpuib = &ctx->m_GPUIndexBuffers[ctx->m_ActiveIndexBufferID];
-	const bgfx::Memory* indexMem = bgfx::makeRef(&ib->m_Indices[0], sizeof(uint16_t) * ib->m_Count, releaseIndexBufferCallback, ctx);
-	if (!bgfx::isValid(gpuib->m_bgfxHandle)) {
-		gpuib->m_bgfxHandle = bgfx::createDynamicIndexBuffer(indexMem, BGFX_BUFFER_ALLOW_RESIZE);
-	} else {
-		bgfx::update(gpuib->m_bgfxHandle, 0, indexMem);
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+	BufferContent ibContent;
+	ibCalcContent(ib, &ibContent);
+	if (bgfx::isValid(gpuib->m_bgfxHandle) && ib->m_Count != 0 && !bx::memCmp(&gpuib->m_Content, &ibContent, sizeof(BufferContent))) {
+		pushBufferRef(ib->m_Ref);
+	} else
+#endif
+	{
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+		bx::memCopy(&gpuib->m_Content, &ibContent, sizeof(BufferContent));
+#endif
+
+		const bgfx::Memory* indexMem = bgfx::makeRef(&ib->m_Indices[0], sizeof(index_t) * ib->m_Count, releaseBufferCallback, ib->m_Ref);
+		if (!bgfx::isValid(gpuib->m_bgfxHandle)) {
+			gpuib->m_bgfxHandle = bgfx::createDynamicIndexBuffer(indexMem, BGFX_BUFFER_ALLOW_RESIZE | VG_INDEX_BUFFER_FLAGS);
+		} else {
+			bgfx::update(gpuib->m_bgfxHandle, 0, indexMem);
+		}
 	}
 
 	const uint16_t viewID = ctx->m_ViewID;
-	const uint16_t canvasWidth = ctx->m_CanvasWidth;
-	const uint16_t canvasHeight = ctx->m_CanvasHeight;
 	const float devicePixelRatio = ctx->m_DevicePixelRatio;
 
 	float viewMtx[16];
@@ -833,9 +1573,22 @@ void end(Context* ctx)
 	uint32_t prevClipCmdID = UINT32_MAX;
 	uint32_t stencilState = BGFX_STENCIL_NONE;
 	uint8_t nextStencilValue = 1;
+#if VG_CONFIG_POSITION_INT16
+	uint32_t posDecodeMtxCacheID = UINT32_MAX;
+#endif
+
+	// Layers are rendered in full; only the view passed to begin() is limited to the redraw rect.
+	static const uint16_t kLayerRedrawRect[4] = { 0, 0, UINT16_MAX, UINT16_MAX };
 
 	for (uint32_t iCmd = 0; iCmd < numDrawCommands; ++iCmd) {
 		DrawCommand* cmd = &ctx->m_DrawCommands[iCmd];
+		if (cmd->m_LayerID == kDiscardLayerID) {
+			continue;
+		}
+
+		const bool isLayerCmd = cmd->m_LayerID != kMainLayerID;
+		const uint16_t cmdViewID = isLayerCmd ? ctx->m_Layers[cmd->m_LayerID].m_ViewID : viewID;
+		const uint16_t* cmdRedrawRect = isLayerCmd ? &kLayerRedrawRect[0] : redrawRect;
 
 		const ClipState* cmdClipState = &cmd->m_ClipState;
 		if (cmdClipState->m_FirstCmdID != prevClipCmdID) {
@@ -847,20 +1600,23 @@ void end(Context* ctx)
 
 					DrawCommand* clipCmd = &ctx->m_ClipCommands[cmdClipState->m_FirstCmdID + iClip];
 
+					uint16_t cmdScissorRect[4];
+					if (!intersectRedrawRect(clipCmd->m_ScissorRect, cmdRedrawRect, cmdScissorRect)) {
+						continue;
+					}
+
 					GPUVertexBuffer* gpuvb = &ctx->m_GPUVertexBuffers[clipCmd->m_VertexBufferID];
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+					bgfx::setVertexBuffer(0, gpuvb->m_bgfxHandle, clipCmd->m_FirstVertexID, clipCmd->m_NumVertices);
+#else
 					bgfx::setVertexBuffer(0, gpuvb->m_PosBufferHandle, clipCmd->m_FirstVertexID, clipCmd->m_NumVertices);
+#endif
 					bgfx::setIndexBuffer(gpuib->m_bgfxHandle, clipCmd->m_FirstIndexID, clipCmd->m_NumIndices);
+#if VG_CONFIG_POSITION_INT16
+					setPositionDecodeTransform(clipCmd->m_PosQuant, &posDecodeMtxCacheID);
+#endif
 
-					// Set scissor.
-					{
-						const uint16_t* cmdScissorRect = &clipCmd->m_ScissorRect[0];
-						if (!bx::memCmp(cmdScissorRect, &prevScissorRect[0], sizeof(uint16_t) * 4)) {
-							bgfx::setScissor(prevScissorID);
-						} else {
-							prevScissorID = bgfx::setScissor(cmdScissorRect[0] * devicePixelRatio, cmdScissorRect[1] * devicePixelRatio, cmdScissorRect[2] * devicePixelRatio, cmdScissorRect[3] * devicePixelRatio);
-							bx::memCopy(prevScissorRect, cmdScissorRect, sizeof(uint16_t) * 4);
-						}
-					}
+					setDrawScissor(cmdScissorRect, devicePixelRatio, prevScissorRect, &prevScissorID);
 
 					VG_CHECK(clipCmd->m_Type == DrawCommand::Type::Clip, "Invalid clip command");
 					VG_CHECK(clipCmd->m_HandleID == UINT16_MAX, "Invalid clip command image handle");
@@ -876,7 +1632,7 @@ void end(Context* ctx)
 
 					// TODO: Check if it's better to use Type_TexturedVertexColor program here to avoid too many
 					// state switches.
-					bgfx::submit(viewID, ctx->m_ProgramHandle[DrawCommand::Type::Clip]);
+					bgfx::submit(cmdViewID, ctx->m_ProgramHandle[DrawCommand::Type::Clip]);
 				}
 
 				stencilState = 0
@@ -893,41 +1649,172 @@ void end(Context* ctx)
 			}
 		}
 
-		GPUVertexBuffer* gpuvb = &ctx->m_GPUVertexBuffers[cmd->m_VertexBufferID];
-		bgfx::setVertexBuffer(0, gpuvb->m_PosBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
-		bgfx::setVertexBuffer(1, gpuvb->m_ColorBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
-		bgfx::setIndexBuffer(gpuib->m_bgfxHandle, cmd->m_FirstIndexID, cmd->m_NumIndices);
+		// NOTE: Commands are skipped after their clip commands have been handled because the next
+		// command might use the same clip state.
+		uint16_t cmdScissorRect[4];
+		if (!intersectRedrawRect(cmd->m_ScissorRect, cmdRedrawRect, cmdScissorRect)) {
+			continue;
+		}
+
+		// Instanced commands draw as many instances as fit in bgfx's transient instance data buffer.
+		uint32_t numInstances = 0;
+		if (cmd->m_NumInstances != 0) {
+			numInstances = bgfx::getAvailInstanceDataBuffer(cmd->m_NumInstances, sizeof(InstanceData));
+			VG_WARN(numInstances == cmd->m_NumInstances, "Not enough space for instance data; %u of %u instances dropped", cmd->m_NumInstances - numInstances, cmd->m_NumInstances);
+			if (numInstances == 0) {
+				continue;
+			}
+		}
+
+		const RetainedDraw* retainedDraw = cmd->m_RetainedDrawID != UINT32_MAX ? &ctx->m_RetainedDraws[cmd->m_RetainedDrawID] : nullptr;
+		GPUVertexBuffer* gpuvb = retainedDraw ? nullptr : &ctx->m_GPUVertexBuffers[cmd->m_VertexBufferID];
+
+		// Stencil-and-cover fill: The triangle fans of the path's contours accumulate the winding
+		// numbers in the stencil buffer. The cover quad (the rest of the indices) is then drawn where
+		// the fill rule is satisfied, resetting the stencil buffer back to 0 as it goes.
+		const uint32_t numStencilIndices = cmd->m_NumStencilIndices;
+		uint32_t drawStencilState = stencilState;
+		if (numStencilIndices != 0) {
+			VG_CHECK(!retainedDraw && cmdClipState->m_NumCmds == 0, "Invalid stencil-and-cover command");
+
+			// Clip commands leave their values in the stencil buffer so the area under the cover quad
+			// has to be cleared first.
+			const bool clearStencil = nextStencilValue != 1;
+			for (uint32_t iPass = clearStencil ? 0 : 1; iPass < 2; ++iPass) {
+				const bool isClearPass = iPass == 0;
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+				bgfx::setVertexBuffer(0, gpuvb->m_bgfxHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#else
+				bgfx::setVertexBuffer(0, gpuvb->m_PosBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#endif
+				if (isClearPass) {
+					bgfx::setIndexBuffer(gpuib->m_bgfxHandle, cmd->m_FirstIndexID + numStencilIndices, cmd->m_NumIndices - numStencilIndices);
+				} else {
+					bgfx::setIndexBuffer(gpuib->m_bgfxHandle, cmd->m_FirstIndexID, numStencilIndices);
+				}
+
+				if (cmd->m_TransformID != UINT32_MAX) {
+					bgfx::setTransform(ctx->m_DrawTransforms[cmd->m_TransformID].m_ModelMtx);
+				}
+#if VG_CONFIG_POSITION_INT16
+				setPositionDecodeTransform(cmd->m_PosQuant, &posDecodeMtxCacheID);
+#endif
+				setDrawScissor(cmdScissorRect, devicePixelRatio, prevScissorRect, &prevScissorID);
 
-		// Set scissor.
-		{
-			const uint16_t* cmdScissorRect = &cmd->m_ScissorRect[0];
-			if (!bx::memCmp(cmdScissorRect, &prevScissorRect[0], sizeof(uint16_t) * 4)) {
-				bgfx::setScissor(prevScissorID);
-			} else {
-				prevScissorID = bgfx::setScissor(cmdScissorRect[0] * devicePixelRatio, cmdScissorRect[1] * devicePixelRatio, cmdScissorRect[2] * devicePixelRatio, cmdScissorRect[3] * devicePixelRatio);
-				bx::memCopy(prevScissorRect, cmdScissorRect, sizeof(uint16_t) * 4);
+				bgfx::setState(0);
+				if (isClearPass) {
+					bgfx::setStencil(0
+						| BGFX_STENCIL_TEST_ALWAYS
+						| BGFX_STENCIL_FUNC_REF(0)
+						| BGFX_STENCIL_FUNC_RMASK(0xff)
+						| BGFX_STENCIL_OP_FAIL_S_REPLACE
+						| BGFX_STENCIL_OP_FAIL_Z_REPLACE
+						| BGFX_STENCIL_OP_PASS_Z_REPLACE, BGFX_STENCIL_NONE);
+				} else if (cmd->m_StencilFillRule == FillRule::EvenOdd) {
+					bgfx::setStencil(0
+						| BGFX_STENCIL_TEST_ALWAYS
+						| BGFX_STENCIL_FUNC_RMASK(0xff)
+						| BGFX_STENCIL_OP_FAIL_S_KEEP
+						| BGFX_STENCIL_OP_FAIL_Z_KEEP
+						| BGFX_STENCIL_OP_PASS_Z_INVERT, BGFX_STENCIL_NONE);
+				} else {
+					// Front facing triangles increment the winding number, back facing ones decrement it (with wrap).
+					bgfx::setStencil(0
+						| BGFX_STENCIL_TEST_ALWAYS
+						| BGFX_STENCIL_FUNC_RMASK(0xff)
+						| BGFX_STENCIL_OP_FAIL_S_KEEP
+						| BGFX_STENCIL_OP_FAIL_Z_KEEP
+						| BGFX_STENCIL_OP_PASS_Z_INCR, 0
+						| BGFX_STENCIL_TEST_ALWAYS
+						| BGFX_STENCIL_FUNC_RMASK(0xff)
+						| BGFX_STENCIL_OP_FAIL_S_KEEP
+						| BGFX_STENCIL_OP_FAIL_Z_KEEP
+						| BGFX_STENCIL_OP_PASS_Z_DECR);
+				}
+
+				bgfx::submit(cmdViewID, ctx->m_ProgramHandle[DrawCommand::Type::Clip]);
 			}
+
+			drawStencilState = 0
+				| BGFX_STENCIL_TEST_NOTEQUAL
+				| BGFX_STENCIL_FUNC_REF(0)
+				| BGFX_STENCIL_FUNC_RMASK(0xff)
+				| BGFX_STENCIL_OP_FAIL_S_ZERO
+				| BGFX_STENCIL_OP_FAIL_Z_ZERO
+				| BGFX_STENCIL_OP_PASS_Z_ZERO;
+
+			// NOTE: The command isn't clipped, so the clip commands of the next clipped command will be
+			// drawn again (with a new stencil value) after this.
+		}
+
+		if (retainedDraw) {
+			bgfx::setVertexBuffer(0, retainedDraw->m_PosBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+			bgfx::setVertexBuffer(1, retainedDraw->m_ColorBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+			bgfx::setIndexBuffer(retainedDraw->m_IndexBufferHandle, cmd->m_FirstIndexID, cmd->m_NumIndices);
+		} else {
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+			bgfx::setVertexBuffer(0, gpuvb->m_bgfxHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#else
+			bgfx::setVertexBuffer(0, gpuvb->m_PosBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+			bgfx::setVertexBuffer(1, gpuvb->m_ColorBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#endif
+			bgfx::setIndexBuffer(gpuib->m_bgfxHandle, cmd->m_FirstIndexID + numStencilIndices, cmd->m_NumIndices - numStencilIndices);
 		}
 
+		if (cmd->m_TransformID != UINT32_MAX) {
+			bgfx::setTransform(ctx->m_DrawTransforms[cmd->m_TransformID].m_ModelMtx);
+		}
+#if VG_CONFIG_POSITION_INT16
+		// NOTE: Instanced commands decode the positions using the instance matrices.
+		if (!retainedDraw && numInstances == 0) {
+			VG_CHECK(cmd->m_TransformID == UINT32_MAX, "Quantized vertices must be in canvas space");
+			setPositionDecodeTransform(cmd->m_PosQuant, &posDecodeMtxCacheID);
+		}
+#endif
+
+		setDrawScissor(cmdScissorRect, devicePixelRatio, prevScissorRect, &prevScissorID);
+
 		if (cmd->m_Type == DrawCommand::Type::Textured) {
 			VG_CHECK(cmd->m_HandleID != UINT16_MAX, "Invalid image handle");
 			Image* tex = &ctx->m_Images[cmd->m_HandleID];
 
-			bgfx::setVertexBuffer(2, gpuvb->m_UVBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+			if (retainedDraw) {
+				bgfx::setVertexBuffer(2, retainedDraw->m_UVBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+			} else {
+#if !VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+				bgfx::setVertexBuffer(2, gpuvb->m_UVBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#endif
+			}
 			bgfx::setTexture(0, ctx->m_TexUniform, tex->m_bgfxHandle, tex->m_Flags);
 
+			if (numInstances != 0) {
+				bgfx::InstanceDataBuffer idb;
+				bgfx::allocInstanceDataBuffer(&idb, numInstances, sizeof(InstanceData));
+				bx::memCopy(idb.data, &ctx->m_InstanceData[cmd->m_FirstInstanceID], sizeof(InstanceData) * numInstances);
+				bgfx::setInstanceDataBuffer(&idb);
+			}
+
 			bgfx::setState(0
 				| BGFX_STATE_WRITE_A
 				| BGFX_STATE_WRITE_RGB
-				| BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA));
-			bgfx::setStencil(stencilState);
+				| (tex->m_PremultipliedAlpha
+					? BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA)
+					: BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA)));
+			bgfx::setStencil(drawStencilState);
 
-			bgfx::submit(viewID, ctx->m_ProgramHandle[DrawCommand::Type::Textured]);
+			bgfx::submit(cmdViewID, numInstances != 0 ? ctx->m_InstancedProgramHandle : ctx->m_ProgramHandle[DrawCommand::Type::Textured]);
 		} else if (cmd->m_Type == DrawCommand::Type::ColorGradient) {
 			VG_CHECK(cmd->m_HandleID != UINT16_MAX, "Invalid gradient handle");
 			Gradient* grad = &ctx->m_Gradients[cmd->m_HandleID];
 
+#if VG_CONFIG_POSITION_INT16
+			float paintMtx[9];
+			paintMatrixDecodePositions(grad->m_Matrix, cmd->m_PosQuant, paintMtx);
+			bgfx::setUniform(ctx->m_PaintMatUniform, paintMtx, 1);
+#else
 			bgfx::setUniform(ctx->m_PaintMatUniform, grad->m_Matrix, 1);
+#endif
 			bgfx::setUniform(ctx->m_ExtentRadiusFeatherUniform, grad->m_Params, 1);
 			bgfx::setUniform(ctx->m_InnerColorUniform, grad->m_InnerColor, 1);
 			bgfx::setUniform(ctx->m_OuterColorUniform, grad->m_OuterColor, 1);
@@ -936,9 +1823,9 @@ void end(Context* ctx)
 				| BGFX_STATE_WRITE_A
 				| BGFX_STATE_WRITE_RGB
 				| BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA));
-			bgfx::setStencil(stencilState);
+			bgfx::setStencil(drawStencilState);
 
-			bgfx::submit(viewID, ctx->m_ProgramHandle[DrawCommand::Type::ColorGradient]);
+			bgfx::submit(cmdViewID, ctx->m_ProgramHandle[DrawCommand::Type::ColorGradient]);
 		} else if(cmd->m_Type == DrawCommand::Type::ImagePattern) {
 			VG_CHECK(cmd->m_HandleID != UINT16_MAX, "Invalid image pattern handle");
 			ImagePattern* imgPattern = &ctx->m_ImagePatterns[cmd->m_HandleID];
@@ -947,15 +1834,56 @@ void end(Context* ctx)
 			Image* tex = &ctx->m_Images[imgPattern->m_ImageHandle.idx];
 
 			bgfx::setTexture(0, ctx->m_TexUniform, tex->m_bgfxHandle, tex->m_Flags);
+#if VG_CONFIG_POSITION_INT16
+			float paintMtx[9];
+			paintMatrixDecodePositions(imgPattern->m_Matrix, cmd->m_PosQuant, paintMtx);
+			bgfx::setUniform(ctx->m_PaintMatUniform, paintMtx, 1);
+#else
 			bgfx::setUniform(ctx->m_PaintMatUniform, imgPattern->m_Matrix, 1);
+#endif
+
+			bgfx::setState(0
+				| BGFX_STATE_WRITE_A
+				| BGFX_STATE_WRITE_RGB
+				| (tex->m_PremultipliedAlpha
+					? BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA)
+					: BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA)));
+			bgfx::setStencil(drawStencilState);
+
+			bgfx::submit(cmdViewID, ctx->m_ProgramHandle[DrawCommand::Type::ImagePattern]);
+		} else if (cmd->m_Type == DrawCommand::Type::Coverage) {
+			VG_CHECK(!retainedDraw && numInstances == 0, "Coverage commands cannot be retained or instanced");
+#if !VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+			bgfx::setVertexBuffer(2, gpuvb->m_UVBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#endif
+
+			bgfx::setState(0
+				| BGFX_STATE_WRITE_A
+				| BGFX_STATE_WRITE_RGB
+				| BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA));
+			bgfx::setStencil(drawStencilState);
+
+			bgfx::submit(cmdViewID, ctx->m_ProgramHandle[DrawCommand::Type::Coverage]);
+		} else if (cmd->m_Type == DrawCommand::Type::TextSDF) {
+			VG_CHECK(!retainedDraw && numInstances == 0, "Text commands cannot be retained or instanced");
+			VG_CHECK(cmd->m_HandleID != UINT16_MAX, "Invalid image handle");
+			Image* tex = &ctx->m_Images[cmd->m_HandleID];
+
+#if !VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+			bgfx::setVertexBuffer(2, gpuvb->m_UVBufferHandle, cmd->m_FirstVertexID, cmd->m_NumVertices);
+#endif
+			bgfx::setTexture(0, ctx->m_TexUniform, tex->m_bgfxHandle, tex->m_Flags);
+
+			const float sdfParams[4] = { cmd->m_SDFBlur, 0.0f, 0.0f, 0.0f };
+			bgfx::setUniform(ctx->m_SDFParamsUniform, sdfParams, 1);
 
 			bgfx::setState(0
 				| BGFX_STATE_WRITE_A
 				| BGFX_STATE_WRITE_RGB
 				| BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_INV_SRC_ALPHA));
-			bgfx::setStencil(stencilState);
+			bgfx::setStencil(drawStencilState);
 
-			bgfx::submit(viewID, ctx->m_ProgramHandle[DrawCommand::Type::ImagePattern]);
+			bgfx::submit(cmdViewID, ctx->m_ProgramHandle[DrawCommand::Type::TextSDF]);
 		} else {
 			VG_CHECK(false, "Unknown draw command type");
 		}
@@ -964,6 +1892,7 @@ void end(Context* ctx)
 
 void frame(Context* ctx)
 {
+	vbUpdateUsageHistory(ctx);
 	ctx->m_NumVertexBuffers = 0;
 
 	fsFrame(ctx->m_FontSystem, ctx);
@@ -971,7 +1900,52 @@ void frame(Context* ctx)
 
 const Stats* getStats(Context* ctx)
 {
-	return &ctx->m_Stats;
+	Stats* stats = &ctx->m_Stats;
+	bx::memSet(stats, 0, sizeof(Stats));
+
+	const uint32_t numShards = ctx->m_Config.m_NumRecordingShards;
+	for (uint32_t i = 0; i < numShards; ++i) {
+		const Stats* shardStats = &ctx->m_RecordingShards[i].m_Stats;
+		stats->m_CmdListMemoryTotal += shardStats->m_CmdListMemoryTotal;
+		stats->m_CmdListMemoryUsed += shardStats->m_CmdListMemoryUsed;
+	}
+
+	return stats;
+}
+
+void setDirtyRectTracking(Context* ctx, bool enable)
+{
+	if (ctx->m_DirtyRectTracking == enable) {
+		return;
+	}
+
+	ctx->m_DirtyRectTracking = enable;
+	ctx->m_HasDirtyRect = false;
+
+	// The first frame after enabling tracking is always fully rendered.
+	ctx->m_DirtyCanvasSize[0] = 0;
+	ctx->m_DirtyCanvasSize[1] = 0;
+}
+
+void addDirtyRect(Context* ctx, float x, float y, float w, float h)
+{
+	if (w <= 0.0f || h <= 0.0f) {
+		return;
+	}
+
+	const float rect[4] = { x, y, x + w, y + h };
+	addDirtyRectMinMax(ctx, rect);
+}
+
+bool getDirtyRect(Context* ctx, float* rect)
+{
+	const uint16_t* redrawRect = ctx->m_RedrawRect;
+	rect[0] = (float)redrawRect[0];
+	rect[1] = (float)redrawRect[1];
+	rect[2] = (float)redrawRect[2];
+	rect[3] = (float)redrawRect[3];
+
+	return redrawRect[2] != 0 && redrawRect[3] != 0;
 }
 
 void beginPath(Context* ctx)
@@ -1164,11 +2138,26 @@ void setViewBox(Context* ctx, float x, float y, float w, float h)
 	ctxSetViewBox(ctx, x, y, w, h);
 }
 
-void indexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, ImageHandle img)
+void indexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img)
 {
 	ctxIndexedTriList(ctx, pos, uv, numVertices, colors, numColors, indices, numIndices, img);
 }
 
+void fillPathInstanced(Context* ctx, Color color, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	ctxFillPathInstanced(ctx, color, flags, instanceMtx, instanceColors, numInstances);
+}
+
+void strokePathInstanced(Context* ctx, Color color, float width, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	ctxStrokePathInstanced(ctx, color, width, flags, instanceMtx, instanceColors, numInstances);
+}
+
+void indexedTriListInstanced(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	ctxIndexedTriListInstanced(ctx, pos, uv, numVertices, colors, numColors, indices, numIndices, img, instanceMtx, instanceColors, numInstances);
+}
+
 void text(Context* ctx, const TextConfig& cfg, float x, float y, const char* str, const char* end)
 {
 	ctxText(ctx, cfg, x, y, str, end);
@@ -1292,6 +2281,11 @@ float getTextLineHeight(Context* ctx, const TextConfig& cfg)
 	return fsGetLineHeight(ctx->m_FontSystem, cfg);
 }
 
+uint32_t rasterizeGlyphs(Context* ctx, uint32_t maxGlyphs)
+{
+	return fsRasterizeGlyphs(ctx->m_FontSystem, maxGlyphs);
+}
+
 int textBreakLines(Context* ctx, const TextConfig& cfg, const char* str, const char* end, float breakRowWidth, TextRow* rows, int maxRows, uint32_t flags)
 {
 	return (int32_t)fsTextBreakLines(ctx->m_FontSystem, cfg, str, end, breakRowWidth, rows, maxRows, flags);
@@ -1480,9 +2474,100 @@ bool isImageValid(Context* ctx, ImageHandle image)
 	return bgfx::isValid(tex->m_bgfxHandle);
 }
 
+LayerHandle createLayer(Context* ctx, uint16_t width, uint16_t height, uint32_t imageFlags)
+{
+	VG_CHECK(width != 0 && height != 0, "Invalid layer size");
+
+	LayerHandle handle = { ctx->m_LayerHandleAlloc->alloc() };
+	if (!isValid(handle)) {
+		return VG_INVALID_HANDLE;
+	}
+
+	// The stencil buffer is needed by the clip commands drawn into the layer.
+	const bgfx::TextureHandle textures[2] = {
+		bgfx::createTexture2D(width, height, false, 1, bgfx::TextureFormat::RGBA8, BGFX_TEXTURE_RT),
+		bgfx::createTexture2D(width, height, false, 1, bgfx::TextureFormat::D24S8, BGFX_TEXTURE_RT_WRITE_ONLY)
+	};
+
+	Layer* layer = &ctx->m_Layers[handle.idx];
+	layer->m_FrameBufferHandle = bgfx::createFrameBuffer(BX_COUNTOF(textures), textures, true);
+	layer->m_Image = createImage(ctx, imageFlags, textures[0]);
+	layer->m_Width = width;
+	layer->m_Height = height;
+	layer->m_ViewID = UINT16_MAX;
+	layer->m_IsValid = false;
+
+	if (!bgfx::isValid(layer->m_FrameBufferHandle) || !isValid(layer->m_Image)) {
+		destroyLayer(ctx, handle);
+		return VG_INVALID_HANDLE;
+	}
+
+	Image* img = &ctx->m_Images[layer->m_Image.idx];
+	img->m_Width = width;
+	img->m_Height = height;
+	img->m_PremultipliedAlpha = true;
+
+	return handle;
+}
+
+void destroyLayer(Context* ctx, LayerHandle handle)
+{
+	if (!isLayerHandleValid(ctx, handle)) {
+		return;
+	}
+
+	Layer* layer = &ctx->m_Layers[handle.idx];
+
+	// NOTE: The image doesn't own the texture; it's destroyed along with the framebuffer.
+	if (isValid(layer->m_Image)) {
+		destroyImage(ctx, layer->m_Image);
+	}
+
+	if (bgfx::isValid(layer->m_FrameBufferHandle)) {
+		bgfx::destroy(layer->m_FrameBufferHandle);
+	}
+
+	bx::memSet(layer, 0, sizeof(Layer));
+	ctx->m_LayerHandleAlloc->free(handle.idx);
+}
+
+void invalidateLayer(Context* ctx, LayerHandle handle)
+{
+	if (!isLayerHandleValid(ctx, handle)) {
+		return;
+	}
+
+	ctx->m_Layers[handle.idx].m_IsValid = false;
+}
+
+ImageHandle getLayerImage(Context* ctx, LayerHandle handle)
+{
+	if (!isLayerHandleValid(ctx, handle)) {
+		return VG_INVALID_HANDLE;
+	}
+
+	return ctx->m_Layers[handle.idx].m_Image;
+}
+
+bool beginLayer(Context* ctx, LayerHandle handle, uint16_t viewID)
+{
+	return ctxBeginLayer(ctx, handle, viewID);
+}
+
+void endLayer(Context* ctx)
+{
+	ctxEndLayer(ctx);
+}
+
 CommandListHandle createCommandList(Context* ctx, uint32_t flags)
+{
+	return createCommandList(ctx, flags, 0);
+}
+
+CommandListHandle createCommandList(Context* ctx, uint32_t flags, uint16_t shardID)
 {
 	VG_CHECK(!isValid(ctx->m_ActiveCommandList), "Cannot create command list while inside a beginCommandList()/endCommandList() block");
+	VG_CHECK(shardID < ctx->m_Config.m_NumRecordingShards, "Invalid recording shard ID");
 
 	CommandListHandle handle = allocCommandList(ctx);
 	if (!isValid(handle)) {
@@ -1491,18 +2576,35 @@ CommandListHandle createCommandList(Context* ctx, uint32_t flags)
 
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 	cl->m_Flags = flags;
+	cl->m_ShardID = shardID;
+	clBoundsReset(cl);
 
 	return handle;
 }
 
+bool setRecordingShardAllocator(Context* ctx, uint16_t shardID, bx::AllocatorI* allocator)
+{
+	if (shardID >= ctx->m_Config.m_NumRecordingShards) {
+		return false;
+	}
+
+	// NOTE: All command lists of this shard must be empty because their buffers are
+	// freed using the shard's allocator.
+	RecordingShard* shard = &ctx->m_RecordingShards[shardID];
+	VG_CHECK(shard->m_Stats.m_CmdListMemoryTotal == 0, "Cannot change the allocator of a shard with allocated command lists");
+	shard->m_Allocator = allocator ? allocator : ctx->m_Allocator;
+
+	return true;
+}
+
 void destroyCommandList(Context* ctx, CommandListHandle handle)
 {
 	VG_CHECK(!isValid(ctx->m_ActiveCommandList), "Cannot destroy command list while inside a beginCommandList()/endCommandList() block");
 	VG_CHECK(isValid(handle), "Invalid command list handle");
 
-	bx::AllocatorI* allocator = ctx->m_Allocator;
-
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+	RecordingShard* shard = &ctx->m_RecordingShards[cl->m_ShardID];
+	bx::AllocatorI* allocator = shard->m_Allocator;
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
 	if (cl->m_Cache) {
@@ -1510,15 +2612,32 @@ void destroyCommandList(Context* ctx, CommandListHandle handle)
 	}
 #endif
 
-	ctx->m_Stats.m_CmdListMemoryTotal -= cl->m_CommandBufferCapacity;
-	ctx->m_Stats.m_CmdListMemoryUsed -= cl->m_CommandBufferPos;
+	clFreePrepared(cl);
+
+	shard->m_Stats.m_CmdListMemoryTotal -= cl->m_CommandBufferCapacity;
+	shard->m_Stats.m_CmdListMemoryUsed -= cl->m_CommandBufferPos;
 
 	if (cl->m_CommandBuffer) {
 		bx::alignedFree(allocator, cl->m_CommandBuffer, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
 		cl->m_CommandBuffer = nullptr;
 	}
 	bx::free(allocator, cl->m_StringBuffer);
+	bx::free(allocator, cl->m_BoundsMtxStack);
+	bx::free(allocator, cl->m_BoundsChildren);
+
+	// Whatever the list drew in this or the previous frame has to be redrawn. Older submissions
+	// have already been erased (see end()).
+	if (cl->m_DirtyFrameID != 0 && cl->m_DirtyFrameID + 1 >= ctx->m_DirtyFrameID) {
+		addDirtyRectMinMax(ctx, cl->m_DirtyBounds);
+	}
+
+	// Parents might still reference the handle. Keep the generation and the revision so they
+	// can tell the list which reuses it apart from this one.
+	const uint32_t generation = cl->m_BoundsGeneration + 1;
+	const uint32_t revision = cl->m_Revision + 1;
 	bx::memSet(cl, 0, sizeof(CommandList));
+	cl->m_BoundsGeneration = generation;
+	cl->m_Revision = revision;
 
 	ctx->m_CmdListHandleAlloc->free(handle.idx);
 }
@@ -1530,17 +2649,74 @@ void resetCommandList(Context* ctx, CommandListHandle handle)
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
 	if (cl->m_Cache) {
-		clCacheReset(ctx, cl->m_Cache);
+		const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+		for (uint32_t i = 0; i < numLODs; ++i) {
+			clCacheReset(ctx, &cl->m_Cache[i]);
+		}
 	}
-#else
-	BX_UNUSED(ctx);
 #endif
 
-	ctx->m_Stats.m_CmdListMemoryUsed -= cl->m_CommandBufferPos;
+	if (cl->m_Prepared) {
+		cl->m_Prepared->m_IsValid = false;
+	}
+
+	RecordingShard* shard = &ctx->m_RecordingShards[cl->m_ShardID];
+	shard->m_Stats.m_CmdListMemoryUsed -= cl->m_CommandBufferPos;
 	cl->m_CommandBufferPos = 0;
 	cl->m_StringBufferPos = 0;
+	cl->m_NumStrokerCommands = 0;
 	cl->m_NumImagePatterns = 0;
 	cl->m_NumGradients = 0;
+	cl->m_Revision++;
+	clBoundsReset(cl);
+}
+
+bool prepareCommandList(Context* ctx, CommandListHandle handle, uint16_t shardID)
+{
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	VG_CHECK(shardID < ctx->m_Config.m_NumRecordingShards, "Invalid recording shard ID");
+
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+	RecordingShard* shard = &ctx->m_RecordingShards[shardID];
+	bx::AllocatorI* allocator = shard->m_Allocator;
+
+	if (!shard->m_Tessellator.m_Allocator) {
+		tessInit(&shard->m_Tessellator, allocator);
+		shard->m_StateStack = (State*)bx::alloc(allocator, sizeof(State) * ctx->m_Config.m_MaxStateStackSize);
+	}
+
+	PreparedCommandList* prepared = cl->m_Prepared;
+	if (!prepared) {
+		prepared = (PreparedCommandList*)bx::alloc(allocator, sizeof(PreparedCommandList));
+		bx::memSet(prepared, 0, sizeof(PreparedCommandList));
+		prepared->m_Allocator = allocator;
+		cl->m_Prepared = prepared;
+	}
+
+	prepared->m_NumVertices = 0;
+	prepared->m_NumColors = 0;
+	prepared->m_NumIndices = 0;
+	prepared->m_NumMeshes = 0;
+	prepared->m_NumCommands = 0;
+	prepared->m_NumChildren = 0;
+	prepared->m_CommandBufferPos = cl->m_CommandBufferPos;
+	prepared->m_Revision = cl->m_Revision;
+	prepared->m_TesselationTolerance = ctx->m_TesselationTolerance;
+	prepared->m_FringeWidth = ctx->m_FringeWidth;
+	prepared->m_CanvasWidth = ctx->m_CanvasWidth;
+	prepared->m_CanvasHeight = ctx->m_CanvasHeight;
+
+	// Start from the state begin() sets up (see clCanUsePrepared()).
+	State* state = &shard->m_StateStack[0];
+	bx::memSet(state, 0, sizeof(State));
+	state->m_GlobalAlpha = 1.0f;
+	stateTransformIdentity(state);
+	shard->m_StateStackTop = 0;
+	shard->m_RecordClipCommands = false;
+
+	prepared->m_IsValid = clPrepare(ctx, shard, prepared, cl, 1);
+
+	return prepared->m_IsValid;
 }
 
 void clBeginPath(Context* ctx, CommandListHandle handle)
@@ -1559,6 +2735,8 @@ void clMoveTo(Context* ctx, CommandListHandle handle, float x, float y)
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::MoveTo, sizeof(float) * 2);
 	CMD_WRITE(ptr, float, x);
 	CMD_WRITE(ptr, float, y);
+
+	clBoundsAddRect(cl, x, y, x, y);
 }
 
 void clLineTo(Context* ctx, CommandListHandle handle, float x, float y)
@@ -1569,6 +2747,8 @@ void clLineTo(Context* ctx, CommandListHandle handle, float x, float y)
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::LineTo, sizeof(float) * 2);
 	CMD_WRITE(ptr, float, x);
 	CMD_WRITE(ptr, float, y);
+
+	clBoundsAddRect(cl, x, y, x, y);
 }
 
 void clCubicTo(Context* ctx, CommandListHandle handle, float c1x, float c1y, float c2x, float c2y, float x, float y)
@@ -1583,6 +2763,9 @@ void clCubicTo(Context* ctx, CommandListHandle handle, float c1x, float c1y, flo
 	CMD_WRITE(ptr, float, c2y);
 	CMD_WRITE(ptr, float, x);
 	CMD_WRITE(ptr, float, y);
+
+	// The curve is inside the convex hull of its control points.
+	clBoundsAddRect(cl, bx::min<float>(bx::min<float>(c1x, c2x), x), bx::min<float>(bx::min<float>(c1y, c2y), y), bx::max<float>(bx::max<float>(c1x, c2x), x), bx::max<float>(bx::max<float>(c1y, c2y), y));
 }
 
 void clQuadraticTo(Context* ctx, CommandListHandle handle, float cx, float cy, float x, float y)
@@ -1595,6 +2778,8 @@ void clQuadraticTo(Context* ctx, CommandListHandle handle, float cx, float cy, f
 	CMD_WRITE(ptr, float, cy);
 	CMD_WRITE(ptr, float, x);
 	CMD_WRITE(ptr, float, y);
+
+	clBoundsAddRect(cl, bx::min<float>(cx, x), bx::min<float>(cy, y), bx::max<float>(cx, x), bx::max<float>(cy, y));
 }
 
 void clArc(Context* ctx, CommandListHandle handle, float cx, float cy, float r, float a0, float a1, Winding::Enum dir)
@@ -1609,6 +2794,9 @@ void clArc(Context* ctx, CommandListHandle handle, float cx, float cy, float r,
 	CMD_WRITE(ptr, float, a0);
 	CMD_WRITE(ptr, float, a1);
 	CMD_WRITE(ptr, Winding::Enum, dir);
+
+	const float ar = bx::abs(r);
+	clBoundsAddRect(cl, cx - ar, cy - ar, cx + ar, cy + ar);
 }
 
 void clArcTo(Context* ctx, CommandListHandle handle, float x1, float y1, float x2, float y2, float r)
@@ -1622,6 +2810,10 @@ void clArcTo(Context* ctx, CommandListHandle handle, float x1, float y1, float x
 	CMD_WRITE(ptr, float, x2);
 	CMD_WRITE(ptr, float, y2);
 	CMD_WRITE(ptr, float, r);
+
+	// The tangent points depend on the current point, which isn't known while recording, and
+	// can be far away from both points when the lines are almost parallel.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
 }
 
 void clRect(Context* ctx, CommandListHandle handle, float x, float y, float w, float h)
@@ -1634,6 +2826,8 @@ void clRect(Context* ctx, CommandListHandle handle, float x, float y, float w, f
 	CMD_WRITE(ptr, float, y);
 	CMD_WRITE(ptr, float, w);
 	CMD_WRITE(ptr, float, h);
+
+	clBoundsAddRect(cl, x, y, x + w, y + h);
 }
 
 void clRoundedRect(Context* ctx, CommandListHandle handle, float x, float y, float w, float h, float r)
@@ -1647,6 +2841,8 @@ void clRoundedRect(Context* ctx, CommandListHandle handle, float x, float y, flo
 	CMD_WRITE(ptr, float, w);
 	CMD_WRITE(ptr, float, h);
 	CMD_WRITE(ptr, float, r);
+
+	clBoundsAddRect(cl, x, y, x + w, y + h);
 }
 
 void clRoundedRectVarying(Context* ctx, CommandListHandle handle, float x, float y, float w, float h, float rtl, float rtr, float rbr, float rbl)
@@ -1663,6 +2859,8 @@ void clRoundedRectVarying(Context* ctx, CommandListHandle handle, float x, float
 	CMD_WRITE(ptr, float, rtr);
 	CMD_WRITE(ptr, float, rbr);
 	CMD_WRITE(ptr, float, rbl);
+
+	clBoundsAddRect(cl, x, y, x + w, y + h);
 }
 
 void clCircle(Context* ctx, CommandListHandle handle, float cx, float cy, float radius)
@@ -1674,6 +2872,9 @@ void clCircle(Context* ctx, CommandListHandle handle, float cx, float cy, float
 	CMD_WRITE(ptr, float, cx);
 	CMD_WRITE(ptr, float, cy);
 	CMD_WRITE(ptr, float, radius);
+
+	const float r = bx::abs(radius);
+	clBoundsAddRect(cl, cx - r, cy - r, cx + r, cy + r);
 }
 
 void clEllipse(Context* ctx, CommandListHandle handle, float cx, float cy, float rx, float ry)
@@ -1686,6 +2887,10 @@ void clEllipse(Context* ctx, CommandListHandle handle, float cx, float cy, float
 	CMD_WRITE(ptr, float, cy);
 	CMD_WRITE(ptr, float, rx);
 	CMD_WRITE(ptr, float, ry);
+
+	const float arx = bx::abs(rx);
+	const float ary = bx::abs(ry);
+	clBoundsAddRect(cl, cx - arx, cy - ary, cx + arx, cy + ary);
 }
 
 void clPolyline(Context* ctx, CommandListHandle handle, const float* coords, uint32_t numPoints)
@@ -1696,6 +2901,12 @@ void clPolyline(Context* ctx, CommandListHandle handle, const float* coords, uin
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::Polyline, sizeof(uint32_t) + sizeof(float) * 2 * numPoints);
 	CMD_WRITE(ptr, uint32_t, numPoints);
 	bx::memCopy(ptr, coords, sizeof(float) * 2 * numPoints);
+
+	if (numPoints != 0) {
+		float rect[4];
+		vgutil::calcBoundingRect(coords, numPoints, &rect[0]);
+		clBoundsAddRect(cl, rect[0], rect[1], rect[2], rect[3]);
+	}
 }
 
 void clClosePath(Context* ctx, CommandListHandle handle)
@@ -1706,7 +2917,7 @@ void clClosePath(Context* ctx, CommandListHandle handle)
 	clAllocCommand(ctx, cl, CommandType::ClosePath, 0);
 }
 
-void clIndexedTriList(Context* ctx, CommandListHandle handle, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, ImageHandle img)
+void clIndexedTriList(Context* ctx, CommandListHandle handle, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* color, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img)
 {
 	VG_CHECK(isValid(handle), "Invalid command list handle");
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
@@ -1719,7 +2930,7 @@ void clIndexedTriList(Context* ctx, CommandListHandle handle, const float* pos,
 		+ sizeof(uint32_t) // num colors
 		+ sizeof(Color) * numColors // colors
 		+ sizeof(uint32_t) // num indices
-		+ sizeof(uint16_t) * numIndices // indices
+		+ sizeof(index_t) * numIndices // indices
 		+ sizeof(uint16_t) // image handle
 		;
 
@@ -1746,11 +2957,17 @@ void clIndexedTriList(Context* ctx, CommandListHandle handle, const float* pos,
 
 	// Indices
 	CMD_WRITE(ptr, uint32_t, numIndices);
-	bx::memCopy(ptr, indices, sizeof(uint16_t) * numIndices);
-	ptr += sizeof(uint16_t) * numIndices;
+	bx::memCopy(ptr, indices, sizeof(index_t) * numIndices);
+	ptr += sizeof(index_t) * numIndices;
 
 	// Image
 	CMD_WRITE(ptr, uint16_t, img.idx);
+
+	if (numVertices != 0) {
+		float rect[4];
+		vgutil::calcBoundingRect(pos, numVertices, &rect[0]);
+		clBoundsAddRect(cl, rect[0], rect[1], rect[2], rect[3]);
+	}
 }
 
 void clFillPath(Context* ctx, CommandListHandle handle, Color color, uint32_t flags)
@@ -1801,6 +3018,8 @@ void clStrokePath(Context* ctx, CommandListHandle handle, Color color, float wid
 	CMD_WRITE(ptr, float, width);
 	CMD_WRITE(ptr, uint32_t, flags);
 	CMD_WRITE(ptr, Color, color);
+
+	clBoundsAddStroke(cl, width, flags);
 }
 
 void clStrokePath(Context* ctx, CommandListHandle handle, GradientHandle gradient, float width, uint32_t flags)
@@ -1816,6 +3035,8 @@ void clStrokePath(Context* ctx, CommandListHandle handle, GradientHandle gradien
 	CMD_WRITE(ptr, uint32_t, flags);
 	CMD_WRITE(ptr, uint16_t, gradient.idx);
 	CMD_WRITE(ptr, uint16_t, gradient.flags);
+
+	clBoundsAddStroke(cl, width, flags);
 }
 
 void clStrokePath(Context* ctx, CommandListHandle handle, ImagePatternHandle img, Color color, float width, uint32_t flags)
@@ -1832,6 +3053,8 @@ void clStrokePath(Context* ctx, CommandListHandle handle, ImagePatternHandle img
 	CMD_WRITE(ptr, Color, color);
 	CMD_WRITE(ptr, uint16_t, img.idx);
 	CMD_WRITE(ptr, uint16_t, img.flags);
+
+	clBoundsAddStroke(cl, width, flags);
 }
 
 void clBeginClip(Context* ctx, CommandListHandle handle, ClipRule::Enum rule)
@@ -1841,6 +3064,11 @@ void clBeginClip(Context* ctx, CommandListHandle handle, ClipRule::Enum rule)
 
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::BeginClip, sizeof(ClipRule::Enum));
 	CMD_WRITE(ptr, ClipRule::Enum, rule);
+
+#if !VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	// The clip state is only reset after the list when preserving state.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+#endif
 }
 
 void clEndClip(Context* ctx, CommandListHandle handle)
@@ -1849,6 +3077,11 @@ void clEndClip(Context* ctx, CommandListHandle handle)
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
 	clAllocCommand(ctx, cl, CommandType::EndClip, 0);
+
+#if !VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	// The clip state is only reset after the list when preserving state.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+#endif
 }
 
 void clResetClip(Context* ctx, CommandListHandle handle)
@@ -1857,6 +3090,11 @@ void clResetClip(Context* ctx, CommandListHandle handle)
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
 	clAllocCommand(ctx, cl, CommandType::ResetClip, 0);
+
+#if !VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	// The clip state is only reset after the list when preserving state.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+#endif
 }
 
 GradientHandle clCreateLinearGradient(Context* ctx, CommandListHandle handle, float sx, float sy, float ex, float ey, Color icol, Color ocol)
@@ -1943,6 +3181,7 @@ void clPushState(Context* ctx, CommandListHandle handle)
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
 	clAllocCommand(ctx, cl, CommandType::PushState, 0);
+	clBoundsPushState(ctx, cl);
 }
 
 void clPopState(Context* ctx, CommandListHandle handle)
@@ -1951,6 +3190,7 @@ void clPopState(Context* ctx, CommandListHandle handle)
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
 	clAllocCommand(ctx, cl, CommandType::PopState, 0);
+	clBoundsPopState(cl);
 }
 
 void clResetScissor(Context* ctx, CommandListHandle handle)
@@ -1959,6 +3199,9 @@ void clResetScissor(Context* ctx, CommandListHandle handle)
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
 	clAllocCommand(ctx, cl, CommandType::ResetScissor, 0);
+
+	clBoundsStateChanged(cl);
+	clBoundsSetFlags(cl, CommandListBoundsFlags::ResetsScissor);
 }
 
 void clSetScissor(Context* ctx, CommandListHandle handle, float x, float y, float w, float h)
@@ -1971,6 +3214,9 @@ void clSetScissor(Context* ctx, CommandListHandle handle, float x, float y, floa
 	CMD_WRITE(ptr, float, y);
 	CMD_WRITE(ptr, float, w);
 	CMD_WRITE(ptr, float, h);
+
+	clBoundsStateChanged(cl);
+	clBoundsSetFlags(cl, CommandListBoundsFlags::ResetsScissor);
 }
 
 void clIntersectScissor(Context* ctx, CommandListHandle handle, float x, float y, float w, float h)
@@ -1983,6 +3229,8 @@ void clIntersectScissor(Context* ctx, CommandListHandle handle, float x, float y
 	CMD_WRITE(ptr, float, y);
 	CMD_WRITE(ptr, float, w);
 	CMD_WRITE(ptr, float, h);
+
+	clBoundsStateChanged(cl);
 }
 
 void clTransformIdentity(Context* ctx, CommandListHandle handle)
@@ -1991,6 +3239,9 @@ void clTransformIdentity(Context* ctx, CommandListHandle handle)
 	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
 	clAllocCommand(ctx, cl, CommandType::TransformIdentity, 0);
+
+	// The following commands no longer depend on the transform the list is submitted with.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
 }
 
 void clTransformScale(Context* ctx, CommandListHandle handle, float x, float y)
@@ -2001,6 +3252,10 @@ void clTransformScale(Context* ctx, CommandListHandle handle, float x, float y)
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::TransformScale, sizeof(float) * 2);
 	CMD_WRITE(ptr, float, x);
 	CMD_WRITE(ptr, float, y);
+
+	const float mtx[6] = { x, 0.0f, 0.0f, y, 0.0f, 0.0f };
+	clBoundsStateChanged(cl);
+	clBoundsTransformMult(cl, mtx);
 }
 
 void clTransformTranslate(Context* ctx, CommandListHandle handle, float x, float y)
@@ -2011,6 +3266,10 @@ void clTransformTranslate(Context* ctx, CommandListHandle handle, float x, float
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::TransformTranslate, sizeof(float) * 2);
 	CMD_WRITE(ptr, float, x);
 	CMD_WRITE(ptr, float, y);
+
+	const float mtx[6] = { 1.0f, 0.0f, 0.0f, 1.0f, x, y };
+	clBoundsStateChanged(cl);
+	clBoundsTransformMult(cl, mtx);
 }
 
 void clTransformRotate(Context* ctx, CommandListHandle handle, float ang_rad)
@@ -2020,6 +3279,12 @@ void clTransformRotate(Context* ctx, CommandListHandle handle, float ang_rad)
 
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::TransformRotate, sizeof(float));
 	CMD_WRITE(ptr, float, ang_rad);
+
+	const float c = bx::cos(ang_rad);
+	const float s = bx::sin(ang_rad);
+	const float mtx[6] = { c, s, -s, c, 0.0f, 0.0f };
+	clBoundsStateChanged(cl);
+	clBoundsTransformMult(cl, mtx);
 }
 
 void clTransformMult(Context* ctx, CommandListHandle handle, const float* mtx, TransformOrder::Enum order)
@@ -2031,6 +3296,14 @@ void clTransformMult(Context* ctx, CommandListHandle handle, const float* mtx, T
 	bx::memCopy(ptr, mtx, sizeof(float) * 6);
 	ptr += sizeof(float) * 6;
 	CMD_WRITE(ptr, TransformOrder::Enum, order);
+
+	clBoundsStateChanged(cl);
+	if (order == TransformOrder::Post) {
+		clBoundsTransformMult(cl, mtx);
+	} else {
+		// Pre-multiplied transforms are applied after the transform the list is submitted with.
+		clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+	}
 }
 
 void clSetViewBox(Context* ctx, CommandListHandle handle, float x, float y, float w, float h)
@@ -2043,6 +3316,9 @@ void clSetViewBox(Context* ctx, CommandListHandle handle, float x, float y, floa
 	CMD_WRITE(ptr, float, y);
 	CMD_WRITE(ptr, float, w);
 	CMD_WRITE(ptr, float, h);
+
+	// Depends on the canvas size at submission time.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
 }
 
 void clText(Context* ctx, CommandListHandle handle, const TextConfig& cfg, float x, float y, const char* str, const char* end)
@@ -2065,6 +3341,9 @@ void clText(Context* ctx, CommandListHandle handle, const TextConfig& cfg, float
 	CMD_WRITE(ptr, float, y);
 	CMD_WRITE(ptr, uint32_t, offset);
 	CMD_WRITE(ptr, uint32_t, len);
+
+	// Text bounds depend on the font metrics at submission time.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
 }
 
 void clTextBox(Context* ctx, CommandListHandle handle, const TextConfig& cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textboxFlags)
@@ -2089,6 +3368,9 @@ void clTextBox(Context* ctx, CommandListHandle handle, const TextConfig& cfg, fl
 	CMD_WRITE(ptr, uint32_t, offset);
 	CMD_WRITE(ptr, uint32_t, len);
 	CMD_WRITE(ptr, uint32_t, textboxFlags);
+
+	// Text bounds depend on the font metrics at submission time.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
 }
 
 void clSubmitCommandList(Context* ctx, CommandListHandle parent, CommandListHandle child)
@@ -2098,102 +3380,327 @@ void clSubmitCommandList(Context* ctx, CommandListHandle parent, CommandListHand
 
 	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::SubmitCommandList, sizeof(uint16_t));
 	CMD_WRITE(ptr, uint16_t, child.idx);
+
+	clBoundsAddChild(ctx, cl, child);
 }
 
-// Context
-static void ctxBeginPath(Context* ctx)
+void clBeginLayer(Context* ctx, CommandListHandle handle, LayerHandle layer, uint16_t viewID)
 {
-	const State* state = getState(ctx);
-	const float avgScale = state->m_AvgScale;
-	const float testTol = ctx->m_TesselationTolerance;
-	const float fringeWidth = ctx->m_FringeWidth;
-	Path* path = ctx->m_Path;
-	Stroker* stroker = ctx->m_Stroker;
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
-	pathReset(path, avgScale, testTol);
-	strokerReset(stroker, avgScale, testTol, fringeWidth);
-	ctx->m_PathTransformed = false;
-}
+	uint8_t* ptr = clAllocCommand(ctx, cl, CommandType::BeginLayer, sizeof(uint16_t) * 2);
+	CMD_WRITE(ptr, uint16_t, layer.idx);
+	CMD_WRITE(ptr, uint16_t, viewID);
 
-static void ctxMoveTo(Context* ctx, float x, float y)
-{
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathMoveTo(ctx->m_Path, x, y);
+	// Cached meshes would bypass the layer commands and the layer content should be rendered even
+	// when the list is outside the scissor rect.
+	cl->m_Flags &= ~CommandListFlags::Cacheable;
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
 }
 
-static void ctxLineTo(Context* ctx, float x, float y)
+void clEndLayer(Context* ctx, CommandListHandle handle)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathLineTo(ctx->m_Path, x, y);
-}
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
 
-static void ctxCubicTo(Context* ctx, float c1x, float c1y, float c2x, float c2y, float x, float y)
-{
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathCubicTo(ctx->m_Path, c1x, c1y, c2x, c2y, x, y);
+	clAllocCommand(ctx, cl, CommandType::EndLayer, 0);
 }
 
-static void ctxQuadraticTo(Context* ctx, float cx, float cy, float x, float y)
+uint32_t clGetNextCommandID(Context* ctx, CommandListHandle handle)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathQuadraticTo(ctx->m_Path, cx, cy, x, y);
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	const CommandList* cl = &ctx->m_CmdLists[handle.idx];
+
+	return cl->m_NumStrokerCommands;
 }
 
-static void ctxArc(Context* ctx, float cx, float cy, float r, float a0, float a1, Winding::Enum dir)
+void clSetCommandColor(Context* ctx, CommandListHandle handle, uint32_t cmdID, Color color)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathArc(ctx->m_Path, cx, cy, r, a0, a1, dir);
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+
+	CommandHeader* cmdHeader = clFindStrokerCommand(cl, cmdID);
+	if (!cmdHeader) {
+		VG_CHECK(false, "Invalid command ID");
+		return;
+	}
+
+	uint8_t* cmd = (uint8_t*)cmdHeader + kAlignedCommandHeaderSize;
+	switch (cmdHeader->m_Type) {
+	case CommandType::FillPathColor:
+	case CommandType::FillPathImagePattern:
+		cmd += sizeof(uint32_t); // flags
+		break;
+	case CommandType::StrokePathColor:
+	case CommandType::StrokePathImagePattern:
+		cmd += sizeof(float) + sizeof(uint32_t); // width + flags
+		break;
+	default:
+		VG_CHECK(false, "Gradient commands don't have a color");
+		return;
+	}
+
+	if (*(Color*)cmd == color) {
+		return;
+	}
+
+	*(Color*)cmd = color;
+	cl->m_Revision++;
+
+	// Cached meshes hold only the AA coverage so there's no need to tessellate the command again.
+	// Just make sure the colors baked into the GPU buffers of Retained lists are updated.
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	clCacheInvalidateColors(ctx, cl);
+#endif
+
+	if (cl->m_Prepared) {
+		cl->m_Prepared->m_IsValid = false;
+	}
+}
+
+void clSetCommandVisible(Context* ctx, CommandListHandle handle, uint32_t cmdID, bool visible)
+{
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+
+	CommandHeader* cmdHeader = clFindStrokerCommand(cl, cmdID);
+	if (!cmdHeader) {
+		VG_CHECK(false, "Invalid command ID");
+		return;
+	}
+
+	const uint32_t flags = visible
+		? (cmdHeader->m_Flags & ~CommandFlags::Hidden)
+		: (cmdHeader->m_Flags | CommandFlags::Hidden);
+	if (flags == cmdHeader->m_Flags) {
+		return;
+	}
+
+	cmdHeader->m_Flags = flags;
+
+	clInvalidateCommands(ctx, cl, cmdID, cmdID + 1);
+}
+
+void clReplaceCommandPath(Context* ctx, CommandListHandle handle, uint32_t cmdID, CommandListHandle pathHandle)
+{
+	VG_CHECK(isValid(handle), "Invalid command list handle");
+	VG_CHECK(isValid(pathHandle), "Invalid command list handle");
+	VG_CHECK(handle.idx != pathHandle.idx, "Cannot replace a path with one from the same command list");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+	const CommandList* pathList = &ctx->m_CmdLists[pathHandle.idx];
+
+	// Find the path drawn by the command. It starts right after the last BeginPath before the command
+	// (or at the start of the list) and ends at the next BeginPath (or at the end of the list).
+	const uint32_t cmdListSize = cl->m_CommandBufferPos;
+	uint32_t pathBegin = 0;
+	uint32_t pathEnd = cmdListSize;
+	uint32_t firstPathCmdID = 0;
+	uint32_t nextCmdID = 0;
+	bool found = false;
+
+	uint32_t pos = 0;
+	while (pos < cmdListSize) {
+		const CommandHeader* cmdHeader = (const CommandHeader*)&cl->m_CommandBuffer[pos];
+		const uint32_t nextPos = pos + kAlignedCommandHeaderSize + cmdHeader->m_Size;
+
+		if (cmdHeader->m_Type == CommandType::BeginPath) {
+			if (found) {
+				pathEnd = pos;
+				break;
+			}
+
+			pathBegin = nextPos;
+			firstPathCmdID = nextCmdID;
+		} else if (cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand) {
+			found = found || nextCmdID == cmdID;
+			++nextCmdID;
+		}
+
+		pos = nextPos;
+	}
+
+	if (!found) {
+		VG_CHECK(false, "Invalid command ID");
+		return;
+	}
+
+	// New range = non-path commands of the old range, in their original order, with the path commands
+	// of pathList taking the place of the old path commands.
+	uint32_t newPathSize = 0;
+	for (pos = 0; pos < pathList->m_CommandBufferPos; ) {
+		const CommandHeader* cmdHeader = (const CommandHeader*)&pathList->m_CommandBuffer[pos];
+		const uint32_t cmdSize = kAlignedCommandHeaderSize + cmdHeader->m_Size;
+		VG_CHECK(cmdHeader->m_Type <= CommandType::LastPathCommand, "Path command list should only contain path commands");
+		if (cmdHeader->m_Type > CommandType::FirstPathCommand && cmdHeader->m_Type <= CommandType::LastPathCommand) {
+			newPathSize += cmdSize;
+		}
+		pos += cmdSize;
+	}
+
+	uint32_t oldPathSize = 0;
+	for (pos = pathBegin; pos < pathEnd; ) {
+		const CommandHeader* cmdHeader = (const CommandHeader*)&cl->m_CommandBuffer[pos];
+		const uint32_t cmdSize = kAlignedCommandHeaderSize + cmdHeader->m_Size;
+		if (cmdHeader->m_Type <= CommandType::LastPathCommand) {
+			oldPathSize += cmdSize;
+		}
+		pos += cmdSize;
+	}
+
+	RecordingShard* shard = &ctx->m_RecordingShards[cl->m_ShardID];
+	bx::AllocatorI* allocator = shard->m_Allocator;
+
+	const uint32_t newSize = cmdListSize - oldPathSize + newPathSize;
+	const uint32_t newCapacity = bx::max<uint32_t>(cl->m_CommandBufferCapacity, newSize);
+	uint8_t* newBuffer = (uint8_t*)bx::alignedAlloc(allocator, newCapacity, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
+	uint8_t* dst = newBuffer;
+
+	bx::memCopy(dst, cl->m_CommandBuffer, pathBegin);
+	dst += pathBegin;
+
+	// The new path goes where the first old path command was (or at the start of the range if
+	// there was none) so commands drawn before the old path still come before the new one.
+	bool pathCopied = false;
+	if (oldPathSize == 0) {
+		dst = clCopyPathCommands(pathList, dst);
+		pathCopied = true;
+	}
+
+	for (pos = pathBegin; pos < pathEnd; ) {
+		const CommandHeader* cmdHeader = (const CommandHeader*)&cl->m_CommandBuffer[pos];
+		const uint32_t cmdSize = kAlignedCommandHeaderSize + cmdHeader->m_Size;
+		if (cmdHeader->m_Type > CommandType::LastPathCommand) {
+			bx::memCopy(dst, cmdHeader, cmdSize);
+			dst += cmdSize;
+		} else if (!pathCopied) {
+			dst = clCopyPathCommands(pathList, dst);
+			pathCopied = true;
+		}
+		pos += cmdSize;
+	}
+
+	bx::memCopy(dst, &cl->m_CommandBuffer[pathEnd], cmdListSize - pathEnd);
+	dst += cmdListSize - pathEnd;
+	VG_CHECK((uint32_t)(dst - newBuffer) == newSize, "Invalid command list size");
+
+	bx::alignedFree(allocator, cl->m_CommandBuffer, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
+	cl->m_CommandBuffer = newBuffer;
+	cl->m_CommandBufferPos = newSize;
+
+	shard->m_Stats.m_CmdListMemoryTotal += newCapacity - cl->m_CommandBufferCapacity;
+	shard->m_Stats.m_CmdListMemoryUsed += newSize - cmdListSize;
+	cl->m_CommandBufferCapacity = newCapacity;
+
+	// All commands drawing the path should be tessellated again.
+	clInvalidateCommands(ctx, cl, firstPathCmdID, nextCmdID);
+
+	// The transform at the replaced path isn't known anymore.
+	clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+}
+
+// Copies all path commands of pathList, except BeginPath, to dst. Returns the end of the copied commands.
+static uint8_t* clCopyPathCommands(const CommandList* pathList, uint8_t* dst)
+{
+	for (uint32_t pos = 0; pos < pathList->m_CommandBufferPos; ) {
+		const CommandHeader* cmdHeader = (const CommandHeader*)&pathList->m_CommandBuffer[pos];
+		const uint32_t cmdSize = kAlignedCommandHeaderSize + cmdHeader->m_Size;
+		if (cmdHeader->m_Type > CommandType::FirstPathCommand && cmdHeader->m_Type <= CommandType::LastPathCommand) {
+			bx::memCopy(dst, cmdHeader, cmdSize);
+			dst += cmdSize;
+		}
+		pos += cmdSize;
+	}
+
+	return dst;
+}
+
+// Context
+static void ctxBeginPath(Context* ctx)
+{
+	const State* state = getState(ctx);
+	tessBeginPath(&ctx->m_Tessellator, state->m_AvgScale, ctx->m_TesselationTolerance, ctx->m_FringeWidth);
+}
+
+static void ctxMoveTo(Context* ctx, float x, float y)
+{
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathMoveTo(ctx->m_Tessellator.m_Path, x, y);
+}
+
+static void ctxLineTo(Context* ctx, float x, float y)
+{
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathLineTo(ctx->m_Tessellator.m_Path, x, y);
+}
+
+static void ctxCubicTo(Context* ctx, float c1x, float c1y, float c2x, float c2y, float x, float y)
+{
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathCubicTo(ctx->m_Tessellator.m_Path, c1x, c1y, c2x, c2y, x, y);
+}
+
+static void ctxQuadraticTo(Context* ctx, float cx, float cy, float x, float y)
+{
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathQuadraticTo(ctx->m_Tessellator.m_Path, cx, cy, x, y);
+}
+
+static void ctxArc(Context* ctx, float cx, float cy, float r, float a0, float a1, Winding::Enum dir)
+{
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathArc(ctx->m_Tessellator.m_Path, cx, cy, r, a0, a1, dir);
 }
 
 static void ctxArcTo(Context* ctx, float x1, float y1, float x2, float y2, float r)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathArcTo(ctx->m_Path, x1, y1, x2, y2, r);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathArcTo(ctx->m_Tessellator.m_Path, x1, y1, x2, y2, r);
 }
 
 static void ctxRect(Context* ctx, float x, float y, float w, float h)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathRect(ctx->m_Path, x, y, w, h);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathRect(ctx->m_Tessellator.m_Path, x, y, w, h);
 }
 
 static void ctxRoundedRect(Context* ctx, float x, float y, float w, float h, float r)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathRoundedRect(ctx->m_Path, x, y, w, h, r);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathRoundedRect(ctx->m_Tessellator.m_Path, x, y, w, h, r);
 }
 
 static void ctxRoundedRectVarying(Context* ctx, float x, float y, float w, float h, float rtl, float rtr, float rbr, float rbl)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathRoundedRectVarying(ctx->m_Path, x, y, w, h, rtl, rtr, rbr, rbl);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathRoundedRectVarying(ctx->m_Tessellator.m_Path, x, y, w, h, rtl, rtr, rbr, rbl);
 }
 
 static void ctxCircle(Context* ctx, float cx, float cy, float radius)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathCircle(ctx->m_Path, cx, cy, radius);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathCircle(ctx->m_Tessellator.m_Path, cx, cy, radius);
 }
 
 static void ctxEllipse(Context* ctx, float cx, float cy, float rx, float ry)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathEllipse(ctx->m_Path, cx, cy, rx, ry);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathEllipse(ctx->m_Tessellator.m_Path, cx, cy, rx, ry);
 }
 
 static void ctxPolyline(Context* ctx, const float* coords, uint32_t numPoints)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathPolyline(ctx->m_Path, coords, numPoints);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathPolyline(ctx->m_Tessellator.m_Path, coords, numPoints);
 }
 
 static void ctxClosePath(Context* ctx)
 {
-	VG_CHECK(!ctx->m_PathTransformed, "Call beginPath() before starting a new path");
-	pathClose(ctx->m_Path);
+	VG_CHECK(!ctx->m_Tessellator.m_PathTransformed, "Call beginPath() before starting a new path");
+	pathClose(ctx->m_Tessellator.m_Path);
 }
 
-static void ctxFillPathColor(Context* ctx, Color color, uint32_t flags)
+static void ctxFillPath(Context* ctx, DrawCommand::Type::Enum paintType, uint16_t paintHandle, Color color, uint32_t flags)
 {
 	const bool recordClipCommands = ctx->m_RecordClipCommands;
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
@@ -2202,30 +3709,52 @@ static void ctxFillPathColor(Context* ctx, Color color, uint32_t flags)
 	const bool hasCache = false;
 #endif
 
+	// Cached meshes are rendered with other transforms later so they are never culled.
+	// Clip paths are kept because dropping them would disable clipping for the next draws.
 	const State* state = getState(ctx);
-	const float globalAlpha = hasCache ? 1.0f : state->m_GlobalAlpha;
-	const Color col = recordClipCommands ? Colors::Black : colorSetAlpha(color, (uint8_t)(globalAlpha * colorGetAlpha(color)));
-	if (!hasCache && colorGetAlpha(col) == 0) {
+	if (!hasCache && !recordClipCommands && !tessIsPathVisible(&ctx->m_Tessellator, state->m_TransformMtx, state->m_ScissorRect, ctx->m_FringeWidth)) {
 		return;
 	}
 
-	const float* pathVertices = transformPath(ctx);
-
-#if VG_CONFIG_FORCE_AA_OFF
-	const bool aa = false;
-#else
-	const bool aa = recordClipCommands
-		? false
-		: (bool)((flags & VG_FILL_FLAGS_AA_Msk) >> VG_FILL_FLAGS_AA_Pos)
+	// Stencil-and-cover fills use the stencil buffer themselves so they cannot be drawn while
+	// clipping. Cached meshes are rendered without the stencil pass.
+	const PathType::Enum pathType = (PathType::Enum)((flags & VG_FILL_FLAGS_PATH_TYPE_Msk) >> VG_FILL_FLAGS_PATH_TYPE_Pos);
+	const bool stencilCover = true
+		&& (flags & VG_FILL_FLAGS_STENCIL_COVER_Msk) != 0
+		&& pathType == PathType::Concave
+		&& !recordClipCommands
+		&& !hasCache
+		&& ctx->m_ClipState.m_NumCmds == 0
 		;
+	if (stencilCover) {
+		Color col = Colors::Black;
+		if (paintType != DrawCommand::Type::ColorGradient) {
+			col = colorSetAlpha(color, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(color)));
+			if (colorGetAlpha(col) == 0) {
+				return;
+			}
+		}
+
+		const Path* path = ctx->m_Tessellator.m_Path;
+		const float* pathVertices = tessTransformPath(&ctx->m_Tessellator, state->m_TransformMtx);
+		const FillRule::Enum fillRule = (FillRule::Enum)((flags & VG_FILL_FLAGS_FILL_RULE_Msk) >> VG_FILL_FLAGS_FILL_RULE_Pos);
+		createDrawCommand_StencilCover(ctx, paintType, paintHandle, pathVertices, pathGetSubPaths(path), pathGetNumSubPaths(path), col, fillRule);
+		return;
+	}
+
+#if VG_CONFIG_ENABLE_ANALYTIC_AA && !VG_CONFIG_FORCE_AA_OFF
+	if (paintType == DrawCommand::Type::Textured && !recordClipCommands && !hasCache && (flags & VG_FILL_FLAGS_AA_Msk) != 0) {
+		ctxFillPathAnalyticAA(ctx, state, color, flags);
+		return;
+	}
 #endif
-	const PathType::Enum pathType = (PathType::Enum)((flags & VG_FILL_FLAGS_PATH_TYPE_Msk) >> VG_FILL_FLAGS_PATH_TYPE_Pos);
-	const FillRule::Enum fillRule = (FillRule::Enum)((flags & VG_FILL_FLAGS_FILL_RULE_Msk) >> VG_FILL_FLAGS_FILL_RULE_Pos);
 
-	const Path* path = ctx->m_Path;
-	const uint32_t numSubPaths = pathGetNumSubPaths(path);
-	const SubPath* subPaths = pathGetSubPaths(path);
-	Stroker* stroker = ctx->m_Stroker;
+	DrawCommandMeshSink sink;
+	sink.m_Context = ctx;
+	sink.m_Type = (recordClipCommands && paintType == DrawCommand::Type::Textured) ? DrawCommand::Type::Clip : paintType;
+	sink.m_Handle = paintHandle;
+	sink.m_Color = colorSetAlpha(color, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(color)));
+	sink.m_AddToCache = hasCache;
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
 	if (hasCache) {
@@ -2233,81 +3762,55 @@ static void ctxFillPathColor(Context* ctx, Color color, uint32_t flags)
 	}
 #endif
 
-	if (pathType == PathType::Convex) {
-		for (uint32_t i = 0; i < numSubPaths; ++i) {
-			const SubPath* subPath = &subPaths[i];
-			if (subPath->m_NumVertices < 3) {
-				continue;
-			}
-
-			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-			const uint32_t numPathVertices = subPath->m_NumVertices;
-
-			Mesh mesh;
-			const uint32_t* colors = &col;
-			uint32_t numColors = 1;
-
-			if (aa) {
-				strokerConvexFillAA(stroker, &mesh, vtx, numPathVertices, col);
-				colors = mesh.m_ColorBuffer;
-				numColors = mesh.m_NumVertices;
-			} else {
-				strokerConvexFill(stroker, &mesh, vtx, numPathVertices);
-			}
+	// Cached meshes are tessellated using white so the vertex colors hold only the AA coverage.
+	// The paint color is applied in submitCachedMesh() and, for the mesh drawn right away, in
+	// drawCommandMeshCallback().
+	tessFillPath(&ctx->m_Tessellator, state, paintType, hasCache ? Colors::White : color, flags, recordClipCommands, hasCache, drawCommandMeshCallback, &sink);
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
-			if (hasCache) {
-				addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
+	if (hasCache) {
+		endCachedCommand(ctx);
+	}
 #endif
+}
 
-			if (recordClipCommands) {
-				createDrawCommand_Clip(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			} else {
-				createDrawCommand_VertexColor(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
-		}
-	} else if (pathType == PathType::Concave) {
-		strokerConcaveFillBegin(stroker);
-		for (uint32_t i = 0; i < numSubPaths; ++i) {
-			const SubPath* subPath = &subPaths[i];
-			if (subPath->m_NumVertices < 3) {
-				return;
-			}
+static void ctxStrokePath(Context* ctx, DrawCommand::Type::Enum paintType, uint16_t paintHandle, Color color, float width, uint32_t flags)
+{
+	const bool recordClipCommands = ctx->m_RecordClipCommands;
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	const bool hasCache = getCommandListCacheStackTop(ctx) != nullptr;
+#else
+	const bool hasCache = false;
+#endif
 
-			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-			const uint32_t numPathVertices = subPath->m_NumVertices;
-			strokerConcaveFillAddContour(stroker, vtx, numPathVertices);
-		}
+	// See ctxFillPath()
+	const State* state = getState(ctx);
+	if (!hasCache && !recordClipCommands && !tessIsPathVisible(&ctx->m_Tessellator, state->m_TransformMtx, state->m_ScissorRect, tessCalcStrokeMargin(state, ctx->m_FringeWidth, width, flags))) {
+		return;
+	}
 
-		Mesh mesh;
-		const uint32_t* colors = &col;
-		uint32_t numColors = 1;
+#if VG_CONFIG_ENABLE_ANALYTIC_AA && !VG_CONFIG_FORCE_AA_OFF
+	if (paintType == DrawCommand::Type::Textured && !recordClipCommands && !hasCache && (flags & VG_STROKE_FLAGS_AA_Msk) != 0) {
+		ctxStrokePathAnalyticAA(ctx, state, color, width, flags);
+		return;
+	}
+#endif
 
-		bool decomposed = false;
-		if (aa) {
-			decomposed = strokerConcaveFillEndAA(stroker, &mesh, col, fillRule);
-			colors = mesh.m_ColorBuffer;
-			numColors = mesh.m_NumVertices;
-		} else {
-			decomposed = strokerConcaveFillEnd(stroker, &mesh, fillRule);
-		}
+	DrawCommandMeshSink sink;
+	sink.m_Context = ctx;
+	sink.m_Type = (recordClipCommands && paintType == DrawCommand::Type::Textured) ? DrawCommand::Type::Clip : paintType;
+	sink.m_Handle = paintHandle;
+	sink.m_Color = colorSetAlpha(color, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(color)));
+	sink.m_AddToCache = hasCache;
 
-		VG_WARN(decomposed, "Failed to triangulate concave polygon");
-		if (decomposed) {
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
-			if (hasCache) {
-				addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
+	if (hasCache) {
+		beginCachedCommand(ctx);
+	}
 #endif
 
-			if (recordClipCommands) {
-				createDrawCommand_Clip(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			} else {
-				createDrawCommand_VertexColor(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
-		}
-	}
+	// See ctxFillPath()
+	tessStrokePath(&ctx->m_Tessellator, state, ctx->m_FringeWidth, paintType, hasCache ? Colors::White : color, width, flags, recordClipCommands, hasCache, drawCommandMeshCallback, &sink);
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
 	if (hasCache) {
@@ -2316,36 +3819,26 @@ static void ctxFillPathColor(Context* ctx, Color color, uint32_t flags)
 #endif
 }
 
-static void ctxFillPathGradient(Context* ctx, GradientHandle gradientHandle, uint32_t flags)
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+// Same as tessFillPath() for solid color AA fills, but the fringes are drawn by the coverage program
+// so fills are batched together with analytic AA strokes.
+static void ctxFillPathAnalyticAA(Context* ctx, const State* state, Color color, uint32_t flags)
 {
-	VG_CHECK(!ctx->m_RecordClipCommands, "Only fillPath(Color) is supported inside BeginClip()/EndClip()");
-	VG_CHECK(isValid(gradientHandle), "Invalid gradient handle");
-	VG_CHECK(!isLocal(gradientHandle), "Invalid gradient handle");
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	const bool hasCache = getCommandListCacheStackTop(ctx) != nullptr;
-#endif
-
-	const float* pathVertices = transformPath(ctx);
+	const Color col = colorSetAlpha(color, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(color)));
+	if (colorGetAlpha(col) == 0) {
+		return;
+	}
 
 	const PathType::Enum pathType = (PathType::Enum)((flags & VG_FILL_FLAGS_PATH_TYPE_Msk) >> VG_FILL_FLAGS_PATH_TYPE_Pos);
 	const FillRule::Enum fillRule = (FillRule::Enum)((flags & VG_FILL_FLAGS_FILL_RULE_Msk) >> VG_FILL_FLAGS_FILL_RULE_Pos);
-#if VG_CONFIG_FORCE_AA_OFF
-	const bool aa = false;
-#else
-	const bool aa = (bool)((flags & VG_FILL_FLAGS_AA_Msk) >> VG_FILL_FLAGS_AA_Pos);
-#endif
 
-	Stroker* stroker = ctx->m_Stroker;
-	const Path* path = ctx->m_Path;
+	Tessellator* tess = &ctx->m_Tessellator;
+	const float* pathVertices = tessTransformPath(tess, state->m_TransformMtx);
+
+	const Path* path = tess->m_Path;
 	const uint32_t numSubPaths = pathGetNumSubPaths(path);
 	const SubPath* subPaths = pathGetSubPaths(path);
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		beginCachedCommand(ctx);
-	}
-#endif
+	Stroker* stroker = tess->m_Stroker;
 
 	if (pathType == PathType::Convex) {
 		for (uint32_t i = 0; i < numSubPaths; ++i) {
@@ -2354,29 +3847,11 @@ static void ctxFillPathGradient(Context* ctx, GradientHandle gradientHandle, uin
 				continue;
 			}
 
-			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-			const uint32_t numPathVertices = subPath->m_NumVertices;
-
 			Mesh mesh;
-			const uint32_t black = Colors::Black;
-			const uint32_t* colors = &black;
-			uint32_t numColors = 1;
-
-			if (aa) {
-				strokerConvexFillAA(stroker, &mesh, vtx, numPathVertices, Colors::Black);
-				colors = mesh.m_ColorBuffer;
-				numColors = mesh.m_NumVertices;
-			} else {
-				strokerConvexFill(stroker, &mesh, vtx, numPathVertices);
-			}
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-			if (hasCache) {
-				addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
-#endif
+			const float* uv = nullptr;
+			strokerConvexFillAnalyticAA(stroker, &mesh, &uv, &pathVertices[subPath->m_FirstVertexID << 1], subPath->m_NumVertices);
 
-			createDrawCommand_ColorGradient(ctx, gradientHandle, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
+			createDrawCommand_Coverage(ctx, mesh.m_PosBuffer, uv, mesh.m_NumVertices, col, mesh.m_IndexBuffer, mesh.m_NumIndices);
 		}
 	} else if (pathType == PathType::Concave) {
 		strokerConcaveFillBegin(stroker);
@@ -2386,506 +3861,303 @@ static void ctxFillPathGradient(Context* ctx, GradientHandle gradientHandle, uin
 				return;
 			}
 
-			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-			const uint32_t numPathVertices = subPath->m_NumVertices;
-			strokerConcaveFillAddContour(stroker, vtx, numPathVertices);
+			strokerConcaveFillAddContour(stroker, &pathVertices[subPath->m_FirstVertexID << 1], subPath->m_NumVertices);
 		}
 
-		const Color black = Colors::Black;
 		Mesh mesh;
-		const uint32_t* colors = &black;
-		uint32_t numColors = 1;
-
-		bool decomposed = false;
-		if (aa) {
-			decomposed = strokerConcaveFillEndAA(stroker, &mesh, black, fillRule);
-			colors = mesh.m_ColorBuffer;
-			numColors = mesh.m_NumVertices;
-		} else {
-			decomposed = strokerConcaveFillEnd(stroker, &mesh, fillRule);
-		}
-
+		const float* uv = nullptr;
+		const bool decomposed = strokerConcaveFillEndAnalyticAA(stroker, &mesh, &uv, fillRule);
 		VG_WARN(decomposed, "Failed to triangulate concave polygon");
 		if (decomposed) {
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-			if (hasCache) {
-				addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
-#endif
-
-			createDrawCommand_ColorGradient(ctx, gradientHandle, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
+			createDrawCommand_Coverage(ctx, mesh.m_PosBuffer, uv, mesh.m_NumVertices, col, mesh.m_IndexBuffer, mesh.m_NumIndices);
 		}
 	}
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		endCachedCommand(ctx);
-	}
-#endif
 }
 
-static void ctxFillPathImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, Color color, uint32_t flags)
+// Same as tessStrokePath() for solid color AA strokes, but the outline is drawn by the coverage
+// program instead of fringe geometry.
+static void ctxStrokePathAnalyticAA(Context* ctx, const State* state, Color color, float width, uint32_t flags)
 {
-	VG_CHECK(!ctx->m_RecordClipCommands, "Only fillPath(Color) is supported inside BeginClip()/EndClip()");
-	VG_CHECK(isValid(imgPatternHandle), "Invalid image pattern handle");
-	VG_CHECK(!isLocal(imgPatternHandle), "Invalid gradient handle");
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	const bool hasCache = getCommandListCacheStackTop(ctx) != nullptr;
-#else
-	const bool hasCache = false;
-#endif
+	const float fringeWidth = ctx->m_FringeWidth;
+	const float scaledStrokeWidth = ((flags & StrokeFlags::FixedWidth) != 0) ? width : bx::clamp<float>(width * state->m_AvgScale, 0.0f, 200.0f);
+	const bool isThin = scaledStrokeWidth <= fringeWidth;
 
-	const State* state = getState(ctx);
-	const float globalAlpha = hasCache ? 1.0f : state->m_GlobalAlpha;
-	const Color col = colorSetAlpha(color, (uint8_t)(globalAlpha * colorGetAlpha(color)));
-	if (!hasCache && colorGetAlpha(col) == 0) {
+	const float alphaScale = !isThin ? state->m_GlobalAlpha : state->m_GlobalAlpha * bx::square(bx::clamp<float>(scaledStrokeWidth, 0.0f, fringeWidth));
+	const Color col = colorSetAlpha(color, (uint8_t)(alphaScale * colorGetAlpha(color)));
+	if (colorGetAlpha(col) == 0) {
 		return;
 	}
 
-	const PathType::Enum pathType = (PathType::Enum)((flags & VG_FILL_FLAGS_PATH_TYPE_Msk) >> VG_FILL_FLAGS_PATH_TYPE_Pos);
-	const FillRule::Enum fillRule = (FillRule::Enum)((flags & VG_FILL_FLAGS_FILL_RULE_Msk) >> VG_FILL_FLAGS_FILL_RULE_Pos);
-#if VG_CONFIG_FORCE_AA_OFF
-	const bool aa = false;
-#else
-	const bool aa = (bool)((flags & VG_FILL_FLAGS_AA_Msk) >> VG_FILL_FLAGS_AA_Pos);
-#endif
+	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
+	const LineCap::Enum lineCap = (LineCap::Enum)((flags & VG_STROKE_FLAGS_LINE_CAP_Msk) >> VG_STROKE_FLAGS_LINE_CAP_Pos);
+	const float strokeWidth = isThin ? fringeWidth : scaledStrokeWidth;
 
-	const float* pathVertices = transformPath(ctx);
+	Tessellator* tess = &ctx->m_Tessellator;
+	const float* pathVertices = tessTransformPath(tess, state->m_TransformMtx);
 
-	Stroker* stroker = ctx->m_Stroker;
-	const Path* path = ctx->m_Path;
+	const Path* path = tess->m_Path;
 	const uint32_t numSubPaths = pathGetNumSubPaths(path);
 	const SubPath* subPaths = pathGetSubPaths(path);
+	for (uint32_t iSubPath = 0; iSubPath < numSubPaths; ++iSubPath) {
+		const SubPath* subPath = &subPaths[iSubPath];
+		if (subPath->m_NumVertices < 2) {
+			continue;
+		}
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		beginCachedCommand(ctx);
+		Mesh mesh;
+		const float* uv = nullptr;
+		strokerPolylineStrokeAnalyticAA(tess->m_Stroker, &mesh, &uv, &pathVertices[subPath->m_FirstVertexID << 1], subPath->m_NumVertices, subPath->m_IsClosed, strokeWidth, lineCap, lineJoin);
+
+		createDrawCommand_Coverage(ctx, mesh.m_PosBuffer, uv, mesh.m_NumVertices, col, mesh.m_IndexBuffer, mesh.m_NumIndices);
 	}
+}
 #endif
 
-	if (pathType == PathType::Convex) {
-		for (uint32_t i = 0; i < numSubPaths; ++i) {
-			const SubPath* subPath = &subPaths[i];
-			if (subPath->m_NumVertices < 3) {
-				continue;
-			}
-
-			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-			const uint32_t numPathVertices = subPath->m_NumVertices;
+static void ctxFillPathColor(Context* ctx, Color color, uint32_t flags)
+{
+	ctxFillPath(ctx, DrawCommand::Type::Textured, UINT16_MAX, color, flags);
+}
 
-			Mesh mesh;
-			const uint32_t* colors = &col;
-			uint32_t numColors = 1;
+static void ctxFillPathGradient(Context* ctx, GradientHandle gradientHandle, uint32_t flags)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Only fillPath(Color) is supported inside BeginClip()/EndClip()");
+	VG_CHECK(isValid(gradientHandle), "Invalid gradient handle");
+	VG_CHECK(!isLocal(gradientHandle), "Invalid gradient handle");
 
-			if (aa) {
-				strokerConvexFillAA(stroker, &mesh, vtx, numPathVertices, col);
-				colors = mesh.m_ColorBuffer;
-				numColors = mesh.m_NumVertices;
-			} else {
-				strokerConvexFill(stroker, &mesh, vtx, numPathVertices);
-			}
+	ctxFillPath(ctx, DrawCommand::Type::ColorGradient, gradientHandle.idx, Colors::Black, flags);
+}
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-			if (hasCache) {
-				addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
-#endif
+static void ctxFillPathImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, Color color, uint32_t flags)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Only fillPath(Color) is supported inside BeginClip()/EndClip()");
+	VG_CHECK(isValid(imgPatternHandle), "Invalid image pattern handle");
+	VG_CHECK(!isLocal(imgPatternHandle), "Invalid gradient handle");
 
-			createDrawCommand_ImagePattern(ctx, imgPatternHandle, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		}
-	} else if (pathType == PathType::Concave) {
-		strokerConcaveFillBegin(stroker);
-		for (uint32_t i = 0; i < numSubPaths; ++i) {
-			const SubPath* subPath = &subPaths[i];
-			if (subPath->m_NumVertices < 3) {
-				return;
-			}
+	ctxFillPath(ctx, DrawCommand::Type::ImagePattern, imgPatternHandle.idx, color, flags);
+}
 
-			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-			const uint32_t numPathVertices = subPath->m_NumVertices;
-			strokerConcaveFillAddContour(stroker, vtx, numPathVertices);
-		}
+static void ctxStrokePathColor(Context* ctx, Color color, float width, uint32_t flags)
+{
+	ctxStrokePath(ctx, DrawCommand::Type::Textured, UINT16_MAX, color, width, flags);
+}
 
-		Mesh mesh;
-		const uint32_t* colors = &col;
-		uint32_t numColors = 1;
+static void ctxStrokePathGradient(Context* ctx, GradientHandle gradientHandle, float width, uint32_t flags)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Only strokePath(Color) is supported inside BeginClip()/EndClip()");
+	VG_CHECK(isValid(gradientHandle), "Invalid gradient handle");
+	VG_CHECK(!isLocal(gradientHandle), "Invalid gradient handle");
 
-		bool decomposed = false;
-		if (aa) {
-			decomposed = strokerConcaveFillEndAA(stroker, &mesh, col, fillRule);
-			colors = mesh.m_ColorBuffer;
-			numColors = mesh.m_NumVertices;
-		} else {
-			decomposed = strokerConcaveFillEnd(stroker, &mesh, fillRule);
-		}
+	ctxStrokePath(ctx, DrawCommand::Type::ColorGradient, gradientHandle.idx, Colors::Black, width, flags);
+}
 
-		VG_WARN(decomposed, "Failed to triangulate concave polygon");
-		if (decomposed) {
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-			if (hasCache) {
-				addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-			}
-#endif
+static void ctxStrokePathImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, Color color, float width, uint32_t flags)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Only strokePath(Color) is supported inside BeginClip()/EndClip()");
+	VG_CHECK(isValid(imgPatternHandle), "Invalid image pattern handle");
+	VG_CHECK(!isLocal(imgPatternHandle), "Invalid gradient handle");
 
-			createDrawCommand_ImagePattern(ctx, imgPatternHandle, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		}
+	ctxStrokePath(ctx, DrawCommand::Type::ImagePattern, imgPatternHandle.idx, color, width, flags);
+}
+
+// Executes a path command (see CommandType::FirstPathCommand/LastPathCommand). cmd points to the command data.
+static void ctxExecPathCommand(Context* ctx, CommandType::Enum type, const uint8_t* cmd)
+{
+	switch (type) {
+	case CommandType::BeginPath: {
+		ctxBeginPath(ctx);
+	} break;
+	case CommandType::ClosePath: {
+		ctxClosePath(ctx);
+	} break;
+	case CommandType::MoveTo: {
+		const float* coords = (float*)cmd;
+		ctxMoveTo(ctx, coords[0], coords[1]);
+	} break;
+	case CommandType::LineTo: {
+		const float* coords = (float*)cmd;
+		ctxLineTo(ctx, coords[0], coords[1]);
+	} break;
+	case CommandType::CubicTo: {
+		const float* coords = (float*)cmd;
+		ctxCubicTo(ctx, coords[0], coords[1], coords[2], coords[3], coords[4], coords[5]);
+	} break;
+	case CommandType::QuadraticTo: {
+		const float* coords = (float*)cmd;
+		ctxQuadraticTo(ctx, coords[0], coords[1], coords[2], coords[3]);
+	} break;
+	case CommandType::Arc: {
+		const float* coords = (float*)cmd;
+		cmd += sizeof(float) * 5;
+		const Winding::Enum dir = CMD_READ(cmd, Winding::Enum);
+		ctxArc(ctx, coords[0], coords[1], coords[2], coords[3], coords[4], dir);
+	} break;
+	case CommandType::ArcTo: {
+		const float* coords = (float*)cmd;
+		ctxArcTo(ctx, coords[0], coords[1], coords[2], coords[3], coords[4]);
+	} break;
+	case CommandType::Rect: {
+		const float* coords = (float*)cmd;
+		ctxRect(ctx, coords[0], coords[1], coords[2], coords[3]);
+	} break;
+	case CommandType::RoundedRect: {
+		const float* coords = (float*)cmd;
+		ctxRoundedRect(ctx, coords[0], coords[1], coords[2], coords[3], coords[4]);
+	} break;
+	case CommandType::RoundedRectVarying: {
+		const float* coords = (float*)cmd;
+		ctxRoundedRectVarying(ctx, coords[0], coords[1], coords[2], coords[3], coords[4], coords[5], coords[6], coords[7]);
+	} break;
+	case CommandType::Circle: {
+		const float* coords = (float*)cmd;
+		ctxCircle(ctx, coords[0], coords[1], coords[2]);
+	} break;
+	case CommandType::Ellipse: {
+		const float* coords = (float*)cmd;
+		ctxEllipse(ctx, coords[0], coords[1], coords[2], coords[3]);
+	} break;
+	case CommandType::Polyline: {
+		const uint32_t numPoints = CMD_READ(cmd, uint32_t);
+		const float* coords = (float*)cmd;
+		ctxPolyline(ctx, coords, numPoints);
+	} break;
+	default: {
+		VG_CHECK(false, "Not a path command");
+	} break;
 	}
+}
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		endCachedCommand(ctx);
+// Executes a stroker command (see CommandType::FirstStrokerCommand/LastStrokerCommand). cmd points to the command data.
+static void ctxExecStrokerCommand(Context* ctx, CommandType::Enum type, const uint8_t* cmd, uint16_t firstGradientID, uint16_t firstImagePatternID)
+{
+	switch (type) {
+	case CommandType::FillPathColor: {
+		const uint32_t flags = CMD_READ(cmd, uint32_t);
+		const Color color = CMD_READ(cmd, Color);
+		ctxFillPathColor(ctx, color, flags);
+	} break;
+	case CommandType::FillPathGradient: {
+		const uint32_t flags = CMD_READ(cmd, uint32_t);
+		const uint16_t gradientHandle = CMD_READ(cmd, uint16_t);
+		const uint16_t gradientFlags = CMD_READ(cmd, uint16_t);
+
+		const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
+		ctxFillPathGradient(ctx, gradient, flags);
+	} break;
+	case CommandType::FillPathImagePattern: {
+		const uint32_t flags = CMD_READ(cmd, uint32_t);
+		const Color color = CMD_READ(cmd, Color);
+		const uint16_t imgPatternHandle = CMD_READ(cmd, uint16_t);
+		const uint16_t imgPatternFlags = CMD_READ(cmd, uint16_t);
+
+		const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
+		ctxFillPathImagePattern(ctx, imgPattern, color, flags);
+	} break;
+	case CommandType::StrokePathColor: {
+		const float width = CMD_READ(cmd, float);
+		const uint32_t flags = CMD_READ(cmd, uint32_t);
+		const Color color = CMD_READ(cmd, Color);
+		ctxStrokePathColor(ctx, color, width, flags);
+	} break;
+	case CommandType::StrokePathGradient: {
+		const float width = CMD_READ(cmd, float);
+		const uint32_t flags = CMD_READ(cmd, uint32_t);
+		const uint16_t gradientHandle = CMD_READ(cmd, uint16_t);
+		const uint16_t gradientFlags = CMD_READ(cmd, uint16_t);
+
+		const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
+		ctxStrokePathGradient(ctx, gradient, width, flags);
+	} break;
+	case CommandType::StrokePathImagePattern: {
+		const float width = CMD_READ(cmd, float);
+		const uint32_t flags = CMD_READ(cmd, uint32_t);
+		const Color color = CMD_READ(cmd, Color);
+		const uint16_t imgPatternHandle = CMD_READ(cmd, uint16_t);
+		const uint16_t imgPatternFlags = CMD_READ(cmd, uint16_t);
+
+		const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
+		ctxStrokePathImagePattern(ctx, imgPattern, color, width, flags);
+	} break;
+	default: {
+		VG_CHECK(false, "Not a stroker command");
+	} break;
 	}
-#endif
 }
 
-static void ctxStrokePathColor(Context* ctx, Color color, float width, uint32_t flags)
+static void ctxBeginClip(Context* ctx, ClipRule::Enum rule)
 {
-	const bool recordClipCommands = ctx->m_RecordClipCommands;
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	const bool hasCache = getCommandListCacheStackTop(ctx) != nullptr;
-#else
-	const bool hasCache = false;
-#endif
-
-	const State* state = getState(ctx);
-	const float avgScale = state->m_AvgScale;
-	const float globalAlpha = hasCache ? 1.0f : state->m_GlobalAlpha;
-	const float fringeWidth = ctx->m_FringeWidth;
-
-	const float scaledStrokeWidth = ((flags & StrokeFlags::FixedWidth) != 0) ? width : bx::clamp<float>(width * avgScale, 0.0f, 200.0f);
-	const bool isThin = scaledStrokeWidth <= fringeWidth;
-
-	const float alphaScale = !isThin ? globalAlpha : globalAlpha * bx::square(bx::clamp<float>(scaledStrokeWidth, 0.0f, fringeWidth));
-	const Color col = recordClipCommands ? Colors::Black : colorSetAlpha(color, (uint8_t)(alphaScale * colorGetAlpha(color)));
-	if (!hasCache && colorGetAlpha(col) == 0) {
-		return;
-	}
-
-	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
-	const LineCap::Enum lineCap = (LineCap::Enum)((flags & VG_STROKE_FLAGS_LINE_CAP_Msk) >> VG_STROKE_FLAGS_LINE_CAP_Pos);
-#if VG_CONFIG_FORCE_AA_OFF
-	const bool aa = false;
-#else
-	const bool aa = recordClipCommands
-		? false
-		: (bool)((flags & VG_STROKE_FLAGS_AA_Msk) >> VG_STROKE_FLAGS_AA_Pos)
-		;
-#endif
+	VG_CHECK(!ctx->m_RecordClipCommands, "Already inside beginClip()/endClip() block");
 
-	const float strokeWidth = isThin ? fringeWidth : scaledStrokeWidth;
+	ClipState* clipState = &ctx->m_ClipState;
+	const uint32_t nextClipCmdID = ctx->m_NumClipCommands;
 
-	const float* pathVertices = transformPath(ctx);
+	clipState->m_Rule = rule;
+	clipState->m_FirstCmdID = nextClipCmdID;
+	clipState->m_NumCmds = 0;
 
-	const Path* path = ctx->m_Path;
-	const uint32_t numSubPaths = pathGetNumSubPaths(path);
-	const SubPath* subPaths = pathGetSubPaths(path);
-	Stroker* stroker = ctx->m_Stroker;
+	ctx->m_RecordClipCommands = true;
+	ctx->m_ForceNewClipCommand = true;
+}
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		beginCachedCommand(ctx);
-	}
-#endif
+static void ctxEndClip(Context* ctx)
+{
+	VG_CHECK(ctx->m_RecordClipCommands, "Must be called once after beginClip()");
 
-	for (uint32_t iSubPath = 0; iSubPath < numSubPaths; ++iSubPath) {
-		const SubPath* subPath = &subPaths[iSubPath];
-		if (subPath->m_NumVertices < 2) {
-			continue;
-		}
+	ClipState* clipState = &ctx->m_ClipState;
+	const uint32_t nextClipCmdID = ctx->m_NumClipCommands;
 
-		const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-		const uint32_t numPathVertices = subPath->m_NumVertices;
-		const bool isClosed = subPath->m_IsClosed;
+	clipState->m_NumCmds = nextClipCmdID - clipState->m_FirstCmdID;
 
-		Mesh mesh;
-		const uint32_t* colors = &col;
-		uint32_t numColors = 1;
-		if (aa) {
-			if (isThin) {
-				strokerPolylineStrokeAAThin(stroker, &mesh, vtx, numPathVertices, isClosed, col, lineCap, lineJoin);
-			} else {
-				strokerPolylineStrokeAA(stroker, &mesh, vtx, numPathVertices, isClosed, col, strokeWidth, lineCap, lineJoin);
-			}
+	ctx->m_RecordClipCommands = false;
+	ctx->m_ForceNewDrawCommand = true;
+}
 
-			colors = mesh.m_ColorBuffer;
-			numColors = mesh.m_NumVertices;
-		} else {
-			strokerPolylineStroke(stroker, &mesh, vtx, numPathVertices, isClosed, strokeWidth, lineCap, lineJoin);
-		}
+static void ctxResetClip(Context* ctx)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Must be called outside beginClip()/endClip() pair.");
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-		if (hasCache) {
-			addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		}
-#endif
+	ClipState* clipState = &ctx->m_ClipState;
 
-		if (recordClipCommands) {
-			createDrawCommand_Clip(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		} else {
-			createDrawCommand_VertexColor(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		}
-	}
+	if (clipState->m_FirstCmdID != ~0u) {
+		clipState->m_FirstCmdID = ~0u;
+		clipState->m_NumCmds = 0;
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		endCachedCommand(ctx);
+		ctx->m_ForceNewDrawCommand = true;
 	}
-#endif
 }
 
-static void ctxStrokePathGradient(Context* ctx, GradientHandle gradientHandle, float width, uint32_t flags)
+static GradientHandle ctxCreateLinearGradient(Context* ctx, float sx, float sy, float ex, float ey, Color icol, Color ocol)
 {
-	VG_CHECK(!ctx->m_RecordClipCommands, "Only strokePath(Color) is supported inside BeginClip()/EndClip()");
-	VG_CHECK(isValid(gradientHandle), "Invalid gradient handle");
-	VG_CHECK(!isLocal(gradientHandle), "Invalid gradient handle");
+	if (ctx->m_NextGradientID >= ctx->m_Config.m_MaxGradients) {
+		return VG_INVALID_HANDLE32;
+	}
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	const bool hasCache = getCommandListCacheStackTop(ctx) != nullptr;
-#endif
+	GradientHandle handle = { (uint16_t)ctx->m_NextGradientID++, 0 };
 
-	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
-	const LineCap::Enum lineCap = (LineCap::Enum)((flags & VG_STROKE_FLAGS_LINE_CAP_Msk) >> VG_STROKE_FLAGS_LINE_CAP_Pos);
-#if VG_CONFIG_FORCE_AA_OFF
-	const bool aa = false;
-#else
-	const bool aa = (bool)((flags & VG_STROKE_FLAGS_AA_Msk) >> VG_STROKE_FLAGS_AA_Pos);
-#endif
+	const float large = 1e5;
+	float dx = ex - sx;
+	float dy = ey - sy;
+	float d = bx::sqrt(dx * dx + dy * dy);
+	if (d > 0.0001f) {
+		dx /= d;
+		dy /= d;
+	} else {
+		dx = 0;
+		dy = 1;
+	}
 
-	const float* pathVertices = transformPath(ctx);
+	float gradientMatrix[6];
+	gradientMatrix[0] = dy;
+	gradientMatrix[1] = -dx;
+	gradientMatrix[2] = dx;
+	gradientMatrix[3] = dy;
+	gradientMatrix[4] = sx - dx * large;
+	gradientMatrix[5] = sy - dy * large;
 
 	const State* state = getState(ctx);
-	const float avgScale = state->m_AvgScale;
-	float strokeWidth = ((flags & StrokeFlags::FixedWidth) != 0) ? width : bx::clamp<float>(width * avgScale, 0.0f, 200.0f);
-	bool isThin = false;
-	if (strokeWidth <= ctx->m_FringeWidth) {
-		strokeWidth = ctx->m_FringeWidth;
-		isThin = true;
-	}
+	const float* stateTransform = state->m_TransformMtx;
 
-	Stroker* stroker = ctx->m_Stroker;
-	const Path* path = ctx->m_Path;
-	const uint32_t numSubPaths = pathGetNumSubPaths(path);
-	const SubPath* subPaths = pathGetSubPaths(path);
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		beginCachedCommand(ctx);
-	}
-#endif
-
-	for (uint32_t iSubPath = 0; iSubPath < numSubPaths; ++iSubPath) {
-		const SubPath* subPath = &subPaths[iSubPath];
-		if (subPath->m_NumVertices < 2) {
-			continue;
-		}
-
-		const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-		const uint32_t numPathVertices = subPath->m_NumVertices;
-		const bool isClosed = subPath->m_IsClosed;
-
-		Mesh mesh;
-		const uint32_t black = Colors::Black;
-		const uint32_t* colors = &black;
-		uint32_t numColors = 1;
-
-		if (aa) {
-			if (isThin) {
-				strokerPolylineStrokeAAThin(stroker, &mesh, vtx, numPathVertices, isClosed, vg::Colors::Black, lineCap, lineJoin);
-			} else {
-				strokerPolylineStrokeAA(stroker, &mesh, vtx, numPathVertices, isClosed, vg::Colors::Black, strokeWidth, lineCap, lineJoin);
-			}
-
-			colors = mesh.m_ColorBuffer;
-			numColors = mesh.m_NumVertices;
-		} else {
-			strokerPolylineStroke(stroker, &mesh, vtx, numPathVertices, isClosed, strokeWidth, lineCap, lineJoin);
-		}
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-		if (hasCache) {
-			addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		}
-#endif
-
-		createDrawCommand_ColorGradient(ctx, gradientHandle, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-	}
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		endCachedCommand(ctx);
-	}
-#endif
-}
-
-static void ctxStrokePathImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, Color color, float width, uint32_t flags)
-{
-	VG_CHECK(!ctx->m_RecordClipCommands, "Only strokePath(Color) is supported inside BeginClip()/EndClip()");
-	VG_CHECK(isValid(imgPatternHandle), "Invalid image pattern handle");
-	VG_CHECK(!isLocal(imgPatternHandle), "Invalid gradient handle");
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	const bool hasCache = getCommandListCacheStackTop(ctx) != nullptr;
-#else
-	const bool hasCache = false;
-#endif
-
-	const State* state = getState(ctx);
-	const float avgScale = state->m_AvgScale;
-	const float globalAlpha = hasCache ? 1.0f : state->m_GlobalAlpha;
-	const float fringeWidth = ctx->m_FringeWidth;
-
-	const float scaledStrokeWidth = ((flags & StrokeFlags::FixedWidth) != 0) ? width : bx::clamp<float>(width * avgScale, 0.0f, 200.0f);
-	const bool isThin = scaledStrokeWidth <= fringeWidth;
-
-	const float alphaScale = isThin ? globalAlpha : globalAlpha * bx::square(bx::clamp<float>(scaledStrokeWidth, 0.0f, fringeWidth));
-	const Color col = colorSetAlpha(color, (uint8_t)(alphaScale * colorGetAlpha(color)));
-	if (!hasCache && colorGetAlpha(col) == 0) {
-		return;
-	}
-
-	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
-	const LineCap::Enum lineCap = (LineCap::Enum)((flags & VG_STROKE_FLAGS_LINE_CAP_Msk) >> VG_STROKE_FLAGS_LINE_CAP_Pos);
-#if VG_CONFIG_FORCE_AA_OFF
-	const bool aa = false;
-#else
-	const bool aa = (bool)((flags & VG_STROKE_FLAGS_AA_Msk) >> VG_STROKE_FLAGS_AA_Pos);
-#endif
-
-	const float strokeWidth = isThin ? fringeWidth : scaledStrokeWidth;
-
-	const float* pathVertices = transformPath(ctx);
-
-	Stroker* stroker = ctx->m_Stroker;
-	const Path* path = ctx->m_Path;
-	const uint32_t numSubPaths = pathGetNumSubPaths(path);
-	const SubPath* subPaths = pathGetSubPaths(path);
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		beginCachedCommand(ctx);
-	}
-#endif
-
-	for (uint32_t iSubPath = 0; iSubPath < numSubPaths; ++iSubPath) {
-		const SubPath* subPath = &subPaths[iSubPath];
-		if (subPath->m_NumVertices < 2) {
-			continue;
-		}
-
-		const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
-		const uint32_t numPathVertices = subPath->m_NumVertices;
-		const bool isClosed = subPath->m_IsClosed;
-
-		Mesh mesh;
-		const uint32_t* colors = &col;
-		uint32_t numColors = 1;
-
-		if (aa) {
-			if (isThin) {
-				strokerPolylineStrokeAAThin(stroker, &mesh, vtx, numPathVertices, isClosed, col, lineCap, lineJoin);
-			} else {
-				strokerPolylineStrokeAA(stroker, &mesh, vtx, numPathVertices, isClosed, col, strokeWidth, lineCap, lineJoin);
-			}
-
-			colors = mesh.m_ColorBuffer;
-			numColors = mesh.m_NumVertices;
-		} else {
-			strokerPolylineStroke(stroker, &mesh, vtx, numPathVertices, isClosed, strokeWidth, lineCap, lineJoin);
-		}
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-		if (hasCache) {
-			addCachedCommand(ctx, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-		}
-#endif
-
-		createDrawCommand_ImagePattern(ctx, imgPatternHandle, mesh.m_PosBuffer, mesh.m_NumVertices, colors, numColors, mesh.m_IndexBuffer, mesh.m_NumIndices);
-	}
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	if (hasCache) {
-		endCachedCommand(ctx);
-	}
-#endif
-}
-
-static void ctxBeginClip(Context* ctx, ClipRule::Enum rule)
-{
-	VG_CHECK(!ctx->m_RecordClipCommands, "Already inside beginClip()/endClip() block");
-
-	ClipState* clipState = &ctx->m_ClipState;
-	const uint32_t nextClipCmdID = ctx->m_NumClipCommands;
-
-	clipState->m_Rule = rule;
-	clipState->m_FirstCmdID = nextClipCmdID;
-	clipState->m_NumCmds = 0;
-
-	ctx->m_RecordClipCommands = true;
-	ctx->m_ForceNewClipCommand = true;
-}
-
-static void ctxEndClip(Context* ctx)
-{
-	VG_CHECK(ctx->m_RecordClipCommands, "Must be called once after beginClip()");
-
-	ClipState* clipState = &ctx->m_ClipState;
-	const uint32_t nextClipCmdID = ctx->m_NumClipCommands;
-
-	clipState->m_NumCmds = nextClipCmdID - clipState->m_FirstCmdID;
-
-	ctx->m_RecordClipCommands = false;
-	ctx->m_ForceNewDrawCommand = true;
-}
-
-static void ctxResetClip(Context* ctx)
-{
-	VG_CHECK(!ctx->m_RecordClipCommands, "Must be called outside beginClip()/endClip() pair.");
-
-	ClipState* clipState = &ctx->m_ClipState;
-
-	if (clipState->m_FirstCmdID != ~0u) {
-		clipState->m_FirstCmdID = ~0u;
-		clipState->m_NumCmds = 0;
-
-		ctx->m_ForceNewDrawCommand = true;
-	}
-}
-
-static GradientHandle ctxCreateLinearGradient(Context* ctx, float sx, float sy, float ex, float ey, Color icol, Color ocol)
-{
-	if (ctx->m_NextGradientID >= ctx->m_Config.m_MaxGradients) {
-		return VG_INVALID_HANDLE32;
-	}
-
-	GradientHandle handle = { (uint16_t)ctx->m_NextGradientID++, 0 };
-
-	const float large = 1e5;
-	float dx = ex - sx;
-	float dy = ey - sy;
-	float d = bx::sqrt(dx * dx + dy * dy);
-	if (d > 0.0001f) {
-		dx /= d;
-		dy /= d;
-	} else {
-		dx = 0;
-		dy = 1;
-	}
-
-	float gradientMatrix[6];
-	gradientMatrix[0] = dy;
-	gradientMatrix[1] = -dx;
-	gradientMatrix[2] = dx;
-	gradientMatrix[3] = dy;
-	gradientMatrix[4] = sx - dx * large;
-	gradientMatrix[5] = sy - dy * large;
-
-	const State* state = getState(ctx);
-	const float* stateTransform = state->m_TransformMtx;
-
-	float patternMatrix[6];
-	vgutil::multiplyMatrix3(stateTransform, gradientMatrix, patternMatrix);
+	float patternMatrix[6];
+	vgutil::multiplyMatrix3(stateTransform, gradientMatrix, patternMatrix);
 
 	float inversePatternMatrix[6];
 	vgutil::invertMatrix3(patternMatrix, inversePatternMatrix);
@@ -3174,97 +4446,35 @@ static bool ctxIntersectScissor(Context* ctx, float x, float y, float w, float h
 
 static void ctxTransformIdentity(Context* ctx)
 {
-	State* state = getState(ctx);
-	state->m_TransformMtx[0] = 1.0f;
-	state->m_TransformMtx[1] = 0.0f;
-	state->m_TransformMtx[2] = 0.0f;
-	state->m_TransformMtx[3] = 1.0f;
-	state->m_TransformMtx[4] = 0.0f;
-	state->m_TransformMtx[5] = 0.0f;
-
-	updateState(state);
+	stateTransformIdentity(getState(ctx));
 }
 
 static void ctxTransformScale(Context* ctx, float x, float y)
 {
-	State* state = getState(ctx);
-	state->m_TransformMtx[0] = x * state->m_TransformMtx[0];
-	state->m_TransformMtx[1] = x * state->m_TransformMtx[1];
-	state->m_TransformMtx[2] = y * state->m_TransformMtx[2];
-	state->m_TransformMtx[3] = y * state->m_TransformMtx[3];
-
-	updateState(state);
+	stateTransformScale(getState(ctx), x, y);
 }
 
 static void ctxTransformTranslate(Context* ctx, float x, float y)
 {
-	State* state = getState(ctx);
-	state->m_TransformMtx[4] += state->m_TransformMtx[0] * x + state->m_TransformMtx[2] * y;
-	state->m_TransformMtx[5] += state->m_TransformMtx[1] * x + state->m_TransformMtx[3] * y;
-
-	updateState(state);
+	stateTransformTranslate(getState(ctx), x, y);
 }
 
 static void ctxTransformRotate(Context* ctx, float ang_rad)
 {
-	const float c = bx::cos(ang_rad);
-	const float s = bx::sin(ang_rad);
-
-	State* state = getState(ctx);
-	const float* stateTransform = state->m_TransformMtx;
-
-	float mtx[6];
-	mtx[0] = c * stateTransform[0] + s * stateTransform[2];
-	mtx[1] = c * stateTransform[1] + s * stateTransform[3];
-	mtx[2] = -s * stateTransform[0] + c * stateTransform[2];
-	mtx[3] = -s * stateTransform[1] + c * stateTransform[3];
-	mtx[4] = stateTransform[4];
-	mtx[5] = stateTransform[5];
-	bx::memCopy(state->m_TransformMtx, mtx, sizeof(float) * 6);
-
-	updateState(state);
+	stateTransformRotate(getState(ctx), ang_rad);
 }
 
 static void ctxTransformMult(Context* ctx, const float* mtx, TransformOrder::Enum order)
 {
-	State* state = getState(ctx);
-	const float* stateTransform = state->m_TransformMtx;
-
-	float res[6];
-	if (order == TransformOrder::Post) {
-		vgutil::multiplyMatrix3(stateTransform, mtx, res);
-	} else {
-		VG_CHECK(order == TransformOrder::Pre, "Unknown TransformOrder::Enum");
-		vgutil::multiplyMatrix3(mtx, stateTransform, res);
-	}
-
-	bx::memCopy(state->m_TransformMtx, res, sizeof(float) * 6);
-
-	updateState(state);
+	stateTransformMult(getState(ctx), mtx, order);
 }
 
 static void ctxSetViewBox(Context* ctx, float x, float y, float w, float h)
 {
-	const float scaleX = (float)ctx->m_CanvasWidth / w;
-	const float scaleY = (float)ctx->m_CanvasHeight / h;
-
-	State* state = getState(ctx);
-	float* stateTransform = &state->m_TransformMtx[0];
+	stateSetViewBox(getState(ctx), (float)ctx->m_CanvasWidth, (float)ctx->m_CanvasHeight, x, y, w, h);
+}
 
-	// ctxTransformScale(ctx, scaleX, scaleY);
-	stateTransform[0] = scaleX * stateTransform[0];
-	stateTransform[1] = scaleX * stateTransform[1];
-	stateTransform[2] = scaleY * stateTransform[2];
-	stateTransform[3] = scaleY * stateTransform[3];
-
-	// ctxTransformTranslate(ctx, -x, -y);
-	stateTransform[4] -= stateTransform[0] * x + stateTransform[2] * y;
-	stateTransform[5] -= stateTransform[1] * x + stateTransform[3] * y;
-
-	updateState(state);
-}
-
-static void ctxIndexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices, ImageHandle img)
+static void ctxIndexedTriList(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img)
 {
 	if (!isValid(img)) {
 		img = fsGetFontAtlasImage(ctx->m_FontSystem);
@@ -3273,1051 +4483,3461 @@ static void ctxIndexedTriList(Context* ctx, const float* pos, const uv_t* uv, ui
 	const State* state = getState(ctx);
 	const float* stateTransform = state->m_TransformMtx;
 
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, pos, numVertices, stateTransform);
+#endif
 	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::Textured, img.idx);
 
 	// Vertex buffer
 	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
 	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
 
-	float* dstPos = &vb->m_Pos[vbOffset << 1];
-	vgutil::batchTransformPositions(pos, numVertices, dstPos, stateTransform);
+	const uv_t* vtxUV = uv ? uv : fsGetWhitePixelUV(ctx->m_FontSystem);
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, pos, stateTransform, vtxUV, uv ? numVertices : 1, colors, numColors);
 
-	uv_t* dstUV = &vb->m_UV[vbOffset << 1];
-	if (uv) {
-		bx::memCopy(dstUV, uv, sizeof(uv_t) * 2 * numVertices);
-	} else {
-		const uv_t* whiteRectUV = fsGetWhitePixelUV(ctx->m_FontSystem);
+	// Index buffer
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
 
-#if VG_CONFIG_UV_INT16
-		vgutil::memset32(dstUV, numVertices, &whiteRectUV[0]);
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+
+static void ctxIndexedTriListInstanced(Context* ctx, const float* pos, const uv_t* uv, uint32_t numVertices, const Color* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, ImageHandle img, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Instanced tri-lists cannot be used inside beginClip()/endClip()");
+	if (!isValid(img)) {
+		img = fsGetFontAtlasImage(ctx->m_FontSystem);
+	}
+
+	submitInstancedMesh(ctx, img, pos, uv, numVertices, colors, numColors, indices, numIndices, instanceMtx, instanceColors, numInstances, false);
+}
+
+// The path is tessellated as usual (so AA fringes match the current transform) and the generated
+// meshes are brought back to local space once. The current and instance transforms are then applied
+// by the vertex shader.
+static void ctxFillPathInstanced(Context* ctx, Color color, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Instanced paths cannot be used inside beginClip()/endClip()");
+
+	InstancedMeshSink sink;
+	if (!beginInstancedMeshSink(ctx, &sink, instanceMtx, instanceColors, numInstances)) {
+		return;
+	}
+
+	// If there are per-instance colors, tessellate using white so the vertex colors hold only the AA coverage.
+	tessFillPath(&ctx->m_Tessellator, getState(ctx), DrawCommand::Type::Textured, instanceColors ? Colors::White : color, flags, false, false, instancedMeshCallback, &sink);
+
+	endInstancedMeshSink(ctx, &sink);
+}
+
+static void ctxStrokePathInstanced(Context* ctx, Color color, float width, uint32_t flags, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Instanced paths cannot be used inside beginClip()/endClip()");
+
+	InstancedMeshSink sink;
+	if (!beginInstancedMeshSink(ctx, &sink, instanceMtx, instanceColors, numInstances)) {
+		return;
+	}
+
+	// See ctxFillPathInstanced()
+	tessStrokePath(&ctx->m_Tessellator, getState(ctx), ctx->m_FringeWidth, DrawCommand::Type::Textured, instanceColors ? Colors::White : color, width, flags, false, false, instancedMeshCallback, &sink);
+
+	endInstancedMeshSink(ctx, &sink);
+}
+
+static void ctxText(Context* ctx, const TextConfig& cfg, float x, float y, const char* str, const char* end)
+{
+	const State* state = getState(ctx);
+	const float scale = state->m_FontScale * ctx->m_DevicePixelRatio;
+
+	const uint32_t c = colorSetAlpha(cfg.m_Color, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(cfg.m_Color)));
+	if (colorGetAlpha(c) == 0) {
+		return;
+	}
+
+	const float scaledFontSize = cfg.m_FontSize * scale;
+	const uint32_t len = end
+		? (uint32_t)(end - str)
+		: bx::strLen(str)
+		;
+
+	const TextConfig newCfg = makeTextConfig(ctx, cfg.m_FontHandle, scaledFontSize, cfg.m_Alignment, c, cfg.m_Blur * scale, cfg.m_Spacing * scale);
+
+	TextMesh mesh;
+	bx::memSet(&mesh, 0, sizeof(TextMesh));
+	if (!fsText(ctx->m_FontSystem, ctx, newCfg, str, len, TextFlags::BuildBitmaps, &mesh)) {
+		return;
+	}
+
+	ctxPushState(ctx);
+	ctxTransformTranslate(ctx, x + mesh.m_Alignment[0] / scale, y + mesh.m_Alignment[1] / scale);
+
+	// The glyphs of a string end up in multiple atlas images if the atlas filled up while building the mesh.
+	uint32_t firstQuad = 0;
+	while (firstQuad < mesh.m_Size) {
+		const ImageHandle img = mesh.m_QuadImages[firstQuad];
+
+		uint32_t numQuads = 1;
+		while (firstQuad + numQuads < mesh.m_Size && mesh.m_QuadImages[firstQuad + numQuads].idx == img.idx) {
+			++numQuads;
+		}
+
+		renderTextQuads(ctx, &mesh.m_Quads[firstQuad], numQuads, newCfg.m_Color, img, mesh.m_DistanceField, mesh.m_DistanceFieldBlur);
+		firstQuad += numQuads;
+	}
+	ctxPopState(ctx);
+}
+
+static void ctxTextBox(Context* ctx, const TextConfig& cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textBreakFlags)
+{
+	end = end
+		? end
+		: str + bx::strLen(str)
+		;
+
+	const float lineHeight = fsGetLineHeight(ctx->m_FontSystem, cfg);
+	const TextAlignHor::Enum halign = (TextAlignHor::Enum)((cfg.m_Alignment & VG_TEXT_ALIGN_HOR_Msk) >> VG_TEXT_ALIGN_HOR_Pos);
+	const TextAlignVer::Enum valign = (TextAlignVer::Enum)((cfg.m_Alignment & VG_TEXT_ALIGN_VER_Msk) >> VG_TEXT_ALIGN_VER_Pos);
+
+	const TextConfig newCfg = makeTextConfig(ctx, cfg.m_FontHandle, cfg.m_FontSize, VG_TEXT_ALIGN(vg::TextAlignHor::Left, valign), cfg.m_Color, cfg.m_Blur, cfg.m_Spacing);
+
+	TextRow rows[4];
+	uint32_t numRows = 0;
+	while ((numRows = fsTextBreakLines(ctx->m_FontSystem, cfg, str, end, breakWidth, &rows[0], BX_COUNTOF(rows), textBreakFlags)) != 0) {
+		for (uint32_t i = 0; i < numRows; ++i) {
+			if (halign == TextAlignHor::Left) {
+				ctxText(ctx, newCfg, x, y, rows[i].start, rows[i].end);
+			} else if (halign == TextAlignHor::Center) {
+				ctxText(ctx, newCfg, x + (breakWidth - rows[i].width) * 0.5f, y, rows[i].start, rows[i].end);
+			} else if (halign == TextAlignHor::Right) {
+				ctxText(ctx, newCfg, x + breakWidth - rows[i].width, y, rows[i].start, rows[i].end);
+			}
+
+			y += lineHeight;
+		}
+
+		str = rows[numRows - 1].next;
+	}
+}
+
+static void ctxSubmitCommandList(Context* ctx, CommandListHandle handle)
+{
+	VG_CHECK(isCommandListHandleValid(ctx, handle), "Invalid command list handle");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+
+	if (ctx->m_SubmitCmdListRecursionDepth >= ctx->m_Config.m_MaxCommandListDepth) {
+		VG_CHECK(false, "SubmitCommandList recursion depth limit reached.");
+		return;
+	}
+
+	// Lists drawn into layers don't affect the view passed to begin().
+	if (ctx->m_DirtyRectTracking && ctx->m_ActiveLayerID == kMainLayerID) {
+		clUpdateDirtyRect(ctx, cl);
+	}
+
+	// Skip lists (and their children) which are completely outside the scissor rect. Not while
+	// recording clip paths, consuming prepared meshes (they are matched by index) or caching
+	// (cached meshes are reused with other transforms).
+	const bool canCull = true
+		&& !ctx->m_RecordClipCommands
+		&& !ctx->m_ActivePreparedCmdList
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+		&& !getCommandListCacheStackTop(ctx)
+#endif
+		;
+	if (canCull && !clIsVisible(ctx, cl)) {
+#if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+		ctxResetClip(ctx);
+#endif
+		return;
+	}
+
+	++ctx->m_SubmitCmdListRecursionDepth;
+
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	bool isCached = false;
+	CommandListCache* clCache = clGetCache(ctx, cl, getState(ctx)->m_AvgScale, &isCached);
+	if (isCached) {
+		clCacheRender(ctx, cl, clCache);
+		--ctx->m_SubmitCmdListRecursionDepth;
+		return;
+	}
 #else
-		vgutil::memset64(dstUV, numVertices, &whiteRectUV[0]);
+	CommandListCache* clCache = nullptr;
 #endif
+
+	// Don't cull commands during caching.
+	const uint32_t clFlags = cl->m_Flags;
+	const bool cullCmds = !clCache && ((clFlags & CommandListFlags::AllowCommandCulling) != 0);
+
+	const uint16_t firstGradientID = (uint16_t)ctx->m_NextGradientID;
+	const uint16_t firstImagePatternID = (uint16_t)ctx->m_NextImagePatternID;
+	VG_CHECK(firstGradientID + cl->m_NumGradients <= ctx->m_Config.m_MaxGradients, "Not enough free gradients for command list. Increase ContextConfig::m_MaxGradients");
+	VG_CHECK(firstImagePatternID + cl->m_NumImagePatterns <= ctx->m_Config.m_MaxImagePatterns, "Not enough free image patterns for command list. Increase ContextConfig::m_MaxImagePatterns");
+
+	const uint8_t* cmd = cl->m_CommandBuffer;
+	const uint8_t* cmdListEnd = cl->m_CommandBuffer + cl->m_CommandBufferPos;
+	if (cmd == cmdListEnd) {
+		--ctx->m_SubmitCmdListRecursionDepth;
+		return;
 	}
 
-	uint32_t* dstColor = &vb->m_Color[vbOffset];
-	if (numColors == numVertices) {
-		bx::memCopy(dstColor, colors, sizeof(uint32_t) * numVertices);
-	} else {
-		VG_CHECK(numColors == 1, "Invalid size of color array passed.");
-		vgutil::memset32(dstColor, numVertices, colors);
+	const char* stringBuffer = cl->m_StringBuffer;
+
+	// Use the meshes generated by prepareCommandList() instead of tessellating the paths again.
+	// Child command lists use the meshes prepared for their top-level parent.
+	PreparedCommandList* activatedPrepared = nullptr;
+	if (ctx->m_SubmitCmdListRecursionDepth == 1 && clCanUsePrepared(ctx, cl)) {
+		activatedPrepared = cl->m_Prepared;
+		ctx->m_ActivePreparedCmdList = activatedPrepared;
+		ctx->m_NextPreparedCmdID = 0;
 	}
+	const uint8_t* pathFirstCmd = cmd;
 
-	// Index buffer
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	uint16_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
-	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (uint16_t)cmd->m_NumVertices);
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	pushCommandListCache(ctx, clCache);
+#endif
+
+	bool skipCmds = false;
+#if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	ctxPushState(ctx);
+#endif
+
+	while (cmd < cmdListEnd) {
+		const CommandHeader* cmdHeader = (CommandHeader*)cmd;
+		cmd += kAlignedCommandHeaderSize;
+
+		const uint8_t* nextCmd = cmd + cmdHeader->m_Size;
+
+		const bool isStrokerCmd = cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand;
+		// NOTE: Re-read on every command because a child list might have stopped using it.
+		const PreparedCommandList* prepared = ctx->m_ActivePreparedCmdList;
+		const PreparedCommand* preparedCmd = nullptr;
+		if (prepared) {
+			// Skip path commands. Remember where the current path starts in case the prepared
+			// meshes run out (see below).
+			if (cmdHeader->m_Type <= CommandType::LastPathCommand) {
+				if (cmdHeader->m_Type == CommandType::BeginPath) {
+					pathFirstCmd = (const uint8_t*)cmdHeader;
+				}
+
+				cmd = nextCmd;
+				continue;
+			}
+
+			if (isStrokerCmd) {
+				if (ctx->m_NextPreparedCmdID < prepared->m_NumCommands) {
+					preparedCmd = &prepared->m_Commands[ctx->m_NextPreparedCmdID++];
+				} else {
+					// The submitted commands don't match the prepared ones. Tessellate everything
+					// from here on, starting with the skipped path of this command.
+					VG_WARN(false, "Prepared command list doesn't match the submitted commands");
+					ctx->m_ActivePreparedCmdList = nullptr;
+					prepared = nullptr;
+
+					ctxBeginPath(ctx);
+					for (const uint8_t* pathCmd = pathFirstCmd; pathCmd < (const uint8_t*)cmdHeader; ) {
+						const CommandHeader* pathCmdHeader = (const CommandHeader*)pathCmd;
+						pathCmd += kAlignedCommandHeaderSize;
+
+						if (pathCmdHeader->m_Type <= CommandType::LastPathCommand) {
+							ctxExecPathCommand(ctx, pathCmdHeader->m_Type, pathCmd);
+						}
+
+						pathCmd += pathCmdHeader->m_Size;
+					}
+				}
+			}
+		}
+
+		// Nothing drawn inside a layer with valid cached content is rendered. Don't tessellate
+		// anything in this case, unless the list is being cached.
+		const bool discardCmd = !clCache && ctx->m_ActiveLayerID == kDiscardLayerID;
+		if (discardCmd && (cmdHeader->m_Type == CommandType::IndexedTriList || cmdHeader->m_Type == CommandType::Text || cmdHeader->m_Type == CommandType::TextBox)) {
+			cmd = nextCmd;
+			continue;
+		}
+
+		if (isStrokerCmd && (skipCmds || discardCmd || (cmdHeader->m_Flags & CommandFlags::Hidden) != 0)) {
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+			// Keep the cached commands in sync with the stroker commands of the list.
+			if (clCache) {
+				beginCachedCommand(ctx);
+				endCachedCommand(ctx);
+			}
+#endif
+			cmd = nextCmd;
+			continue;
+		}
+
+		if (cmdHeader->m_Type <= CommandType::LastPathCommand) {
+			ctxExecPathCommand(ctx, cmdHeader->m_Type, cmd);
+			cmd = nextCmd;
+			continue;
+		}
+
+		switch (cmdHeader->m_Type) {
+		case CommandType::FillPathColor: {
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+
+			if (preparedCmd) {
+				submitPreparedCommand(ctx, prepared, preparedCmd, ctx->m_RecordClipCommands ? DrawCommand::Type::Clip : DrawCommand::Type::Textured, UINT16_MAX);
+			} else {
+				ctxFillPathColor(ctx, color, flags);
+			}
+		} break;
+		case CommandType::FillPathGradient: {
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const uint16_t gradientHandle = CMD_READ(cmd, uint16_t);
+			const uint16_t gradientFlags = CMD_READ(cmd, uint16_t);
+
+			const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
+			if (preparedCmd) {
+				submitPreparedCommand(ctx, prepared, preparedCmd, DrawCommand::Type::ColorGradient, gradient.idx);
+			} else {
+				ctxFillPathGradient(ctx, gradient, flags);
+			}
+		} break;
+		case CommandType::FillPathImagePattern: {
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+			const uint16_t imgPatternHandle = CMD_READ(cmd, uint16_t);
+			const uint16_t imgPatternFlags = CMD_READ(cmd, uint16_t);
+
+			const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
+			if (preparedCmd) {
+				submitPreparedCommand(ctx, prepared, preparedCmd, DrawCommand::Type::ImagePattern, imgPattern.idx);
+			} else {
+				ctxFillPathImagePattern(ctx, imgPattern, color, flags);
+			}
+		} break;
+		case CommandType::StrokePathColor: {
+			const float width = CMD_READ(cmd, float);
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+
+			if (preparedCmd) {
+				submitPreparedCommand(ctx, prepared, preparedCmd, ctx->m_RecordClipCommands ? DrawCommand::Type::Clip : DrawCommand::Type::Textured, UINT16_MAX);
+			} else {
+				ctxStrokePathColor(ctx, color, width, flags);
+			}
+		} break;
+		case CommandType::StrokePathGradient: {
+			const float width = CMD_READ(cmd, float);
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const uint16_t gradientHandle = CMD_READ(cmd, uint16_t);
+			const uint16_t gradientFlags = CMD_READ(cmd, uint16_t);
+
+			const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
+			if (preparedCmd) {
+				submitPreparedCommand(ctx, prepared, preparedCmd, DrawCommand::Type::ColorGradient, gradient.idx);
+			} else {
+				ctxStrokePathGradient(ctx, gradient, width, flags);
+			}
+		} break;
+		case CommandType::StrokePathImagePattern: {
+			const float width = CMD_READ(cmd, float);
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+			const uint16_t imgPatternHandle = CMD_READ(cmd, uint16_t);
+			const uint16_t imgPatternFlags = CMD_READ(cmd, uint16_t);
+
+			const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
+			if (preparedCmd) {
+				submitPreparedCommand(ctx, prepared, preparedCmd, DrawCommand::Type::ImagePattern, imgPattern.idx);
+			} else {
+				ctxStrokePathImagePattern(ctx, imgPattern, color, width, flags);
+			}
+		} break;
+		case CommandType::IndexedTriList: {
+			const uint32_t numVertices = CMD_READ(cmd, uint32_t);
+			const float* positions = (float*)cmd;
+			cmd += sizeof(float) * 2 * numVertices;
+			const uint32_t numUVs = CMD_READ(cmd, uint32_t);
+			const uv_t* uv = (uv_t*)cmd;
+			cmd += sizeof(uv_t) * 2 * numUVs;
+			const uint32_t numColors = CMD_READ(cmd, uint32_t);
+			const Color* colors = (Color*)cmd;
+			cmd += sizeof(Color) * numColors;
+			const uint32_t numIndices = CMD_READ(cmd, uint32_t);
+			const index_t* indices = (index_t*)cmd;
+			cmd += sizeof(index_t) * numIndices;
+			const uint16_t imgHandle = CMD_READ(cmd, uint16_t);
+
+			ctxIndexedTriList(ctx, positions, numUVs ? uv : nullptr, numVertices, colors, numColors, indices, numIndices, { imgHandle });
+		} break;
+		case CommandType::CreateLinearGradient: {
+			const float* params = (float*)cmd;
+			cmd += sizeof(float) * 4;
+			const Color* colors = (Color*)cmd;
+			cmd += sizeof(Color) * 2;
+			ctxCreateLinearGradient(ctx, params[0], params[1], params[2], params[3], colors[0], colors[1]);
+		} break;
+		case CommandType::CreateBoxGradient: {
+			const float* params = (float*)cmd;
+			cmd += sizeof(float) * 6;
+			const Color* colors = (Color*)cmd;
+			cmd += sizeof(Color) * 2;
+			ctxCreateBoxGradient(ctx, params[0], params[1], params[2], params[3], params[4], params[5], colors[0], colors[1]);
+		} break;
+		case CommandType::CreateRadialGradient: {
+			const float* params = (float*)cmd;
+			cmd += sizeof(float) * 4;
+			const Color* colors = (Color*)cmd;
+			cmd += sizeof(Color) * 2;
+			ctxCreateRadialGradient(ctx, params[0], params[1], params[2], params[3], colors[0], colors[1]);
+		} break;
+		case CommandType::CreateImagePattern: {
+			const float* params = (float*)cmd;
+			cmd += sizeof(float) * 5;
+			const ImageHandle img = CMD_READ(cmd, ImageHandle);
+			ctxCreateImagePattern(ctx, params[0], params[1], params[2], params[3], params[4], img);
+		} break;
+		case CommandType::Text: {
+			const TextConfig* txtCfg = (TextConfig*)cmd;
+			cmd += sizeof(TextConfig);
+			const float* coords = (float*)cmd;
+			cmd += sizeof(float) * 2;
+			const uint32_t stringOffset = CMD_READ(cmd, uint32_t);
+			const uint32_t stringLen = CMD_READ(cmd, uint32_t);
+			VG_CHECK(stringOffset < cl->m_StringBufferPos, "Invalid string offset");
+			VG_CHECK(stringOffset + stringLen <= cl->m_StringBufferPos, "Invalid string length");
+
+			const char* str = stringBuffer + stringOffset;
+			const char* end = str + stringLen;
+			ctxText(ctx, *txtCfg, coords[0], coords[1], str, end);
+		} break;
+		case CommandType::TextBox: {
+			const TextConfig* txtCfg = (TextConfig*)cmd;
+			cmd += sizeof(TextConfig);
+			const float* coords = (float*)cmd;
+			cmd += sizeof(float) * 3; // x, y, breakWidth
+			const uint32_t stringOffset = CMD_READ(cmd, uint32_t);
+			const uint32_t stringLen = CMD_READ(cmd, uint32_t);
+			const uint32_t textboxFlags = CMD_READ(cmd, uint32_t);
+			VG_CHECK(stringOffset < cl->m_StringBufferPos, "Invalid string offset");
+			VG_CHECK(stringOffset + stringLen <= cl->m_StringBufferPos, "Invalid string length");
+
+			const char* str = stringBuffer + stringOffset;
+			const char* end = str + stringLen;
+			ctxTextBox(ctx, *txtCfg, coords[0], coords[1], coords[2], str, end, textboxFlags);
+		} break;
+		case CommandType::ResetScissor: {
+			ctxResetScissor(ctx);
+			skipCmds = false;
+		} break;
+		case CommandType::SetScissor: {
+			const float* rect = (float*)cmd;
+			cmd += sizeof(float) * 4;
+			ctxSetScissor(ctx, rect[0], rect[1], rect[2], rect[3]);
+
+			if (cullCmds) {
+				const State* state = getState(ctx);
+				const float* scissorRect = &state->m_ScissorRect[0];
+				skipCmds = (scissorRect[2] < 1.0f) || (scissorRect[3] < 1.0f);
+			}
+		} break;
+		case CommandType::IntersectScissor: {
+			const float* rect = (float*)cmd;
+			cmd += sizeof(float) * 4;
+
+			const bool zeroRect = !ctxIntersectScissor(ctx, rect[0], rect[1], rect[2], rect[3]);
+			if (cullCmds) {
+				skipCmds = zeroRect;
+			}
+		} break;
+		case CommandType::PushState: {
+			ctxPushState(ctx);
+		} break;
+		case CommandType::PopState: {
+			ctxPopState(ctx);
+			if (cullCmds) {
+				const State* state = getState(ctx);
+				const float* scissorRect = &state->m_ScissorRect[0];
+				skipCmds = (scissorRect[2] < 1.0f) || (scissorRect[3] < 1.0f);
+			}
+		} break;
+		case CommandType::TransformIdentity: {
+			ctxTransformIdentity(ctx);
+		} break;
+		case CommandType::TransformRotate: {
+			const float ang_rad = CMD_READ(cmd, float);
+			ctxTransformRotate(ctx, ang_rad);
+		} break;
+		case CommandType::TransformTranslate: {
+			const float* coords = (float*)cmd;
+			cmd += sizeof(float) * 2;
+			ctxTransformTranslate(ctx, coords[0], coords[1]);
+		} break;
+		case CommandType::TransformScale: {
+			const float* coords = (float*)cmd;
+			cmd += sizeof(float) * 2;
+			ctxTransformScale(ctx, coords[0], coords[1]);
+		} break;
+		case CommandType::TransformMult: {
+			const float* mtx = (float*)cmd;
+			cmd += sizeof(float) * 6;
+			const TransformOrder::Enum order = CMD_READ(cmd, TransformOrder::Enum);
+			ctxTransformMult(ctx, mtx, order);
+		} break;
+		case CommandType::SetViewBox: {
+			const float* viewBox = (float*)cmd;
+			cmd += sizeof(float) * 4;
+			ctxSetViewBox(ctx, viewBox[0], viewBox[1], viewBox[2], viewBox[3]);
+		} break;
+		case CommandType::BeginClip: {
+			const ClipRule::Enum rule = CMD_READ(cmd, ClipRule::Enum);
+			ctxBeginClip(ctx, rule);
+		} break;
+		case CommandType::EndClip: {
+			ctxEndClip(ctx);
+		} break;
+		case CommandType::ResetClip: {
+			ctxResetClip(ctx);
+		} break;
+		case CommandType::SubmitCommandList: {
+			const uint16_t cmdListID = CMD_READ(cmd, uint16_t);
+			const CommandListHandle cmdListHandle = { cmdListID };
+
+			if (isCommandListHandleValid(ctx, cmdListHandle)) {
+				ctxSubmitCommandList(ctx, cmdListHandle);
+			}
+		} break;
+		case CommandType::BeginLayer: {
+			const uint16_t layerID = CMD_READ(cmd, uint16_t);
+			const uint16_t viewID = CMD_READ(cmd, uint16_t);
+			ctxBeginLayer(ctx, { layerID }, viewID);
+		} break;
+		case CommandType::EndLayer: {
+			ctxEndLayer(ctx);
+		} break;
+		default: {
+			VG_CHECK(false, "Unknown command");
+		} break;
+		}
+
+		cmd = nextCmd;
+	}
+
+#if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	ctxPopState(ctx);
+	ctxResetClip(ctx);
+#endif
+
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	popCommandListCache(ctx);
+#endif
+
+	if (activatedPrepared) {
+		VG_WARN(ctx->m_ActivePreparedCmdList == nullptr || ctx->m_NextPreparedCmdID == activatedPrepared->m_NumCommands, "Prepared command list doesn't match the submitted commands");
+		activatedPrepared->m_IsValid = false;
+		ctx->m_ActivePreparedCmdList = nullptr;
+	}
+
+	--ctx->m_SubmitCmdListRecursionDepth;
+}
+
+static bool ctxBeginLayer(Context* ctx, LayerHandle handle, uint16_t viewID)
+{
+	VG_CHECK(isLayerHandleValid(ctx, handle), "Invalid layer handle");
+	VG_CHECK(ctx->m_LayerStackTop < VG_CONFIG_LAYER_STACK_SIZE, "Layer stack overflow");
+	VG_CHECK(!ctx->m_RecordClipCommands, "Must be called outside beginClip()/endClip() pair.");
+
+	Layer* layer = &ctx->m_Layers[handle.idx];
+
+	// Layers nested inside a discarded layer are discarded as well.
+	const bool render = !layer->m_IsValid && ctx->m_ActiveLayerID != kDiscardLayerID;
+
+	LayerStackEntry* entry = &ctx->m_LayerStack[ctx->m_LayerStackTop++];
+	bx::memCopy(&entry->m_ClipState, &ctx->m_ClipState, sizeof(ClipState));
+	entry->m_LayerID = render ? handle.idx : kDiscardLayerID;
+	entry->m_PrevLayerID = ctx->m_ActiveLayerID;
+	entry->m_CanvasWidth = ctx->m_CanvasWidth;
+	entry->m_CanvasHeight = ctx->m_CanvasHeight;
+
+	// Start from a clean state in the layer's coordinate system.
+	const float devicePixelRatio = ctx->m_DevicePixelRatio;
+	const float canvasWidth = (float)layer->m_Width / devicePixelRatio;
+	const float canvasHeight = (float)layer->m_Height / devicePixelRatio;
+	ctx->m_ActiveLayerID = entry->m_LayerID;
+	ctx->m_CanvasWidth = (uint16_t)canvasWidth;
+	ctx->m_CanvasHeight = (uint16_t)canvasHeight;
+
+	ctxPushState(ctx);
+	getState(ctx)->m_GlobalAlpha = 1.0f;
+	ctxTransformIdentity(ctx);
+	ctxResetScissor(ctx);
+	ctx->m_ClipState.m_FirstCmdID = ~0u;
+	ctx->m_ClipState.m_NumCmds = 0;
+	ctx->m_ClipState.m_Rule = ClipRule::In;
+	ctx->m_ForceNewDrawCommand = true;
+	ctx->m_ForceNewClipCommand = true;
+
+	if (!render) {
+		return false;
+	}
+
+	layer->m_ViewID = viewID;
+
+	float viewMtx[16];
+	float projMtx[16];
+	bx::mtxIdentity(viewMtx);
+	bx::mtxOrtho(projMtx, 0.0f, canvasWidth, canvasHeight, 0.0f, 0.0f, 1.0f, 0.0f, bgfx::getCaps()->homogeneousDepth);
+
+	bgfx::setViewFrameBuffer(viewID, layer->m_FrameBufferHandle);
+	bgfx::setViewRect(viewID, 0, 0, layer->m_Width, layer->m_Height);
+	bgfx::setViewClear(viewID, BGFX_CLEAR_COLOR | BGFX_CLEAR_STENCIL, 0x00000000, 1.0f, 0);
+	bgfx::setViewMode(viewID, bgfx::ViewMode::Sequential);
+	bgfx::setViewTransform(viewID, viewMtx, projMtx);
+	bgfx::touch(viewID);
+
+	ctx->m_HasLayerCommands = true;
+
+	return true;
+}
+
+static void ctxEndLayer(Context* ctx)
+{
+	VG_CHECK(ctx->m_LayerStackTop > 0, "Layer stack underflow");
+	VG_CHECK(!ctx->m_RecordClipCommands, "Must be called outside beginClip()/endClip() pair.");
+
+	const LayerStackEntry* entry = &ctx->m_LayerStack[--ctx->m_LayerStackTop];
+
+	// The commands will be rendered by end() so the layer is considered valid from now on.
+	if (entry->m_LayerID != kDiscardLayerID) {
+		ctx->m_Layers[entry->m_LayerID].m_IsValid = true;
+	}
+
+	ctxPopState(ctx);
+	ctx->m_ActiveLayerID = entry->m_PrevLayerID;
+	ctx->m_CanvasWidth = entry->m_CanvasWidth;
+	ctx->m_CanvasHeight = entry->m_CanvasHeight;
+	bx::memCopy(&ctx->m_ClipState, &entry->m_ClipState, sizeof(ClipState));
+	ctx->m_ForceNewDrawCommand = true;
+	ctx->m_ForceNewClipCommand = true;
+}
+
+// Internal
+static State* getState(Context* ctx)
+{
+	const uint32_t top = ctx->m_StateStackTop;
+	return &ctx->m_StateStack[top];
+}
+
+static void updateState(State* state)
+{
+	const float* stateTransform = state->m_TransformMtx;
+
+	const float sx = bx::sqrt(stateTransform[0] * stateTransform[0] + stateTransform[2] * stateTransform[2]);
+	const float sy = bx::sqrt(stateTransform[1] * stateTransform[1] + stateTransform[3] * stateTransform[3]);
+	const float avgScale = (sx + sy) * 0.5f;
+
+	state->m_AvgScale = avgScale;
+
+	const float quantFactor = 0.1f;
+	const float quantScale = (bx::floor((avgScale / quantFactor) + 0.5f)) * quantFactor;
+	state->m_FontScale = quantScale;
+}
+
+static void stateTransformIdentity(State* state)
+{
+	state->m_TransformMtx[0] = 1.0f;
+	state->m_TransformMtx[1] = 0.0f;
+	state->m_TransformMtx[2] = 0.0f;
+	state->m_TransformMtx[3] = 1.0f;
+	state->m_TransformMtx[4] = 0.0f;
+	state->m_TransformMtx[5] = 0.0f;
+
+	updateState(state);
+}
+
+static void stateTransformScale(State* state, float x, float y)
+{
+	state->m_TransformMtx[0] = x * state->m_TransformMtx[0];
+	state->m_TransformMtx[1] = x * state->m_TransformMtx[1];
+	state->m_TransformMtx[2] = y * state->m_TransformMtx[2];
+	state->m_TransformMtx[3] = y * state->m_TransformMtx[3];
+
+	updateState(state);
+}
+
+static void stateTransformTranslate(State* state, float x, float y)
+{
+	state->m_TransformMtx[4] += state->m_TransformMtx[0] * x + state->m_TransformMtx[2] * y;
+	state->m_TransformMtx[5] += state->m_TransformMtx[1] * x + state->m_TransformMtx[3] * y;
+
+	updateState(state);
+}
+
+static void stateTransformRotate(State* state, float ang_rad)
+{
+	const float c = bx::cos(ang_rad);
+	const float s = bx::sin(ang_rad);
+
+	const float* stateTransform = state->m_TransformMtx;
+
+	float mtx[6];
+	mtx[0] = c * stateTransform[0] + s * stateTransform[2];
+	mtx[1] = c * stateTransform[1] + s * stateTransform[3];
+	mtx[2] = -s * stateTransform[0] + c * stateTransform[2];
+	mtx[3] = -s * stateTransform[1] + c * stateTransform[3];
+	mtx[4] = stateTransform[4];
+	mtx[5] = stateTransform[5];
+	bx::memCopy(state->m_TransformMtx, mtx, sizeof(float) * 6);
+
+	updateState(state);
+}
+
+static void stateTransformMult(State* state, const float* mtx, TransformOrder::Enum order)
+{
+	const float* stateTransform = state->m_TransformMtx;
+
+	float res[6];
+	if (order == TransformOrder::Post) {
+		vgutil::multiplyMatrix3(stateTransform, mtx, res);
+	} else {
+		VG_CHECK(order == TransformOrder::Pre, "Unknown TransformOrder::Enum");
+		vgutil::multiplyMatrix3(mtx, stateTransform, res);
+	}
+
+	bx::memCopy(state->m_TransformMtx, res, sizeof(float) * 6);
+
+	updateState(state);
+}
+
+static void stateSetViewBox(State* state, float canvasWidth, float canvasHeight, float x, float y, float w, float h)
+{
+	const float scaleX = canvasWidth / w;
+	const float scaleY = canvasHeight / h;
+
+	float* stateTransform = &state->m_TransformMtx[0];
+
+	// stateTransformScale(state, scaleX, scaleY);
+	stateTransform[0] = scaleX * stateTransform[0];
+	stateTransform[1] = scaleX * stateTransform[1];
+	stateTransform[2] = scaleY * stateTransform[2];
+	stateTransform[3] = scaleY * stateTransform[3];
+
+	// stateTransformTranslate(state, -x, -y);
+	stateTransform[4] -= stateTransform[0] * x + stateTransform[2] * y;
+	stateTransform[5] -= stateTransform[1] * x + stateTransform[3] * y;
+
+	updateState(state);
+}
+
+static void tessInit(Tessellator* tess, bx::AllocatorI* allocator)
+{
+	bx::memSet(tess, 0, sizeof(Tessellator));
+	tess->m_Allocator = allocator;
+	tess->m_Path = createPath(allocator);
+	tess->m_Stroker = createStroker(allocator);
+}
+
+static void tessShutdown(Tessellator* tess)
+{
+	if (tess->m_Path) {
+		destroyPath(tess->m_Path);
+		tess->m_Path = nullptr;
+	}
+
+	if (tess->m_Stroker) {
+		destroyStroker(tess->m_Stroker);
+		tess->m_Stroker = nullptr;
+	}
+
+	bx::alignedFree(tess->m_Allocator, tess->m_TransformedVertices, 16);
+	tess->m_TransformedVertices = nullptr;
+	tess->m_TransformedVertexCapacity = 0;
+
+	bx::alignedFree(tess->m_Allocator, tess->m_Colors, 16);
+	tess->m_Colors = nullptr;
+	tess->m_ColorCapacity = 0;
+}
+
+static void tessBeginPath(Tessellator* tess, float avgScale, float tesselationTolerance, float fringeWidth)
+{
+	pathReset(tess->m_Path, avgScale, tesselationTolerance);
+	strokerReset(tess->m_Stroker, avgScale, tesselationTolerance, fringeWidth);
+	tess->m_PathTransformed = false;
+}
+
+static float* tessAllocTransformedVertices(Tessellator* tess, uint32_t numVertices)
+{
+	if (numVertices > tess->m_TransformedVertexCapacity) {
+		bx::AllocatorI* allocator = tess->m_Allocator;
+		tess->m_TransformedVertices = (float*)bx::alignedRealloc(allocator, tess->m_TransformedVertices, sizeof(float) * 2 * numVertices, 16);
+		tess->m_TransformedVertexCapacity = numVertices;
+	}
+
+	return tess->m_TransformedVertices;
+}
+
+static uint32_t* tessAllocColors(Tessellator* tess, uint32_t numColors)
+{
+	if (numColors > tess->m_ColorCapacity) {
+		bx::AllocatorI* allocator = tess->m_Allocator;
+		tess->m_Colors = (uint32_t*)bx::alignedRealloc(allocator, tess->m_Colors, sizeof(uint32_t) * numColors, 16);
+		tess->m_ColorCapacity = numColors;
+	}
+
+	return tess->m_Colors;
+}
+
+static const float* tessTransformPath(Tessellator* tess, const float* mtx)
+{
+	if (tess->m_PathTransformed) {
+		return tess->m_TransformedVertices;
+	}
+
+	Path* path = tess->m_Path;
+
+	const uint32_t numPathVertices = pathGetNumVertices(path);
+	float* transformedVertices = tessAllocTransformedVertices(tess, numPathVertices);
+
+	const float* pathVertices = pathGetVertices(path);
+	vgutil::batchTransformPositions(pathVertices, numPathVertices, transformedVertices, mtx);
+	tess->m_PathTransformed = true;
+
+	return transformedVertices;
+}
+
+// Returns false if the transformed path's bounding rect, expanded by margin, doesn't
+// intersect rect (x, y, w, h). Paths outside the rect can be dropped before tessellation.
+static bool tessIsPathVisible(Tessellator* tess, const float* mtx, const float* rect, float margin)
+{
+	const uint32_t numPathVertices = pathGetNumVertices(tess->m_Path);
+	if (numPathVertices == 0) {
+		return false;
+	}
+
+	const float* pathVertices = tessTransformPath(tess, mtx);
+
+	float bounds[4];
+	vgutil::calcBoundingRect(pathVertices, numPathVertices, &bounds[0]);
+
+	return true
+		&& bounds[0] - margin < rect[0] + rect[2]
+		&& bounds[1] - margin < rect[1] + rect[3]
+		&& bounds[2] + margin > rect[0]
+		&& bounds[3] + margin > rect[1]
+		;
+}
+
+// Conservative distance the stroke geometry can extend past the path vertices. Should
+// match the stroke width calculations in tessStrokePath().
+static float tessCalcStrokeMargin(const State* state, float fringeWidth, float width, uint32_t flags)
+{
+	const float scaledStrokeWidth = ((flags & StrokeFlags::FixedWidth) != 0) ? width : bx::clamp<float>(width * state->m_AvgScale, 0.0f, 200.0f);
+	const float halfWidth = bx::max<float>(scaledStrokeWidth, fringeWidth) * 0.5f + fringeWidth;
+
+	// NOTE: Miter joins aren't limited by the stroker; the extrusion vector is clamped to
+	// 100 times the half width for nearly parallel segments. Square caps extend by sqrt(2).
+	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
+	return lineJoin == LineJoin::Miter ? halfWidth * 200.0f : halfWidth * 1.5f;
+}
+
+// NOTE: paintType is one of Textured (solid color), ColorGradient or ImagePattern. Gradients
+// are always tessellated using black vertex colors. Both tessFillPath() and tessStrokePath() are
+// used for immediate mode rendering and for prepareCommandList() so the generated meshes are
+// identical in both cases.
+static void tessFillPath(Tessellator* tess, const State* state, DrawCommand::Type::Enum paintType, Color color, uint32_t flags, bool recordClipCommands, bool hasCache, TessMeshCallback callback, void* userData)
+{
+	VG_CHECK(paintType != DrawCommand::Type::Clip, "Invalid paint type");
+
+	const bool isSolidColor = paintType == DrawCommand::Type::Textured;
+	const bool isGradient = paintType == DrawCommand::Type::ColorGradient;
+
+	Color col = Colors::Black;
+	if (!isGradient) {
+		const float globalAlpha = hasCache ? 1.0f : state->m_GlobalAlpha;
+		col = (isSolidColor && recordClipCommands) ? Colors::Black : colorSetAlpha(color, (uint8_t)(globalAlpha * colorGetAlpha(color)));
+		if (!hasCache && colorGetAlpha(col) == 0) {
+			return;
+		}
+	}
+
+	const float* pathVertices = tessTransformPath(tess, state->m_TransformMtx);
+
+#if VG_CONFIG_FORCE_AA_OFF
+	const bool aa = false;
+#else
+	const bool aa = (isSolidColor && recordClipCommands)
+		? false
+		: (bool)((flags & VG_FILL_FLAGS_AA_Msk) >> VG_FILL_FLAGS_AA_Pos)
+		;
+#endif
+	const PathType::Enum pathType = (PathType::Enum)((flags & VG_FILL_FLAGS_PATH_TYPE_Msk) >> VG_FILL_FLAGS_PATH_TYPE_Pos);
+	const FillRule::Enum fillRule = (FillRule::Enum)((flags & VG_FILL_FLAGS_FILL_RULE_Msk) >> VG_FILL_FLAGS_FILL_RULE_Pos);
+
+	const Path* path = tess->m_Path;
+	const uint32_t numSubPaths = pathGetNumSubPaths(path);
+	const SubPath* subPaths = pathGetSubPaths(path);
+	Stroker* stroker = tess->m_Stroker;
+
+	if (pathType == PathType::Convex) {
+		for (uint32_t i = 0; i < numSubPaths; ++i) {
+			const SubPath* subPath = &subPaths[i];
+			if (subPath->m_NumVertices < 3) {
+				continue;
+			}
+
+			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
+			const uint32_t numPathVertices = subPath->m_NumVertices;
+
+			Mesh mesh;
+			const uint32_t* colors = &col;
+			uint32_t numColors = 1;
+
+			if (aa) {
+				strokerConvexFillAA(stroker, &mesh, vtx, numPathVertices, col);
+				colors = mesh.m_ColorBuffer;
+				numColors = mesh.m_NumVertices;
+			} else {
+				strokerConvexFill(stroker, &mesh, vtx, numPathVertices);
+			}
+
+			callback(userData, &mesh, colors, numColors);
+		}
+	} else if (pathType == PathType::Concave) {
+		strokerConcaveFillBegin(stroker);
+		for (uint32_t i = 0; i < numSubPaths; ++i) {
+			const SubPath* subPath = &subPaths[i];
+			if (subPath->m_NumVertices < 3) {
+				return;
+			}
+
+			const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
+			const uint32_t numPathVertices = subPath->m_NumVertices;
+			strokerConcaveFillAddContour(stroker, vtx, numPathVertices);
+		}
+
+		Mesh mesh;
+		const uint32_t* colors = &col;
+		uint32_t numColors = 1;
+
+		bool decomposed = false;
+		if (aa) {
+			decomposed = strokerConcaveFillEndAA(stroker, &mesh, col, fillRule);
+			colors = mesh.m_ColorBuffer;
+			numColors = mesh.m_NumVertices;
+		} else {
+			decomposed = strokerConcaveFillEnd(stroker, &mesh, fillRule);
+		}
+
+		VG_WARN(decomposed, "Failed to triangulate concave polygon");
+		if (decomposed) {
+			callback(userData, &mesh, colors, numColors);
+		}
+	}
+}
+
+static void tessStrokePath(Tessellator* tess, const State* state, float fringeWidth, DrawCommand::Type::Enum paintType, Color color, float width, uint32_t flags, bool recordClipCommands, bool hasCache, TessMeshCallback callback, void* userData)
+{
+	VG_CHECK(paintType != DrawCommand::Type::Clip, "Invalid paint type");
+
+	const bool isSolidColor = paintType == DrawCommand::Type::Textured;
+
+	const float avgScale = state->m_AvgScale;
+	const float globalAlpha = hasCache ? 1.0f : state->m_GlobalAlpha;
+
+	const float scaledStrokeWidth = ((flags & StrokeFlags::FixedWidth) != 0) ? width : bx::clamp<float>(width * avgScale, 0.0f, 200.0f);
+	const bool isThin = scaledStrokeWidth <= fringeWidth;
+
+	Color col = Colors::Black;
+	if (isSolidColor) {
+		const float alphaScale = !isThin ? globalAlpha : globalAlpha * bx::square(bx::clamp<float>(scaledStrokeWidth, 0.0f, fringeWidth));
+		col = recordClipCommands ? Colors::Black : colorSetAlpha(color, (uint8_t)(alphaScale * colorGetAlpha(color)));
+	} else if (paintType == DrawCommand::Type::ImagePattern) {
+		const float alphaScale = isThin ? globalAlpha : globalAlpha * bx::square(bx::clamp<float>(scaledStrokeWidth, 0.0f, fringeWidth));
+		col = colorSetAlpha(color, (uint8_t)(alphaScale * colorGetAlpha(color)));
+	}
+
+	if (paintType != DrawCommand::Type::ColorGradient && !hasCache && colorGetAlpha(col) == 0) {
+		return;
+	}
+
+	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
+	const LineCap::Enum lineCap = (LineCap::Enum)((flags & VG_STROKE_FLAGS_LINE_CAP_Msk) >> VG_STROKE_FLAGS_LINE_CAP_Pos);
+#if VG_CONFIG_FORCE_AA_OFF
+	const bool aa = false;
+#else
+	const bool aa = (isSolidColor && recordClipCommands)
+		? false
+		: (bool)((flags & VG_STROKE_FLAGS_AA_Msk) >> VG_STROKE_FLAGS_AA_Pos)
+		;
+#endif
+
+	const float strokeWidth = isThin ? fringeWidth : scaledStrokeWidth;
+
+	const float* pathVertices = tessTransformPath(tess, state->m_TransformMtx);
+
+	const Path* path = tess->m_Path;
+	const uint32_t numSubPaths = pathGetNumSubPaths(path);
+	const SubPath* subPaths = pathGetSubPaths(path);
+	Stroker* stroker = tess->m_Stroker;
+
+	for (uint32_t iSubPath = 0; iSubPath < numSubPaths; ++iSubPath) {
+		const SubPath* subPath = &subPaths[iSubPath];
+		if (subPath->m_NumVertices < 2) {
+			continue;
+		}
+
+		const float* vtx = &pathVertices[subPath->m_FirstVertexID << 1];
+		const uint32_t numPathVertices = subPath->m_NumVertices;
+		const bool isClosed = subPath->m_IsClosed;
+
+		Mesh mesh;
+		const uint32_t* colors = &col;
+		uint32_t numColors = 1;
+		if (aa) {
+			if (isThin) {
+				strokerPolylineStrokeAAThin(stroker, &mesh, vtx, numPathVertices, isClosed, col, lineCap, lineJoin);
+			} else {
+				strokerPolylineStrokeAA(stroker, &mesh, vtx, numPathVertices, isClosed, col, strokeWidth, lineCap, lineJoin);
+			}
+
+			colors = mesh.m_ColorBuffer;
+			numColors = mesh.m_NumVertices;
+		} else {
+			strokerPolylineStroke(stroker, &mesh, vtx, numPathVertices, isClosed, strokeWidth, lineCap, lineJoin);
+		}
+
+		callback(userData, &mesh, colors, numColors);
+	}
+}
+
+static void drawCommandMeshCallback(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors)
+{
+	DrawCommandMeshSink* sink = (DrawCommandMeshSink*)userData;
+	Context* ctx = sink->m_Context;
+
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	if (sink->m_AddToCache) {
+		addCachedCommand(ctx, mesh->m_PosBuffer, mesh->m_NumVertices, colors, numColors, mesh->m_IndexBuffer, mesh->m_NumIndices);
+
+		// The mesh has been tessellated using white. Apply the paint color the same way
+		// submitCachedMesh() does. Gradients are always tessellated using black.
+		if (sink->m_Type == DrawCommand::Type::Textured || sink->m_Type == DrawCommand::Type::ImagePattern) {
+			uint32_t* paintColors = tessAllocColors(&ctx->m_Tessellator, numColors);
+			vgutil::batchModulateAlpha(colors, numColors, sink->m_Color, paintColors);
+			colors = paintColors;
+		}
+	}
+#endif
+
+	switch (sink->m_Type) {
+	case DrawCommand::Type::Textured:
+		createDrawCommand_VertexColor(ctx, mesh->m_PosBuffer, mesh->m_NumVertices, colors, numColors, mesh->m_IndexBuffer, mesh->m_NumIndices);
+		break;
+	case DrawCommand::Type::ColorGradient:
+		createDrawCommand_ColorGradient(ctx, { sink->m_Handle, 0 }, mesh->m_PosBuffer, mesh->m_NumVertices, colors, numColors, mesh->m_IndexBuffer, mesh->m_NumIndices);
+		break;
+	case DrawCommand::Type::ImagePattern:
+		createDrawCommand_ImagePattern(ctx, { sink->m_Handle, 0 }, mesh->m_PosBuffer, mesh->m_NumVertices, colors, numColors, mesh->m_IndexBuffer, mesh->m_NumIndices);
+		break;
+	case DrawCommand::Type::Clip:
+		createDrawCommand_Clip(ctx, mesh->m_PosBuffer, mesh->m_NumVertices, mesh->m_IndexBuffer, mesh->m_NumIndices);
+		break;
+	default:
+		VG_CHECK(false, "Unknown draw command type");
+		break;
+	}
+}
+
+static bool beginInstancedMeshSink(Context* ctx, InstancedMeshSink* sink, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances)
+{
+	if (numInstances == 0) {
+		return false;
+	}
+
+	const State* state = getState(ctx);
+	if (!vgutil::invertMatrix3(state->m_TransformMtx, sink->m_InvTransformMtx)) {
+		return false;
+	}
+
+	sink->m_Context = ctx;
+	sink->m_InstanceMtx = instanceMtx;
+	sink->m_InstanceColors = instanceColors;
+	sink->m_NumInstances = numInstances;
+	sink->m_LocalPos = nullptr;
+	sink->m_LocalPosCapacity = 0;
+
+	return true;
+}
+
+static void endInstancedMeshSink(Context* ctx, InstancedMeshSink* sink)
+{
+	bx::alignedFree(ctx->m_Allocator, sink->m_LocalPos, 16);
+	sink->m_LocalPos = nullptr;
+	sink->m_LocalPosCapacity = 0;
+}
+
+static void instancedMeshCallback(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors)
+{
+	InstancedMeshSink* sink = (InstancedMeshSink*)userData;
+	Context* ctx = sink->m_Context;
+
+	const uint32_t numVertices = mesh->m_NumVertices;
+	if (numVertices > sink->m_LocalPosCapacity) {
+		sink->m_LocalPos = (float*)bx::alignedRealloc(ctx->m_Allocator, sink->m_LocalPos, sizeof(float) * 2 * numVertices, 16);
+		sink->m_LocalPosCapacity = numVertices;
+	}
+
+	vgutil::batchTransformPositions(mesh->m_PosBuffer, numVertices, sink->m_LocalPos, sink->m_InvTransformMtx);
+
+	const ImageHandle fontImg = fsGetFontAtlasImage(ctx->m_FontSystem);
+	submitInstancedMesh(ctx, fontImg, sink->m_LocalPos, nullptr, numVertices, colors, numColors, mesh->m_IndexBuffer, mesh->m_NumIndices, sink->m_InstanceMtx, sink->m_InstanceColors, sink->m_NumInstances, true);
+}
+
+static VertexBuffer* allocVertexBuffer(Context* ctx)
+{
+	if (ctx->m_NumVertexBuffers + 1 > ctx->m_VertexBufferCapacity) {
+		ctx->m_VertexBufferCapacity++;
+		ctx->m_VertexBuffers = (VertexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_VertexBuffers, sizeof(VertexBuffer) * ctx->m_VertexBufferCapacity);
+		ctx->m_GPUVertexBuffers = (GPUVertexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_GPUVertexBuffers, sizeof(GPUVertexBuffer) * ctx->m_VertexBufferCapacity);
+
+		GPUVertexBuffer* gpuvb = &ctx->m_GPUVertexBuffers[ctx->m_VertexBufferCapacity - 1];
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+		gpuvb->m_bgfxHandle = BGFX_INVALID_HANDLE;
+#else
+		gpuvb->m_PosBufferHandle = BGFX_INVALID_HANDLE;
+		gpuvb->m_UVBufferHandle = BGFX_INVALID_HANDLE;
+		gpuvb->m_ColorBufferHandle = BGFX_INVALID_HANDLE;
+#endif
+		gpuvb->m_Capacity = 0;
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+		bx::memSet(&gpuvb->m_Content, 0, sizeof(BufferContent));
+#endif
+	}
+
+	const uint32_t capacity = ctx->m_VBVertexCapacity;
+
+	BufferRef* ref = popBufferRef(ctx, &ctx->m_FreeVertexBufferDataList);
+	if (!ref) {
+		const uint32_t dataID = ctx->m_NumVertexBufferData++;
+		ctx->m_VertexBufferData = (VertexBufferData*)bx::realloc(ctx->m_Allocator, ctx->m_VertexBufferData, sizeof(VertexBufferData) * ctx->m_NumVertexBufferData);
+
+		VertexBufferData* data = &ctx->m_VertexBufferData[dataID];
+		bx::memSet(data, 0, sizeof(VertexBufferData));
+		vbDataResize(ctx, data, capacity);
+		data->m_Ref = createBufferRef(ctx, &ctx->m_FreeVertexBufferDataList, dataID);
+
+		ref = data->m_Ref;
+	} else {
+		// Reused buffers follow the high-water mark in both directions.
+		VertexBufferData* data = &ctx->m_VertexBufferData[ref->m_ResourceID];
+		if (data->m_Capacity < capacity || data->m_Capacity > capacity * 2) {
+			vbDataResize(ctx, data, capacity);
+		}
+	}
+
+	const VertexBufferData* data = &ctx->m_VertexBufferData[ref->m_ResourceID];
+	VertexBuffer* vb = &ctx->m_VertexBuffers[ctx->m_NumVertexBuffers++];
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	ref->m_NumPendingReleases = 1;
+
+	vb->m_Vertices = data->m_Vertices;
+#else
+	// Position, color and UV streams are released separately.
+	ref->m_NumPendingReleases = 3;
+
+	vb->m_Pos = data->m_Pos;
+	vb->m_Color = data->m_Color;
+	vb->m_UV = data->m_UV;
+#endif
+	vb->m_Count = 0;
+	vb->m_Capacity = data->m_Capacity;
+	vb->m_Ref = ref;
+
+	return vb;
+}
+
+static void vbDataResize(Context* ctx, VertexBufferData* data, uint32_t capacity)
+{
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	data->m_Vertices = (Vertex*)bx::alignedRealloc(allocator, data->m_Vertices, sizeof(Vertex) * capacity, 16);
+#else
+	data->m_Pos = (pos_t*)bx::alignedRealloc(allocator, data->m_Pos, sizeof(pos_t) * 2 * capacity, 16);
+	data->m_Color = (uint32_t*)bx::alignedRealloc(allocator, data->m_Color, sizeof(uint32_t) * capacity, 16);
+	data->m_UV = (uv_t*)bx::alignedRealloc(allocator, data->m_UV, sizeof(uv_t) * 2 * capacity, 16);
+#endif
+	data->m_Capacity = capacity;
+}
+
+// Records the vertex buffer usage of the last frame and calculates the capacity of new vertex
+// buffers from the high-water mark of the last VG_CONFIG_VB_USAGE_HISTORY_LENGTH frames. GPU
+// buffers of slots which haven't been used during that period are destroyed.
+static void vbUpdateUsageHistory(Context* ctx)
+{
+	const uint32_t numVertexBuffers = ctx->m_NumVertexBuffers;
+
+	VertexBufferUsage* usage = &ctx->m_VBUsageHistory[ctx->m_VBUsageHistoryPos];
+	usage->m_MaxVertices = 0;
+	usage->m_NumBuffers = numVertexBuffers;
+	for (uint32_t i = 0; i < numVertexBuffers; ++i) {
+		usage->m_MaxVertices = bx::max<uint32_t>(usage->m_MaxVertices, ctx->m_VertexBuffers[i].m_Count);
+	}
+	ctx->m_VBUsageHistoryPos = (ctx->m_VBUsageHistoryPos + 1) % VG_CONFIG_VB_USAGE_HISTORY_LENGTH;
+
+	uint32_t highWaterMark = 0;
+	uint32_t maxBuffers = 0;
+	for (uint32_t i = 0; i < VG_CONFIG_VB_USAGE_HISTORY_LENGTH; ++i) {
+		highWaterMark = bx::max<uint32_t>(highWaterMark, ctx->m_VBUsageHistory[i].m_MaxVertices);
+		maxBuffers = bx::max<uint32_t>(maxBuffers, ctx->m_VBUsageHistory[i].m_NumBuffers);
+	}
+
+	// 25% headroom, rounded up to VG_CONFIG_MIN_VB_VERTICES.
+	const uint32_t capacity = alignSize(highWaterMark + (highWaterMark >> 2), VG_CONFIG_MIN_VB_VERTICES);
+	ctx->m_VBVertexCapacity = bx::min<uint32_t>(bx::max<uint32_t>(capacity, VG_CONFIG_MIN_VB_VERTICES), ctx->m_Config.m_MaxVBVertices);
+
+	for (uint32_t i = maxBuffers; i < ctx->m_VertexBufferCapacity; ++i) {
+		destroyGPUVertexBuffer(&ctx->m_GPUVertexBuffers[i]);
+	}
+}
+
+static void destroyGPUVertexBuffer(GPUVertexBuffer* gpuvb)
+{
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	if (bgfx::isValid(gpuvb->m_bgfxHandle)) {
+		bgfx::destroy(gpuvb->m_bgfxHandle);
+		gpuvb->m_bgfxHandle = BGFX_INVALID_HANDLE;
+	}
+#else
+	if (bgfx::isValid(gpuvb->m_PosBufferHandle)) {
+		bgfx::destroy(gpuvb->m_PosBufferHandle);
+		gpuvb->m_PosBufferHandle = BGFX_INVALID_HANDLE;
+	}
+	if (bgfx::isValid(gpuvb->m_UVBufferHandle)) {
+		bgfx::destroy(gpuvb->m_UVBufferHandle);
+		gpuvb->m_UVBufferHandle = BGFX_INVALID_HANDLE;
+	}
+	if (bgfx::isValid(gpuvb->m_ColorBufferHandle)) {
+		bgfx::destroy(gpuvb->m_ColorBufferHandle);
+		gpuvb->m_ColorBufferHandle = BGFX_INVALID_HANDLE;
+	}
+#endif
+	gpuvb->m_Capacity = 0;
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+	gpuvb->m_Content.m_Count = 0;
+#endif
+}
+
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+// NOTE: vbWriteVertices() zeroes the attributes it doesn't write so unused data doesn't change
+// the hash.
+static void vbCalcContent(const VertexBuffer* vb, BufferContent* content)
+{
+	const uint32_t numVertices = vb->m_Count;
+
+	bx::memSet(content, 0, sizeof(BufferContent));
+	content->m_Count = numVertices;
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	const uint32_t size = sizeof(Vertex) * numVertices;
+	content->m_Hash = vgutil::hashMurmur64A(vb->m_Vertices, size, 0);
+	bx::memCopy(content->m_Head, vb->m_Vertices, bx::min<uint32_t>(size, sizeof(content->m_Head)));
+#else
+	const uint32_t posSize = sizeof(pos_t) * 2 * numVertices;
+	uint64_t hash = vgutil::hashMurmur64A(vb->m_Pos, posSize, 0);
+	hash = vgutil::hashMurmur64A(vb->m_UV, sizeof(uv_t) * 2 * numVertices, hash);
+	hash = vgutil::hashMurmur64A(vb->m_Color, sizeof(uint32_t) * numVertices, hash);
+	content->m_Hash = hash;
+	bx::memCopy(content->m_Head, vb->m_Pos, bx::min<uint32_t>(posSize, sizeof(content->m_Head)));
+#endif
+}
+
+static void ibCalcContent(const IndexBuffer* ib, BufferContent* content)
+{
+	const uint32_t size = sizeof(index_t) * ib->m_Count;
+
+	bx::memSet(content, 0, sizeof(BufferContent));
+	content->m_Count = ib->m_Count;
+	content->m_Hash = vgutil::hashMurmur64A(ib->m_Indices, size, 0);
+	bx::memCopy(content->m_Head, ib->m_Indices, bx::min<uint32_t>(size, sizeof(content->m_Head)));
+}
+#endif
+
+// Positions are transformed by mtx if it's not null. UVs and colors are either per-vertex
+// (numUVs/numColors == numVertices) or constant (== 1). Attributes with a count of 0 aren't read
+// by the draw command's program. They are left untouched, unless VG_CONFIG_ENABLE_FRAME_DIFF
+// hashes them, in which case they are zeroed.
+static void vbWriteVertices(VertexBuffer* vb, const DrawCommand* cmd, uint32_t firstVertexID, uint32_t numVertices, const float* pos, const float* mtx, const uv_t* uv, uint32_t numUVs, const uint32_t* colors, uint32_t numColors)
+{
+	VG_CHECK(numUVs == 0 || numUVs == 1 || numUVs == numVertices, "Invalid size of uv array passed.");
+	VG_CHECK(numColors == 0 || numColors == 1 || numColors == numVertices, "Invalid size of color array passed.");
+
+#if VG_CONFIG_POSITION_INT16
+	// Fold the origin and the fixed point scale of the command into the transform.
+	const float* quant = cmd->m_PosQuant;
+	const float scale = quant[2];
+	float quantMtx[6] = { scale, 0.0f, 0.0f, scale, -quant[0] * scale, -quant[1] * scale };
+	if (mtx) {
+		quantMtx[0] = mtx[0] * scale;
+		quantMtx[1] = mtx[1] * scale;
+		quantMtx[2] = mtx[2] * scale;
+		quantMtx[3] = mtx[3] * scale;
+		quantMtx[4] = (mtx[4] - quant[0]) * scale;
+		quantMtx[5] = (mtx[5] - quant[1]) * scale;
+	}
+#else
+	BX_UNUSED(cmd);
+#endif
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	const uint32_t uvStride = numUVs == numVertices ? 2 : 0;
+	const uint32_t colorStride = numColors == numVertices ? 1 : 0;
+
+	Vertex* dst = &vb->m_Vertices[firstVertexID];
+	for (uint32_t i = 0; i < numVertices; ++i) {
+#if VG_CONFIG_POSITION_INT16
+		vgutil::quantizePos2D(pos[0], pos[1], quantMtx, &dst->m_Pos[0]);
+#else
+		if (mtx) {
+			vgutil::transformPos2D(pos[0], pos[1], mtx, &dst->m_Pos[0]);
+		} else {
+			dst->m_Pos[0] = pos[0];
+			dst->m_Pos[1] = pos[1];
+		}
+#endif
+		pos += 2;
+
+		if (numUVs != 0) {
+			dst->m_UV[0] = uv[0];
+			dst->m_UV[1] = uv[1];
+			uv += uvStride;
+		}
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+		else {
+			dst->m_UV[0] = 0;
+			dst->m_UV[1] = 0;
+		}
+#endif
+
+		if (numColors != 0) {
+			dst->m_Color = *colors;
+			colors += colorStride;
+		}
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+		else {
+			dst->m_Color = 0;
+		}
+#endif
+
+		++dst;
+	}
+#else
+	pos_t* dstPos = &vb->m_Pos[firstVertexID << 1];
+#if VG_CONFIG_POSITION_INT16
+	vgutil::batchQuantizePositions(pos, numVertices, dstPos, quantMtx);
+#else
+	if (mtx) {
+		vgutil::batchTransformPositions(pos, numVertices, dstPos, mtx);
+	} else {
+		bx::memCopy(dstPos, pos, sizeof(float) * 2 * numVertices);
+	}
+#endif
+
+	if (numUVs != 0) {
+		uv_t* dstUV = &vb->m_UV[firstVertexID << 1];
+		if (numUVs == numVertices) {
+			bx::memCopy(dstUV, uv, sizeof(uv_t) * 2 * numVertices);
+		} else {
+#if VG_CONFIG_UV_INT16
+			vgutil::memset32(dstUV, numVertices, &uv[0]);
+#else
+			vgutil::memset64(dstUV, numVertices, &uv[0]);
+#endif
+		}
+	}
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+	else {
+		bx::memSet(&vb->m_UV[firstVertexID << 1], 0, sizeof(uv_t) * 2 * numVertices);
+	}
+#endif
+
+	if (numColors != 0) {
+		uint32_t* dstColor = &vb->m_Color[firstVertexID];
+		if (numColors == numVertices) {
+			bx::memCopy(dstColor, colors, sizeof(uint32_t) * numVertices);
+		} else {
+			vgutil::memset32(dstColor, numVertices, colors);
+		}
+	}
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+	else {
+		bx::memSet(&vb->m_Color[firstVertexID], 0, sizeof(uint32_t) * numVertices);
+	}
+#endif
+#endif
+}
+
+static uint16_t allocIndexBuffer(Context* ctx)
+{
+	BufferRef* ref = popBufferRef(ctx, &ctx->m_FreeIndexBufferList);
+	if (!ref) {
+		const uint32_t ibID = ctx->m_NumIndexBuffers++;
+		ctx->m_IndexBuffers = (IndexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_IndexBuffers, sizeof(IndexBuffer) * ctx->m_NumIndexBuffers);
+		ctx->m_GPUIndexBuffers = (GPUIndexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_GPUIndexBuffers, sizeof(GPUIndexBuffer) * ctx->m_NumIndexBuffers);
+
+		IndexBuffer* ib = &ctx->m_IndexBuffers[ibID];
+		ib->m_Capacity = 0;
+		ib->m_Count = 0;
+		ib->m_Indices = nullptr;
+		ib->m_Ref = createBufferRef(ctx, &ctx->m_FreeIndexBufferList, ibID);
+
+		GPUIndexBuffer* gpuib = &ctx->m_GPUIndexBuffers[ibID];
+		gpuib->m_bgfxHandle = BGFX_INVALID_HANDLE;
+#if VG_CONFIG_ENABLE_FRAME_DIFF
+		bx::memSet(&gpuib->m_Content, 0, sizeof(BufferContent));
+#endif
+
+		ref = ib->m_Ref;
+	}
+
+	ref->m_NumPendingReleases = 1;
+
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ref->m_ResourceID];
+	ib->m_Count = 0;
+
+	return (uint16_t)ref->m_ResourceID;
+}
+
+static BufferRef* createBufferRef(Context* ctx, volatile uint32_t* freeList, uint32_t resourceID)
+{
+	BufferRef* ref = (BufferRef*)bx::alloc(ctx->m_Allocator, sizeof(BufferRef));
+	ref->m_Context = ctx;
+	ref->m_FreeList = freeList;
+	ref->m_ID = ctx->m_NumBufferRefs;
+	ref->m_ResourceID = resourceID;
+	ref->m_NextFreeID = UINT32_MAX;
+	ref->m_NumPendingReleases = 0;
+
+	ctx->m_NumBufferRefs++;
+	ctx->m_BufferRefs = (BufferRef**)bx::realloc(ctx->m_Allocator, ctx->m_BufferRefs, sizeof(BufferRef*) * ctx->m_NumBufferRefs);
+	ctx->m_BufferRefs[ref->m_ID] = ref;
+
+	return ref;
+}
+
+// NOTE: Can be called from any thread.
+static void pushBufferRef(BufferRef* ref)
+{
+	volatile uint32_t* freeList = ref->m_FreeList;
+	const uint32_t refID = ref->m_ID;
+
+	uint32_t head;
+	do {
+		head = *freeList;
+		ref->m_NextFreeID = head;
+	} while (bx::atomicCompareAndSwap(freeList, head, refID) != head);
+}
+
+// NOTE: Should only be called from the thread calling begin()/end().
+static BufferRef* popBufferRef(Context* ctx, volatile uint32_t* freeList)
+{
+	uint32_t head;
+	uint32_t next;
+	do {
+		head = *freeList;
+		if (head == UINT32_MAX) {
+			return nullptr;
+		}
+
+		next = ctx->m_BufferRefs[head]->m_NextFreeID;
+	} while (bx::atomicCompareAndSwap(freeList, head, next) != head);
+
+	return ctx->m_BufferRefs[head];
+}
+
+static void createDrawCommand_VertexColor(Context* ctx, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices)
+{
+	// Allocate the draw command
+	const ImageHandle fontImg = fsGetFontAtlasImage(ctx->m_FontSystem);
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, vtx, numVertices, nullptr);
+#endif
+	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::Textured, fontImg.idx);
+
+	// Vertex buffer
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	const uv_t* uv = fsGetWhitePixelUV(ctx->m_FontSystem);
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, vtx, nullptr, uv, 1, colors, numColors);
+
+	// Index buffer
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+
+static void createDrawCommand_Textured(Context* ctx, ImageHandle img, const float* vtx, const uv_t* uv, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices)
+{
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, vtx, numVertices, nullptr);
+#endif
+	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::Textured, img.idx);
+
+	// Vertex buffer
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	const uv_t* vtxUV = uv ? uv : fsGetWhitePixelUV(ctx->m_FontSystem);
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, vtx, nullptr, vtxUV, uv ? numVertices : 1, colors, numColors);
+
+	// Index buffer
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+
+#if VG_CONFIG_ENABLE_ANALYTIC_AA
+static void createDrawCommand_Coverage(Context* ctx, const float* vtx, const float* uv, uint32_t numVertices, Color color, const index_t* indices, uint32_t numIndices)
+{
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, vtx, numVertices, nullptr);
+#endif
+	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::Coverage, UINT16_MAX);
+
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	// NOTE: uv_t is float (see the static assert at the top of the file).
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, vtx, nullptr, (const uv_t*)uv, numVertices, &color, 1);
+
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+#endif
+
+static void createDrawCommand_ImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices)
+{
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, vtx, numVertices, nullptr);
+#endif
+	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::ImagePattern, imgPatternHandle.idx);
+
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, vtx, nullptr, nullptr, 0, colors, numColors);
+
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+
+static void createDrawCommand_ColorGradient(Context* ctx, GradientHandle gradientHandle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices)
+{
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, vtx, numVertices, nullptr);
+#endif
+	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::ColorGradient, gradientHandle.idx);
+
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, vtx, nullptr, nullptr, 0, colors, numColors);
+
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+
+static void createDrawCommand_Clip(Context* ctx, const float* vtx, uint32_t numVertices, const index_t* indices, uint32_t numIndices)
+{
+	// Allocate the draw command
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, vtx, numVertices, nullptr);
+#endif
+	DrawCommand* cmd = allocClipCommand(ctx, numVertices, numIndices);
+
+	// Vertex buffer
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	vbWriteVertices(vb, cmd, vbOffset, numVertices, vtx, nullptr, nullptr, 0, nullptr, 0);
+
+	// Index buffer
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numVertices;
+	cmd->m_NumIndices += numIndices;
+}
+
+// The vertices of all contours (with at least 3 vertices) are followed by the 4 corners of the
+// path's bounding rect. The indices of the triangle fans come first (m_NumStencilIndices), then
+// the 2 triangles of the cover quad. See end() for how they are rendered.
+static void createDrawCommand_StencilCover(Context* ctx, DrawCommand::Type::Enum type, uint16_t handle, const float* pathVertices, const SubPath* subPaths, uint32_t numSubPaths, uint32_t color, FillRule::Enum fillRule)
+{
+	uint32_t numFanVertices = 0;
+	uint32_t numFanIndices = 0;
+	float bounds[4] = { bx::kFloatMax, bx::kFloatMax, -bx::kFloatMax, -bx::kFloatMax };
+	for (uint32_t i = 0; i < numSubPaths; ++i) {
+		const SubPath* subPath = &subPaths[i];
+		if (subPath->m_NumVertices < 3) {
+			continue;
+		}
+
+		float subPathBounds[4];
+		vgutil::calcBoundingRect(&pathVertices[subPath->m_FirstVertexID << 1], subPath->m_NumVertices, &subPathBounds[0]);
+		bounds[0] = bx::min<float>(bounds[0], subPathBounds[0]);
+		bounds[1] = bx::min<float>(bounds[1], subPathBounds[1]);
+		bounds[2] = bx::max<float>(bounds[2], subPathBounds[2]);
+		bounds[3] = bx::max<float>(bounds[3], subPathBounds[3]);
+
+		numFanVertices += subPath->m_NumVertices;
+		numFanIndices += (subPath->m_NumVertices - 2) * 3;
+	}
+
+	if (numFanVertices == 0) {
+		return;
+	}
+
+	if (type == DrawCommand::Type::Textured) {
+		handle = fsGetFontAtlasImage(ctx->m_FontSystem).idx;
+	}
+
+#if VG_CONFIG_POSITION_INT16
+	// The 2 corners of the bounding rect cover all vertices.
+	setPosQuantization(ctx, &bounds[0], 2, nullptr);
+#endif
+
+	// The stencil pass cannot be shared with other paths.
+	ctx->m_ForceNewDrawCommand = true;
+	DrawCommand* cmd = allocDrawCommand(ctx, numFanVertices + 4, numFanIndices + 6, type, handle);
+
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uv_t* uv = type == DrawCommand::Type::Textured ? fsGetWhitePixelUV(ctx->m_FontSystem) : nullptr;
+	const uint32_t numUVs = uv ? 1 : 0;
+
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID];
+
+	uint32_t firstVertexID = 0;
+	for (uint32_t i = 0; i < numSubPaths; ++i) {
+		const SubPath* subPath = &subPaths[i];
+		const uint32_t numVertices = subPath->m_NumVertices;
+		if (numVertices < 3) {
+			continue;
+		}
+
+		vbWriteVertices(vb, cmd, cmd->m_FirstVertexID + firstVertexID, numVertices, &pathVertices[subPath->m_FirstVertexID << 1], nullptr, uv, numUVs, &color, 1);
+
+		for (uint32_t j = 1; j < numVertices - 1; ++j) {
+			dstIndex[0] = (index_t)firstVertexID;
+			dstIndex[1] = (index_t)(firstVertexID + j);
+			dstIndex[2] = (index_t)(firstVertexID + j + 1);
+			dstIndex += 3;
+		}
+
+		firstVertexID += numVertices;
+	}
+
+	const float coverQuad[8] = {
+		bounds[0], bounds[1],
+		bounds[2], bounds[1],
+		bounds[2], bounds[3],
+		bounds[0], bounds[3]
+	};
+	vbWriteVertices(vb, cmd, cmd->m_FirstVertexID + firstVertexID, 4, &coverQuad[0], nullptr, uv, numUVs, &color, 1);
+
+	dstIndex[0] = (index_t)firstVertexID;
+	dstIndex[1] = (index_t)(firstVertexID + 1);
+	dstIndex[2] = (index_t)(firstVertexID + 2);
+	dstIndex[3] = (index_t)firstVertexID;
+	dstIndex[4] = (index_t)(firstVertexID + 2);
+	dstIndex[5] = (index_t)(firstVertexID + 3);
+
+	cmd->m_NumVertices = numFanVertices + 4;
+	cmd->m_NumIndices = numFanIndices + 6;
+	cmd->m_NumStencilIndices = numFanIndices;
+	cmd->m_StencilFillRule = fillRule;
+
+	ctx->m_ForceNewDrawCommand = true;
+}
+
+// NOTE: Side effect: Resets m_ForceNewDrawCommand and m_ForceNewClipCommand if the current
+// vertex buffer cannot hold the specified amount of vertices.
+static uint32_t allocVertices(Context* ctx, uint32_t numVertices, uint32_t* vbID)
+{
+	VG_CHECK(numVertices < ctx->m_Config.m_MaxVBVertices, "A single draw call cannot have more than %d vertices", ctx->m_Config.m_MaxVBVertices);
+
+	// Check if the current vertex buffer can hold the specified amount of vertices
+	VertexBuffer* vb = &ctx->m_VertexBuffers[ctx->m_NumVertexBuffers - 1];
+	const uint32_t maxVBVertices = ctx->m_Config.m_MaxVBVertices;
+	if (vb->m_Count + numVertices > maxVBVertices) {
+		// It cannot. Allocate a new vb.
+		vb = allocVertexBuffer(ctx);
+		VG_CHECK(vb, "Failed to allocate new Vertex Buffer");
+
+		// The currently active vertex buffer has changed so force a new draw command.
+		ctx->m_ForceNewDrawCommand = true;
+		ctx->m_ForceNewClipCommand = true;
+	}
+
+	if (vb->m_Count + numVertices > vb->m_Capacity) {
+		// Grow the vertex buffer in place. bgfx doesn't reference its memory before end().
+		VertexBufferData* data = &ctx->m_VertexBufferData[vb->m_Ref->m_ResourceID];
+		vbDataResize(ctx, data, bx::min<uint32_t>(bx::max<uint32_t>(vb->m_Capacity * 2, vb->m_Count + numVertices), maxVBVertices));
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+		vb->m_Vertices = data->m_Vertices;
+#else
+		vb->m_Pos = data->m_Pos;
+		vb->m_Color = data->m_Color;
+		vb->m_UV = data->m_UV;
+#endif
+		vb->m_Capacity = data->m_Capacity;
+	}
+
+	*vbID = (uint32_t)(vb - ctx->m_VertexBuffers);
+
+	const uint32_t firstVertexID = vb->m_Count;
+	vb->m_Count += numVertices;
+	return firstVertexID;
+}
+
+static uint32_t allocIndices(Context* ctx, uint32_t numIndices)
+{
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	if (ib->m_Count + numIndices > ib->m_Capacity) {
+		const uint32_t nextCapacity = ib->m_Capacity != 0 ? (ib->m_Capacity * 3) / 2 : 32;
+
+		ib->m_Capacity = bx::uint32_max(nextCapacity, ib->m_Count + numIndices);
+		ib->m_Indices = (index_t*)bx::alignedRealloc(ctx->m_Allocator, ib->m_Indices, sizeof(index_t) * ib->m_Capacity, 16);
+	}
+
+	const uint32_t firstIndexID = ib->m_Count;
+	ib->m_Count += numIndices;
+	return firstIndexID;
+}
+
+static DrawCommand* allocDrawCommand(Context* ctx, uint32_t numVertices, uint32_t numIndices, DrawCommand::Type::Enum type, uint16_t handle)
+{
+	uint32_t vertexBufferID;
+	const uint32_t firstVertexID = allocVertices(ctx, numVertices, &vertexBufferID);
+	const uint32_t firstIndexID = allocIndices(ctx, numIndices);
+
+	const State* state = getState(ctx);
+	const float* scissor = state->m_ScissorRect;
+
+	if (!ctx->m_ForceNewDrawCommand && ctx->m_NumDrawCommands != 0) {
+		DrawCommand* prevCmd = &ctx->m_DrawCommands[ctx->m_NumDrawCommands - 1];
+
+		VG_CHECK(prevCmd->m_VertexBufferID == vertexBufferID, "Cannot merge draw commands with different vertex buffers");
+		VG_CHECK(prevCmd->m_ScissorRect[0] == (uint16_t)scissor[0]
+		      && prevCmd->m_ScissorRect[1] == (uint16_t)scissor[1]
+		      && prevCmd->m_ScissorRect[2] == (uint16_t)scissor[2]
+		      && prevCmd->m_ScissorRect[3] == (uint16_t)scissor[3], "Invalid scissor rect");
+
+		VG_CHECK(prevCmd->m_LayerID == ctx->m_ActiveLayerID, "Cannot merge draw commands of different layers");
+
+		if (prevCmd->m_Type == type && prevCmd->m_HandleID == handle && prevCmd->m_TransformID == ctx->m_ActiveDrawTransformID
+#if VG_CONFIG_POSITION_INT16
+		 && !bx::memCmp(prevCmd->m_PosQuant, ctx->m_PosQuant, sizeof(float) * 3)
+#endif
+			) {
+			return prevCmd;
+		}
+	}
+
+	// The new draw command cannot be combined with the previous one. Create a new one.
+	if (ctx->m_NumDrawCommands == ctx->m_DrawCommandCapacity) {
+		ctx->m_DrawCommandCapacity = ctx->m_DrawCommandCapacity + 32;
+		ctx->m_DrawCommands = (DrawCommand*)bx::realloc(ctx->m_Allocator, ctx->m_DrawCommands, sizeof(DrawCommand) * ctx->m_DrawCommandCapacity);
+	}
+
+	DrawCommand* cmd = &ctx->m_DrawCommands[ctx->m_NumDrawCommands];
+	ctx->m_NumDrawCommands++;
+
+	cmd->m_VertexBufferID = vertexBufferID;
+	cmd->m_FirstVertexID = firstVertexID;
+	cmd->m_FirstIndexID = firstIndexID;
+	cmd->m_NumVertices = 0;
+	cmd->m_NumIndices = 0;
+	cmd->m_Type = type;
+	cmd->m_HandleID = handle;
+	cmd->m_RetainedDrawID = UINT32_MAX;
+	cmd->m_TransformID = ctx->m_ActiveDrawTransformID;
+	cmd->m_LayerID = ctx->m_ActiveLayerID;
+	cmd->m_NumStencilIndices = 0;
+	cmd->m_StencilFillRule = FillRule::NonZero;
+	cmd->m_FirstInstanceID = 0;
+	cmd->m_NumInstances = 0;
+	cmd->m_SDFBlur = 0.0f;
+#if VG_CONFIG_POSITION_INT16
+	bx::memCopy(cmd->m_PosQuant, ctx->m_PosQuant, sizeof(float) * 3);
+#endif
+	cmd->m_ScissorRect[0] = (uint16_t)scissor[0];
+	cmd->m_ScissorRect[1] = (uint16_t)scissor[1];
+	cmd->m_ScissorRect[2] = (uint16_t)scissor[2];
+	cmd->m_ScissorRect[3] = (uint16_t)scissor[3];
+	bx::memCopy(&cmd->m_ClipState, &ctx->m_ClipState, sizeof(ClipState));
+
+	ctx->m_ForceNewDrawCommand = false;
+
+	return cmd;
+}
+
+// Returns the index of the 2x3 matrix in Context::m_DrawTransforms. Consecutive calls with the
+// same matrix share the entry.
+static uint32_t pushDrawTransform(Context* ctx, const float* mtx)
+{
+	// 2x3 => 4x4 (bx) matrix
+	float modelMtx[16];
+	bx::mtxIdentity(modelMtx);
+	modelMtx[0] = mtx[0];
+	modelMtx[1] = mtx[1];
+	modelMtx[4] = mtx[2];
+	modelMtx[5] = mtx[3];
+	modelMtx[12] = mtx[4];
+	modelMtx[13] = mtx[5];
+
+	const uint32_t numTransforms = ctx->m_NumDrawTransforms;
+	if (numTransforms != 0 && !bx::memCmp(ctx->m_DrawTransforms[numTransforms - 1].m_ModelMtx, modelMtx, sizeof(float) * 16)) {
+		return numTransforms - 1;
+	}
+
+	if (numTransforms == ctx->m_DrawTransformCapacity) {
+		ctx->m_DrawTransformCapacity = ctx->m_DrawTransformCapacity + 32;
+		ctx->m_DrawTransforms = (DrawTransform*)bx::realloc(ctx->m_Allocator, ctx->m_DrawTransforms, sizeof(DrawTransform) * ctx->m_DrawTransformCapacity);
+	}
+
+	bx::memCopy(ctx->m_DrawTransforms[numTransforms].m_ModelMtx, modelMtx, sizeof(float) * 16);
+	ctx->m_NumDrawTransforms++;
+
+	return numTransforms;
+}
+
+#if VG_CONFIG_POSITION_INT16
+// Picks the origin and the scale of the quantized positions of the next draw command from the
+// bounding rect of its vertices (transformed by mtx, if not null). Everything inside the range of
+// VG_CONFIG_POSITION_INT16_FRAC_BITS around the canvas origin shares the default quantization so
+// it can be batched. Larger draws are quantized relative to their center and lose fractional bits
+// until they fit, instead of being clamped.
+static void setPosQuantization(Context* ctx, const float* vtx, uint32_t numVertices, const float* mtx)
+{
+	float* quant = ctx->m_PosQuant;
+	quant[0] = 0.0f;
+	quant[1] = 0.0f;
+	quant[2] = VG_POSITION_SCALE;
+	if (numVertices == 0) {
+		return;
+	}
+
+	float bounds[4];
+	vgutil::calcBoundingRect(vtx, numVertices, &bounds[0]);
+	if (mtx) {
+		const float localBounds[4] = { bounds[0], bounds[1], bounds[2], bounds[3] };
+		transformRect(&localBounds[0], mtx, &bounds[0]);
+	}
+
+	const float maxPos = 32767.0f / VG_POSITION_SCALE;
+	if (bounds[0] >= -maxPos && bounds[1] >= -maxPos && bounds[2] <= maxPos && bounds[3] <= maxPos) {
+		return;
+	}
+
+	const float cx = bx::floor((bounds[0] + bounds[2]) * 0.5f);
+	const float cy = bx::floor((bounds[1] + bounds[3]) * 0.5f);
+	const float halfExtent = bx::max<float>(bx::max<float>(cx - bounds[0], bounds[2] - cx), bx::max<float>(cy - bounds[1], bounds[3] - cy));
+
+	// Powers of 2 keep the decoded positions exact.
+	float scale = VG_POSITION_SCALE;
+	while (halfExtent * scale > 32767.0f && scale > 1.0f / 65536.0f) {
+		scale *= 0.5f;
+	}
+
+	quant[0] = cx;
+	quant[1] = cy;
+	quant[2] = scale;
+}
+
+// Sets the model matrix which maps quantized positions back to canvas space. All draw calls with
+// the default quantization share the same bgfx matrix cache entry.
+static void setPositionDecodeTransform(const float* quant, uint32_t* cacheID)
+{
+	const bool isDefault = quant[0] == 0.0f && quant[1] == 0.0f && quant[2] == VG_POSITION_SCALE;
+	if (isDefault && *cacheID != UINT32_MAX) {
+		bgfx::setTransform(*cacheID);
+		return;
+	}
+
+	float modelMtx[16];
+	bx::mtxIdentity(modelMtx);
+	modelMtx[0] = 1.0f / quant[2];
+	modelMtx[5] = 1.0f / quant[2];
+	modelMtx[12] = quant[0];
+	modelMtx[13] = quant[1];
+
+	const uint32_t id = bgfx::setTransform(modelMtx);
+	if (isDefault) {
+		*cacheID = id;
+	}
+}
+
+// Paint shaders calculate the paint coordinates from the (quantized) vertex attribute.
+// res = paintMtx * decode, with both 3x3 matrices stored column by column.
+static void paintMatrixDecodePositions(const float* paintMtx, const float* quant, float* res)
+{
+	const float invScale = 1.0f / quant[2];
+	for (uint32_t i = 0; i < 3; ++i) {
+		res[i + 0] = paintMtx[i + 0] * invScale;
+		res[i + 3] = paintMtx[i + 3] * invScale;
+		res[i + 6] = paintMtx[i + 0] * quant[0] + paintMtx[i + 3] * quant[1] + paintMtx[i + 6];
+	}
+}
+#endif
+
+// Draws a local space mesh once per instance. The vertices are copied to the vertex buffer once and
+// the instances are drawn with a single instanced submit. The current transform is the command's model
+// matrix and the instance matrices and colors are passed to the vertex shader as instance data.
+// If colorsAreCoverage is true, the vertex colors hold only the AA coverage (white * alpha) and are
+// multiplied with the instance colors. Otherwise the instance colors replace the vertex colors.
+static void submitInstancedMesh(Context* ctx, ImageHandle img, const float* pos, const uv_t* uv, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances, bool colorsAreCoverage)
+{
+	if (numInstances == 0) {
+		return;
+	}
+
+	VG_CHECK(ctx->m_ActiveDrawTransformID == UINT32_MAX, "Nested GPU transforms aren't supported");
+
+	const State* state = getState(ctx);
+
+	if (!bgfx::isValid(ctx->m_InstancedProgramHandle)) {
+		submitInstancedMeshCPU(ctx, img, pos, uv, numVertices, colors, numColors, indices, numIndices, instanceMtx, instanceColors, numInstances, colorsAreCoverage);
+		return;
+	}
+
+	const uint32_t white = Colors::White;
+	if (instanceColors && !colorsAreCoverage) {
+		colors = &white;
+		numColors = 1;
+	}
+
+	ctx->m_ActiveDrawTransformID = pushDrawTransform(ctx, state->m_TransformMtx);
+	ctx->m_ForceNewDrawCommand = true;
+
+	createDrawCommand_Textured(ctx, img, pos, uv, numVertices, colors, numColors, indices, numIndices);
+
+	DrawCommand* cmd = &ctx->m_DrawCommands[ctx->m_NumDrawCommands - 1];
+	cmd->m_FirstInstanceID = allocInstances(ctx, numInstances);
+	cmd->m_NumInstances = numInstances;
+
+#if VG_CONFIG_POSITION_INT16
+	// The instance matrices are applied to the quantized positions so they have to decode them first.
+	const float decodeScale = 1.0f / cmd->m_PosQuant[2];
+	const float decodeOrigin[2] = { cmd->m_PosQuant[0], cmd->m_PosQuant[1] };
+#else
+	const float decodeScale = 1.0f;
+	const float decodeOrigin[2] = { 0.0f, 0.0f };
+#endif
+
+	InstanceData* dst = &ctx->m_InstanceData[cmd->m_FirstInstanceID];
+	for (uint32_t i = 0; i < numInstances; ++i) {
+		const float* mtx = &instanceMtx[i * 6];
+		dst->m_MtxRow0[0] = mtx[0] * decodeScale;
+		dst->m_MtxRow0[1] = mtx[2] * decodeScale;
+		dst->m_MtxRow0[2] = mtx[0] * decodeOrigin[0] + mtx[2] * decodeOrigin[1] + mtx[4];
+		dst->m_MtxRow0[3] = 0.0f;
+		dst->m_MtxRow1[0] = mtx[1] * decodeScale;
+		dst->m_MtxRow1[1] = mtx[3] * decodeScale;
+		dst->m_MtxRow1[2] = mtx[1] * decodeOrigin[0] + mtx[3] * decodeOrigin[1] + mtx[5];
+		dst->m_MtxRow1[3] = 0.0f;
+
+		const Color c = instanceColors ? instanceColors[i] : Colors::White;
+		dst->m_Color[0] = colorGetRed(c) / 255.0f;
+		dst->m_Color[1] = colorGetGreen(c) / 255.0f;
+		dst->m_Color[2] = colorGetBlue(c) / 255.0f;
+		dst->m_Color[3] = colorGetAlpha(c) / 255.0f;
+
+		++dst;
+	}
+
+	// Nothing else should be appended to the instanced draw command.
+	ctx->m_ActiveDrawTransformID = UINT32_MAX;
+	ctx->m_ForceNewDrawCommand = true;
+}
+
+// Fallback for renderers without instancing support. Every instance is transformed on the CPU
+// and appended to the current batch.
+static void submitInstancedMeshCPU(Context* ctx, ImageHandle img, const float* pos, const uv_t* uv, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices, const float* instanceMtx, const Color* instanceColors, uint32_t numInstances, bool colorsAreCoverage)
+{
+	const State* state = getState(ctx);
+	const float* stateMtx = state->m_TransformMtx;
+
+	Tessellator* tess = &ctx->m_Tessellator;
+	float* transformedVertices = tessAllocTransformedVertices(tess, numVertices);
+	uint32_t* instColors = (instanceColors && colorsAreCoverage) ? tessAllocColors(tess, numColors) : nullptr;
+
+	float mtx[6];
+	for (uint32_t i = 0; i < numInstances; ++i) {
+		vgutil::multiplyMatrix3(stateMtx, &instanceMtx[i * 6], mtx);
+		vgutil::batchTransformPositions(pos, numVertices, transformedVertices, mtx);
+
+		const uint32_t* drawColors = colors;
+		uint32_t numDrawColors = numColors;
+		if (instColors) {
+			vgutil::batchModulateAlpha(colors, numColors, instanceColors[i], instColors);
+			drawColors = instColors;
+		} else if (instanceColors) {
+			drawColors = &instanceColors[i];
+			numDrawColors = 1;
+		}
+
+		createDrawCommand_Textured(ctx, img, transformedVertices, uv, numVertices, drawColors, numDrawColors, indices, numIndices);
+	}
+}
+
+// Returns the index of the first of numInstances consecutive entries in Context::m_InstanceData.
+static uint32_t allocInstances(Context* ctx, uint32_t numInstances)
+{
+	const uint32_t firstInstanceID = ctx->m_NumInstances;
+	if (firstInstanceID + numInstances > ctx->m_InstanceCapacity) {
+		ctx->m_InstanceCapacity = bx::max<uint32_t>(ctx->m_InstanceCapacity * 2, firstInstanceID + numInstances);
+		ctx->m_InstanceData = (InstanceData*)bx::realloc(ctx->m_Allocator, ctx->m_InstanceData, sizeof(InstanceData) * ctx->m_InstanceCapacity);
+	}
+
+	ctx->m_NumInstances += numInstances;
+
+	return firstInstanceID;
+}
+
+static inline uint32_t premultiplyColor(uint32_t c)
+{
+	const uint32_t a = colorGetAlpha(c);
+	const uint32_t r = (colorGetRed(c) * a + 127) / 255;
+	const uint32_t g = (colorGetGreen(c) * a + 127) / 255;
+	const uint32_t b = (colorGetBlue(c) * a + 127) / 255;
+	return color4ub((uint8_t)r, (uint8_t)g, (uint8_t)b, (uint8_t)a);
+}
+
+// Images with premultiplied alpha (layers) are blended with (ONE, INV_SRC_ALPHA) and the shaders
+// multiply the texel with the vertex color, so the vertex colors (and instance colors) of the
+// commands drawing them have to be premultiplied as well. Otherwise global alpha, pattern alpha
+// and AA fringes scale only the alpha channel, which leaves halos.
+static void premultiplyDrawCommandColors(Context* ctx)
+{
+	const uint32_t numDrawCommands = ctx->m_NumDrawCommands;
+	for (uint32_t iCmd = 0; iCmd < numDrawCommands; ++iCmd) {
+		const DrawCommand* cmd = &ctx->m_DrawCommands[iCmd];
+
+		// The colors of retained draws are premultiplied when their GPU buffers are built
+		// (see clCacheUpdateGPUBuffers()).
+		if (cmd->m_RetainedDrawID != UINT32_MAX) {
+			continue;
+		}
+
+		uint16_t imageID = UINT16_MAX;
+		if (cmd->m_Type == DrawCommand::Type::Textured) {
+			imageID = cmd->m_HandleID;
+		} else if (cmd->m_Type == DrawCommand::Type::ImagePattern) {
+			imageID = ctx->m_ImagePatterns[cmd->m_HandleID].m_ImageHandle.idx;
+		}
+
+		if (imageID == UINT16_MAX || !ctx->m_Images[imageID].m_PremultipliedAlpha) {
+			continue;
+		}
+
+		VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+		const uint32_t numVertices = cmd->m_NumVertices;
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+		Vertex* vtx = &vb->m_Vertices[cmd->m_FirstVertexID];
+		for (uint32_t i = 0; i < numVertices; ++i) {
+			vtx[i].m_Color = premultiplyColor(vtx[i].m_Color);
+		}
+#else
+		uint32_t* colors = &vb->m_Color[cmd->m_FirstVertexID];
+		for (uint32_t i = 0; i < numVertices; ++i) {
+			colors[i] = premultiplyColor(colors[i]);
+		}
+#endif
+
+		const uint32_t numInstances = cmd->m_NumInstances;
+		for (uint32_t i = 0; i < numInstances; ++i) {
+			float* color = ctx->m_InstanceData[cmd->m_FirstInstanceID + i].m_Color;
+			color[0] *= color[3];
+			color[1] *= color[3];
+			color[2] *= color[3];
+		}
+	}
+}
+
+#if VG_CONFIG_ENABLE_DRAW_COMMAND_MERGING
+static bool drawCommandsCanMerge(const DrawCommand* a, const DrawCommand* b)
+{
+	return a->m_Type == b->m_Type
+		&& a->m_HandleID == b->m_HandleID
+		&& a->m_VertexBufferID == b->m_VertexBufferID
+		&& a->m_RetainedDrawID == UINT32_MAX && b->m_RetainedDrawID == UINT32_MAX
+		&& a->m_TransformID == UINT32_MAX && b->m_TransformID == UINT32_MAX
+		&& a->m_LayerID == b->m_LayerID
+		&& a->m_NumStencilIndices == 0 && b->m_NumStencilIndices == 0
+		&& !bx::memCmp(a->m_ScissorRect, b->m_ScissorRect, sizeof(uint16_t) * 4)
+		&& a->m_ClipState.m_FirstCmdID == b->m_ClipState.m_FirstCmdID
+		&& a->m_ClipState.m_NumCmds == b->m_ClipState.m_NumCmds
+		&& a->m_ClipState.m_Rule == b->m_ClipState.m_Rule
+		&& a->m_SDFBlur == b->m_SDFBlur
+#if VG_CONFIG_POSITION_INT16
+		&& !bx::memCmp(a->m_PosQuant, b->m_PosQuant, sizeof(float) * 3)
+#endif
+		;
+}
+
+inline bool rectsOverlap(const float* a, const float* b)
+{
+	return a[0] < b[2] && b[0] < a[2] && a[1] < b[3] && b[1] < a[3];
+}
+
+// Calculates the canvas space bounding rect (minx, miny, maxx, maxy) of the draw command, clipped
+// to its scissor rect. Commands drawn with a model matrix are given the whole canvas so nothing
+// is ever moved over them.
+static void drawCommandCalcBounds(Context* ctx, const DrawCommand* cmd, float* bounds)
+{
+	if (cmd->m_RetainedDrawID != UINT32_MAX || cmd->m_TransformID != UINT32_MAX) {
+		bounds[0] = 0.0f;
+		bounds[1] = 0.0f;
+		bounds[2] = (float)ctx->m_CanvasWidth;
+		bounds[3] = (float)ctx->m_CanvasHeight;
+		return;
+	}
+
+	const uint32_t numVertices = cmd->m_NumVertices;
+	if (numVertices == 0) {
+		bx::memSet(bounds, 0, sizeof(float) * 4);
+		return;
+	}
+
+	const VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	const pos_t* pos = &vb->m_Vertices[cmd->m_FirstVertexID].m_Pos[0];
+	const uint32_t posStride = sizeof(Vertex) / sizeof(pos_t);
+#else
+	const pos_t* pos = &vb->m_Pos[cmd->m_FirstVertexID << 1];
+	const uint32_t posStride = 2;
+#endif
+
+	float minx = (float)pos[0], miny = (float)pos[1];
+	float maxx = (float)pos[0], maxy = (float)pos[1];
+	for (uint32_t i = 0; i < numVertices; ++i) {
+		minx = bx::min<float>(minx, (float)pos[0]);
+		miny = bx::min<float>(miny, (float)pos[1]);
+		maxx = bx::max<float>(maxx, (float)pos[0]);
+		maxy = bx::max<float>(maxy, (float)pos[1]);
+		pos += posStride;
+	}
+
+#if VG_CONFIG_POSITION_INT16
+	const float invScale = 1.0f / cmd->m_PosQuant[2];
+	minx = minx * invScale + cmd->m_PosQuant[0];
+	miny = miny * invScale + cmd->m_PosQuant[1];
+	maxx = maxx * invScale + cmd->m_PosQuant[0];
+	maxy = maxy * invScale + cmd->m_PosQuant[1];
+#endif
+
+	const uint16_t* scissor = cmd->m_ScissorRect;
+	bounds[0] = bx::max<float>(minx, (float)scissor[0]);
+	bounds[1] = bx::max<float>(miny, (float)scissor[1]);
+	bounds[2] = bx::min<float>(maxx, (float)(scissor[0] + scissor[2]));
+	bounds[3] = bx::min<float>(maxy, (float)(scissor[1] + scissor[3]));
+}
+
+// Groups draw commands into batches. Each draw command is appended to the most recent compatible
+// batch as long as it doesn't overlap any of the batches drawn after it. Batches with more than one
+// command are then turned into a single draw command spanning the vertices of all its commands
+// (they all live in the same vertex buffer, which ContextConfig::m_MaxVBVertices keeps addressable
+// by index_t) with their indices rebased and copied to the end of the index buffer.
+static void mergeDrawCommands(Context* ctx)
+{
+	const uint32_t numDrawCommands = ctx->m_NumDrawCommands;
+	if (numDrawCommands < 2) {
+		return;
+	}
+
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+
+	const uint32_t totalMem = 0
+		+ alignSize(sizeof(float) * 4 * numDrawCommands, 16)   // batch bounds
+		+ alignSize(sizeof(uint32_t) * numDrawCommands, 16)    // batch first command
+		+ alignSize(sizeof(uint32_t) * numDrawCommands, 16)    // batch last command
+		+ alignSize(sizeof(uint32_t) * numDrawCommands, 16)    // next command in batch
+		+ alignSize(sizeof(DrawCommand) * numDrawCommands, 16) // merged draw commands
+		;
+
+	uint8_t* mem = (uint8_t*)bx::alignedAlloc(allocator, totalMem, 16);
+	float* batchBounds = (float*)mem;
+	mem += alignSize(sizeof(float) * 4 * numDrawCommands, 16);
+	uint32_t* batchFirstCmd = (uint32_t*)mem;
+	mem += alignSize(sizeof(uint32_t) * numDrawCommands, 16);
+	uint32_t* batchLastCmd = (uint32_t*)mem;
+	mem += alignSize(sizeof(uint32_t) * numDrawCommands, 16);
+	uint32_t* nextCmd = (uint32_t*)mem;
+	mem += alignSize(sizeof(uint32_t) * numDrawCommands, 16);
+	DrawCommand* mergedCmds = (DrawCommand*)mem;
+
+	const DrawCommand* drawCmds = ctx->m_DrawCommands;
+
+	uint32_t numBatches = 0;
+	bool merged = false;
+	for (uint32_t iCmd = 0; iCmd < numDrawCommands; ++iCmd) {
+		const DrawCommand* cmd = &drawCmds[iCmd];
+		nextCmd[iCmd] = UINT32_MAX;
+
+		float bounds[4];
+		drawCommandCalcBounds(ctx, cmd, bounds);
+
+		uint32_t targetBatch = UINT32_MAX;
+		const uint32_t lastBatch = numBatches > VG_CONFIG_DRAW_COMMAND_MERGE_WINDOW ? numBatches - VG_CONFIG_DRAW_COMMAND_MERGE_WINDOW : 0;
+		for (uint32_t iBatch = numBatches; iBatch > lastBatch; --iBatch) {
+			const uint32_t batchID = iBatch - 1;
+			if (drawCommandsCanMerge(&drawCmds[batchFirstCmd[batchID]], cmd)) {
+				targetBatch = batchID;
+				break;
+			}
+
+			if (rectsOverlap(&batchBounds[batchID * 4], bounds)) {
+				break;
+			}
+		}
+
+		if (targetBatch == UINT32_MAX) {
+			targetBatch = numBatches++;
+			batchFirstCmd[targetBatch] = iCmd;
+			bx::memCopy(&batchBounds[targetBatch * 4], bounds, sizeof(float) * 4);
+		} else {
+			float* bb = &batchBounds[targetBatch * 4];
+			bb[0] = bx::min<float>(bb[0], bounds[0]);
+			bb[1] = bx::min<float>(bb[1], bounds[1]);
+			bb[2] = bx::max<float>(bb[2], bounds[2]);
+			bb[3] = bx::max<float>(bb[3], bounds[3]);
+			nextCmd[batchLastCmd[targetBatch]] = iCmd;
+			merged = true;
+		}
+
+		batchLastCmd[targetBatch] = iCmd;
+	}
+
+	if (merged) {
+		for (uint32_t iBatch = 0; iBatch < numBatches; ++iBatch) {
+			const uint32_t firstCmdID = batchFirstCmd[iBatch];
+			DrawCommand* batchCmd = &mergedCmds[iBatch];
+			bx::memCopy(batchCmd, &drawCmds[firstCmdID], sizeof(DrawCommand));
+			if (nextCmd[firstCmdID] == UINT32_MAX) {
+				continue;
+			}
+
+			uint32_t firstVertexID = UINT32_MAX;
+			uint32_t lastVertexID = 0;
+			uint32_t numIndices = 0;
+			for (uint32_t cmdID = firstCmdID; cmdID != UINT32_MAX; cmdID = nextCmd[cmdID]) {
+				const DrawCommand* cmd = &drawCmds[cmdID];
+				firstVertexID = bx::min<uint32_t>(firstVertexID, cmd->m_FirstVertexID);
+				lastVertexID = bx::max<uint32_t>(lastVertexID, cmd->m_FirstVertexID + cmd->m_NumVertices);
+				numIndices += cmd->m_NumIndices;
+			}
+
+#if !VG_CONFIG_INDEX_UINT32
+			VG_CHECK(lastVertexID - firstVertexID <= UINT16_MAX + 1, "Merged draw command vertex range too large");
+#endif
+
+			const uint32_t firstIndexID = allocIndices(ctx, numIndices);
+			IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+			index_t* dstIndex = &ib->m_Indices[firstIndexID];
+			for (uint32_t cmdID = firstCmdID; cmdID != UINT32_MAX; cmdID = nextCmd[cmdID]) {
+				const DrawCommand* cmd = &drawCmds[cmdID];
+				vgutil::batchTransformDrawIndices(&ib->m_Indices[cmd->m_FirstIndexID], cmd->m_NumIndices, dstIndex, (index_t)(cmd->m_FirstVertexID - firstVertexID));
+				dstIndex += cmd->m_NumIndices;
+			}
+
+			batchCmd->m_FirstVertexID = firstVertexID;
+			batchCmd->m_NumVertices = lastVertexID - firstVertexID;
+			batchCmd->m_FirstIndexID = firstIndexID;
+			batchCmd->m_NumIndices = numIndices;
+		}
+
+		bx::memCopy(ctx->m_DrawCommands, mergedCmds, sizeof(DrawCommand) * numBatches);
+		ctx->m_NumDrawCommands = numBatches;
+	}
+
+	bx::alignedFree(allocator, batchBounds, 16);
+}
+#endif // VG_CONFIG_ENABLE_DRAW_COMMAND_MERGING
+
+static DrawCommand* allocClipCommand(Context* ctx, uint32_t numVertices, uint32_t numIndices)
+{
+	uint32_t vertexBufferID;
+	const uint32_t firstVertexID = allocVertices(ctx, numVertices, &vertexBufferID);
+	const uint32_t firstIndexID = allocIndices(ctx, numIndices);
+
+	const State* state = getState(ctx);
+	const float* scissor = state->m_ScissorRect;
+
+	if (!ctx->m_ForceNewClipCommand && ctx->m_NumClipCommands != 0) {
+		DrawCommand* prevCmd = &ctx->m_ClipCommands[ctx->m_NumClipCommands - 1];
+
+		VG_CHECK(prevCmd->m_VertexBufferID == vertexBufferID, "Cannot merge clip commands with different vertex buffers");
+		VG_CHECK(prevCmd->m_ScissorRect[0] == (uint16_t)scissor[0]
+		      && prevCmd->m_ScissorRect[1] == (uint16_t)scissor[1]
+		      && prevCmd->m_ScissorRect[2] == (uint16_t)scissor[2]
+		      && prevCmd->m_ScissorRect[3] == (uint16_t)scissor[3], "Invalid scissor rect");
+		VG_CHECK(prevCmd->m_Type == DrawCommand::Type::Clip, "Invalid draw command type");
+
+#if VG_CONFIG_POSITION_INT16
+		if (!bx::memCmp(prevCmd->m_PosQuant, ctx->m_PosQuant, sizeof(float) * 3))
+#endif
+		{
+			return prevCmd;
+		}
+	}
+
+	// The new clip command cannot be combined with the previous one. Create a new one.
+	if (ctx->m_NumClipCommands == ctx->m_ClipCommandCapacity) {
+		ctx->m_ClipCommandCapacity = ctx->m_ClipCommandCapacity + 32;
+		ctx->m_ClipCommands = (DrawCommand*)bx::realloc(ctx->m_Allocator, ctx->m_ClipCommands, sizeof(DrawCommand) * ctx->m_ClipCommandCapacity);
+	}
+
+	DrawCommand* cmd = &ctx->m_ClipCommands[ctx->m_NumClipCommands];
+	ctx->m_NumClipCommands++;
+
+	cmd->m_VertexBufferID = vertexBufferID;
+	cmd->m_FirstVertexID = firstVertexID;
+	cmd->m_FirstIndexID = firstIndexID;
+	cmd->m_NumVertices = 0;
+	cmd->m_NumIndices = 0;
+	cmd->m_Type = DrawCommand::Type::Clip;
+	cmd->m_HandleID = UINT16_MAX;
+	cmd->m_RetainedDrawID = UINT32_MAX;
+	cmd->m_TransformID = UINT32_MAX;
+	cmd->m_LayerID = ctx->m_ActiveLayerID;
+	cmd->m_NumStencilIndices = 0;
+	cmd->m_StencilFillRule = FillRule::NonZero;
+	cmd->m_FirstInstanceID = 0;
+	cmd->m_NumInstances = 0;
+	cmd->m_SDFBlur = 0.0f;
+#if VG_CONFIG_POSITION_INT16
+	bx::memCopy(cmd->m_PosQuant, ctx->m_PosQuant, sizeof(float) * 3);
+#endif
+	cmd->m_ScissorRect[0] = (uint16_t)scissor[0];
+	cmd->m_ScissorRect[1] = (uint16_t)scissor[1];
+	cmd->m_ScissorRect[2] = (uint16_t)scissor[2];
+	cmd->m_ScissorRect[3] = (uint16_t)scissor[3];
+	cmd->m_ClipState.m_FirstCmdID = ~0u;
+	cmd->m_ClipState.m_NumCmds = 0;
+
+	ctx->m_ForceNewClipCommand = false;
+
+	return cmd;
+}
+
+static void resetImage(Image* img)
+{
+	img->m_bgfxHandle = BGFX_INVALID_HANDLE;
+	img->m_Width = 0;
+	img->m_Height = 0;
+	img->m_Flags = 0;
+	img->m_Owned = false;
+	img->m_PremultipliedAlpha = false;
+}
+
+static ImageHandle allocImage(Context* ctx)
+{
+	ImageHandle handle = { ctx->m_ImageHandleAlloc->alloc() };
+	if (!isValid(handle)) {
+		return VG_INVALID_HANDLE;
+	}
+
+	if (handle.idx >= ctx->m_ImageCapacity) {
+		const uint32_t oldCapacity = ctx->m_ImageCapacity;
+
+		ctx->m_ImageCapacity = bx::min(bx::max(ctx->m_ImageCapacity + 4, handle.idx + 1), ctx->m_Config.m_MaxImages);
+		ctx->m_Images = (Image*)bx::realloc(ctx->m_Allocator, ctx->m_Images, sizeof(Image) * ctx->m_ImageCapacity);
+		if (!ctx->m_Images) {
+			return VG_INVALID_HANDLE;
+		}
+
+		// Reset all new textures...
+		const uint32_t capacity = ctx->m_ImageCapacity;
+		for (uint32_t i = oldCapacity; i < capacity; ++i) {
+			resetImage(&ctx->m_Images[i]);
+		}
+	}
+
+	VG_CHECK(handle.idx < ctx->m_ImageCapacity, "Allocated invalid image handle");
+	Image* tex = &ctx->m_Images[handle.idx];
+	VG_CHECK(!bgfx::isValid(tex->m_bgfxHandle), "Allocated texture is already in use");
+	resetImage(tex);
+
+	return handle;
+}
+
+static void renderTextQuads(Context* ctx, const TextQuad* quads, uint32_t numQuads, Color color, ImageHandle img, bool distanceField, float distanceFieldBlur)
+{
+	const uint32_t numDrawVertices = numQuads * 4;
+	const uint32_t numDrawIndices = numQuads * 6;
+
+	if (ctx->m_TextVertexCapacity < numDrawVertices) {
+		ctx->m_TextVertices = (float*)bx::alignedRealloc(ctx->m_Allocator, ctx->m_TextVertices, sizeof(float) * 2 * numDrawVertices, 16);
+		ctx->m_TextVertexCapacity = numDrawVertices;
+	}
+
+	const State* state = getState(ctx);
+	const float scale = state->m_FontScale * ctx->m_DevicePixelRatio;
+	const float invscale = 1.0f / scale;
+
+	float mtx[6];
+	mtx[0] = state->m_TransformMtx[0] * invscale;
+	mtx[1] = state->m_TransformMtx[1] * invscale;
+	mtx[2] = state->m_TransformMtx[2] * invscale;
+	mtx[3] = state->m_TransformMtx[3] * invscale;
+	mtx[4] = state->m_TransformMtx[4];
+	mtx[5] = state->m_TransformMtx[5];
+
+	// TODO: Calculate bounding rect of the quads.
+	vgutil::batchTransformTextQuads(&quads->m_Pos[0], numQuads, mtx, ctx->m_TextVertices);
+
+#if VG_CONFIG_POSITION_INT16
+	setPosQuantization(ctx, ctx->m_TextVertices, numDrawVertices, nullptr);
+#endif
+
+	// Distance field text with a different blur cannot be appended to the previous command.
+	const DrawCommand::Type::Enum type = distanceField ? DrawCommand::Type::TextSDF : DrawCommand::Type::Textured;
+	const float sdfBlur = distanceField ? distanceFieldBlur : 0.0f;
+	if (ctx->m_NumDrawCommands != 0 && ctx->m_DrawCommands[ctx->m_NumDrawCommands - 1].m_SDFBlur != sdfBlur) {
+		ctx->m_ForceNewDrawCommand = true;
+	}
+
+	DrawCommand* cmd = allocDrawCommand(ctx, numDrawVertices, numDrawIndices, type, img.idx);
+	cmd->m_SDFBlur = sdfBlur;
+
+	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
+	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+
+	vbWriteVertices(vb, cmd, vbOffset, numDrawVertices, ctx->m_TextVertices, nullptr, nullptr, 0, &color, 1);
+
+#if VG_CONFIG_ENABLE_INTERLEAVED_VERTICES
+	Vertex* dstVertex = &vb->m_Vertices[vbOffset];
+	const TextQuad* q = quads;
+	uint32_t nq = numQuads;
+	while (nq-- > 0) {
+		const uv_t s0 = q->m_TexCoord[0];
+		const uv_t t0 = q->m_TexCoord[1];
+		const uv_t s1 = q->m_TexCoord[2];
+		const uv_t t1 = q->m_TexCoord[3];
+
+		dstVertex[0].m_UV[0] = s0; dstVertex[0].m_UV[1] = t0;
+		dstVertex[1].m_UV[0] = s1; dstVertex[1].m_UV[1] = t0;
+		dstVertex[2].m_UV[0] = s1; dstVertex[2].m_UV[1] = t1;
+		dstVertex[3].m_UV[0] = s0; dstVertex[3].m_UV[1] = t1;
+
+		dstVertex += 4;
+		++q;
+	}
+#else
+	uv_t* dstUV = &vb->m_UV[vbOffset << 1];
+	const TextQuad* q = quads;
+	uint32_t nq = numQuads;
+	while (nq-- > 0) {
+		const uv_t s0 = q->m_TexCoord[0];
+		const uv_t t0 = q->m_TexCoord[1];
+		const uv_t s1 = q->m_TexCoord[2];
+		const uv_t t1 = q->m_TexCoord[3];
+
+		dstUV[0] = s0; dstUV[1] = t0;
+		dstUV[2] = s1; dstUV[3] = t0;
+		dstUV[4] = s1; dstUV[5] = t1;
+		dstUV[6] = s0; dstUV[7] = t1;
+
+		dstUV += 8;
+		++q;
+	}
+#endif
+
+	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
+	index_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
+	vgutil::genQuadIndices_unaligned(dstIndex, numQuads, (index_t)cmd->m_NumVertices);
+
+	cmd->m_NumVertices += numDrawVertices;
+	cmd->m_NumIndices += numDrawIndices;
+}
+
+static CommandListHandle allocCommandList(Context* ctx)
+{
+	CommandListHandle handle = { ctx->m_CmdListHandleAlloc->alloc() };
+	if (!isValid(handle)) {
+		return VG_INVALID_HANDLE;
+	}
+
+	VG_CHECK(handle.idx < ctx->m_Config.m_MaxCommandLists, "Allocated invalid command list handle");
+	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+	const uint32_t generation = cl->m_BoundsGeneration;
+	const uint32_t revision = cl->m_Revision;
+	bx::memSet(cl, 0, sizeof(CommandList));
+	cl->m_BoundsGeneration = generation;
+	cl->m_Revision = revision;
+
+	return handle;
+}
+
+static inline bool isCommandListHandleValid(Context* ctx, CommandListHandle handle)
+{
+	return isValid(handle) && ctx->m_CmdListHandleAlloc->isValid(handle.idx);
+}
+
+static inline bool isLayerHandleValid(Context* ctx, LayerHandle handle)
+{
+	return isValid(handle) && ctx->m_LayerHandleAlloc->isValid(handle.idx);
+}
+
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+static CommandListCache* allocCommandListCache(Context* ctx)
+{
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+
+	const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+	CommandListCache* lods = (CommandListCache*)bx::alloc(allocator, sizeof(CommandListCache) * numLODs);
+	bx::memSet(lods, 0, sizeof(CommandListCache) * numLODs);
+	for (uint32_t i = 0; i < numLODs; ++i) {
+		CommandListCache* cache = &lods[i];
+		cache->m_GPUPosBufferHandle = BGFX_INVALID_HANDLE;
+		cache->m_GPUUVBufferHandle = BGFX_INVALID_HANDLE;
+		cache->m_GPUColorBufferHandle = BGFX_INVALID_HANDLE;
+		cache->m_GPUIndexBufferHandle = BGFX_INVALID_HANDLE;
+	}
+
+	return lods;
+}
 
-	cmd->m_NumVertices += numVertices;
-	cmd->m_NumIndices += numIndices;
+static void freeCommandListCache(Context* ctx, CommandListCache* lods)
+{
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+
+	const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+	for (uint32_t i = 0; i < numLODs; ++i) {
+		clCacheReset(ctx, &lods[i]);
+	}
+	bx::free(allocator, lods);
 }
+#endif
 
-static void ctxText(Context* ctx, const TextConfig& cfg, float x, float y, const char* str, const char* end)
+static uint8_t* clAllocCommand(Context* ctx, CommandList* cl, CommandType::Enum cmdType, uint32_t dataSize)
 {
-	const State* state = getState(ctx);
-	const float scale = state->m_FontScale * ctx->m_DevicePixelRatio;
+	const uint32_t alignedDataSize = alignSize(dataSize, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
+	const uint32_t totalSize = 0
+		+ kAlignedCommandHeaderSize
+		+ alignedDataSize;
 
-	const uint32_t c = colorSetAlpha(cfg.m_Color, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(cfg.m_Color)));
-	if (colorGetAlpha(c) == 0) {
-		return;
+	const uint32_t pos = cl->m_CommandBufferPos;
+	VG_CHECK(isAligned(pos, VG_CONFIG_COMMAND_LIST_ALIGNMENT), "Unaligned command buffer position");
+
+	// NOTE: Only the command list and its recording shard are touched here so
+	// command lists from different shards can be recorded concurrently.
+	RecordingShard* shard = &ctx->m_RecordingShards[cl->m_ShardID];
+	if (pos + totalSize > cl->m_CommandBufferCapacity) {
+		const uint32_t capacityDelta = bx::max<uint32_t>(totalSize, 256);
+		cl->m_CommandBufferCapacity += capacityDelta;
+		cl->m_CommandBuffer = (uint8_t*)bx::alignedRealloc(shard->m_Allocator, cl->m_CommandBuffer, cl->m_CommandBufferCapacity, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
+
+		shard->m_Stats.m_CmdListMemoryTotal += capacityDelta;
 	}
 
-	const float scaledFontSize = cfg.m_FontSize * scale;
-	const uint32_t len = end
-		? (uint32_t)(end - str)
-		: bx::strLen(str)
-		;
+	uint8_t* ptr = &cl->m_CommandBuffer[pos];
+	cl->m_CommandBufferPos += totalSize;
+	cl->m_Revision++;
+	shard->m_Stats.m_CmdListMemoryUsed += totalSize;
 
-	const TextConfig newCfg = makeTextConfig(ctx, cfg.m_FontHandle, scaledFontSize, cfg.m_Alignment, c, cfg.m_Blur * scale, cfg.m_Spacing * scale);
+	CommandHeader* hdr = (CommandHeader*)ptr;
+	ptr += kAlignedCommandHeaderSize;
 
-	TextMesh mesh;
-	bx::memSet(&mesh, 0, sizeof(TextMesh));
-	if (!fsText(ctx->m_FontSystem, ctx, newCfg, str, len, TextFlags::BuildBitmaps, &mesh)) {
-		return;
+	hdr->m_Type = cmdType;
+	hdr->m_Size = alignedDataSize;
+	hdr->m_Flags = 0;
+
+	if (cmdType >= CommandType::FirstStrokerCommand && cmdType <= CommandType::LastStrokerCommand) {
+		++cl->m_NumStrokerCommands;
 	}
 
-	ctxPushState(ctx);
-	ctxTransformTranslate(ctx, x + mesh.m_Alignment[0] / scale, y + mesh.m_Alignment[1] / scale);
-	renderTextQuads(ctx, mesh.m_Quads, mesh.m_Size, newCfg.m_Color, fsGetFontAtlasImage(ctx->m_FontSystem));
-	ctxPopState(ctx);
+	return ptr;
 }
 
-static void ctxTextBox(Context* ctx, const TextConfig& cfg, float x, float y, float breakWidth, const char* str, const char* end, uint32_t textBreakFlags)
+static uint32_t clStoreString(Context* ctx, CommandList* cl, const char* str, uint32_t len)
 {
-	end = end
-		? end
-		: str + bx::strLen(str)
-		;
+	if (cl->m_StringBufferPos + len > cl->m_StringBufferCapacity) {
+		cl->m_StringBufferCapacity += bx::max<uint32_t>(len, 128);
+		cl->m_StringBuffer = (char*)bx::realloc(ctx->m_RecordingShards[cl->m_ShardID].m_Allocator, cl->m_StringBuffer, cl->m_StringBufferCapacity);
+	}
 
-	const float lineHeight = fsGetLineHeight(ctx->m_FontSystem, cfg);
-	const TextAlignHor::Enum halign = (TextAlignHor::Enum)((cfg.m_Alignment & VG_TEXT_ALIGN_HOR_Msk) >> VG_TEXT_ALIGN_HOR_Pos);
-	const TextAlignVer::Enum valign = (TextAlignVer::Enum)((cfg.m_Alignment & VG_TEXT_ALIGN_VER_Msk) >> VG_TEXT_ALIGN_VER_Pos);
+	const uint32_t offset = cl->m_StringBufferPos;
+	bx::memCopy(cl->m_StringBuffer + offset, str, len);
+	cl->m_StringBufferPos += len;
+	return offset;
+}
 
-	const TextConfig newCfg = makeTextConfig(ctx, cfg.m_FontHandle, cfg.m_FontSize, VG_TEXT_ALIGN(vg::TextAlignHor::Left, valign), cfg.m_Color, cfg.m_Blur, cfg.m_Spacing);
+static CommandHeader* clFindStrokerCommand(CommandList* cl, uint32_t cmdID)
+{
+	uint32_t nextCmdID = 0;
 
-	TextRow rows[4];
-	uint32_t numRows = 0;
-	while ((numRows = fsTextBreakLines(ctx->m_FontSystem, cfg, str, end, breakWidth, &rows[0], BX_COUNTOF(rows), textBreakFlags)) != 0) {
-		for (uint32_t i = 0; i < numRows; ++i) {
-			if (halign == TextAlignHor::Left) {
-				ctxText(ctx, newCfg, x, y, rows[i].start, rows[i].end);
-			} else if (halign == TextAlignHor::Center) {
-				ctxText(ctx, newCfg, x + (breakWidth - rows[i].width) * 0.5f, y, rows[i].start, rows[i].end);
-			} else if (halign == TextAlignHor::Right) {
-				ctxText(ctx, newCfg, x + breakWidth - rows[i].width, y, rows[i].start, rows[i].end);
+	uint8_t* cmd = cl->m_CommandBuffer;
+	const uint8_t* cmdListEnd = cl->m_CommandBuffer + cl->m_CommandBufferPos;
+	while (cmd < cmdListEnd) {
+		CommandHeader* cmdHeader = (CommandHeader*)cmd;
+		if (cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand) {
+			if (nextCmdID == cmdID) {
+				return cmdHeader;
 			}
-
-			y += lineHeight;
+			++nextCmdID;
 		}
 
-		str = rows[numRows - 1].next;
+		cmd += kAlignedCommandHeaderSize + cmdHeader->m_Size;
 	}
+
+	return nullptr;
 }
 
-static void ctxSubmitCommandList(Context* ctx, CommandListHandle handle)
+static void clInvalidateCommands(Context* ctx, CommandList* cl, uint32_t firstCmdID, uint32_t lastCmdID)
 {
-	VG_CHECK(isCommandListHandleValid(ctx, handle), "Invalid command list handle");
-	CommandList* cl = &ctx->m_CmdLists[handle.idx];
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	clCacheInvalidateCommands(ctx, cl, firstCmdID, lastCmdID);
+#else
+	BX_UNUSED(ctx, firstCmdID, lastCmdID);
+#endif
 
-	if (ctx->m_SubmitCmdListRecursionDepth >= ctx->m_Config.m_MaxCommandListDepth) {
-		VG_CHECK(false, "SubmitCommandList recursion depth limit reached.");
-		return;
+	if (cl->m_Prepared) {
+		cl->m_Prepared->m_IsValid = false;
 	}
-	++ctx->m_SubmitCmdListRecursionDepth;
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	CommandListCache* clCache = clGetCache(ctx, cl);
-	if(clCache) {
-		const State* state = getState(ctx);
 
-		const float cachedScale = clCache->m_AvgScale;
-		const float stateScale = state->m_AvgScale;
-		if (cachedScale == stateScale) {
-			clCacheRender(ctx, cl);
-			--ctx->m_SubmitCmdListRecursionDepth;
-			return;
-		} else {
-			clCacheReset(ctx, clCache);
+	cl->m_Revision++;
+}
 
-			clCache->m_AvgScale = stateScale;
-		}
+static bool clPrepare(Context* ctx, RecordingShard* shard, PreparedCommandList* prepared, const CommandList* cl, uint32_t depth)
+{
+	// NOTE: This should follow ctxSubmitCommandList() step by step, except that only the commands
+	// affecting tessellation are executed. Every stroker command gets a PreparedCommand (even
+	// those which end up culled during submission) so both sides can match them by index.
+#if VG_CONFIG_ENABLE_SHAPE_CACHING
+	if ((cl->m_Flags & CommandListFlags::Cacheable) != 0) {
+		return false;
 	}
-#else
-	CommandListCache* clCache = nullptr;
 #endif
 
-	// Don't cull commands during caching.
-	const uint32_t clFlags = cl->m_Flags;
-	const bool cullCmds = !clCache && ((clFlags & CommandListFlags::AllowCommandCulling) != 0);
-
-	const uint16_t firstGradientID = (uint16_t)ctx->m_NextGradientID;
-	const uint16_t firstImagePatternID = (uint16_t)ctx->m_NextImagePatternID;
-	VG_CHECK(firstGradientID + cl->m_NumGradients <= ctx->m_Config.m_MaxGradients, "Not enough free gradients for command list. Increase ContextConfig::m_MaxGradients");
-	VG_CHECK(firstImagePatternID + cl->m_NumImagePatterns <= ctx->m_Config.m_MaxImagePatterns, "Not enough free image patterns for command list. Increase ContextConfig::m_MaxImagePatterns");
-
 	const uint8_t* cmd = cl->m_CommandBuffer;
 	const uint8_t* cmdListEnd = cl->m_CommandBuffer + cl->m_CommandBufferPos;
 	if (cmd == cmdListEnd) {
-		--ctx->m_SubmitCmdListRecursionDepth;
-		return;
+		return true;
 	}
 
-	const char* stringBuffer = cl->m_StringBuffer;
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	pushCommandListCache(ctx, clCache);
-#endif
+	Tessellator* tess = &shard->m_Tessellator;
+	const float canvasWidth = (float)ctx->m_CanvasWidth;
+	const float canvasHeight = (float)ctx->m_CanvasHeight;
 
-	bool skipCmds = false;
 #if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
-	ctxPushState(ctx);
+	VG_CHECK(shard->m_StateStackTop < (uint32_t)(ctx->m_Config.m_MaxStateStackSize - 1), "State stack overflow");
+	bx::memCopy(&shard->m_StateStack[shard->m_StateStackTop + 1], &shard->m_StateStack[shard->m_StateStackTop], sizeof(State));
+	++shard->m_StateStackTop;
 #endif
 
+	// Prepared meshes are only used when the list is submitted with an identity transform
+	// (see clCanUsePrepared()) so paths outside the canvas never become visible.
+	const float canvasRect[4] = { 0.0f, 0.0f, (float)ctx->m_CanvasWidth, (float)ctx->m_CanvasHeight };
+
 	while (cmd < cmdListEnd) {
 		const CommandHeader* cmdHeader = (CommandHeader*)cmd;
 		cmd += kAlignedCommandHeaderSize;
 
 		const uint8_t* nextCmd = cmd + cmdHeader->m_Size;
+		State* state = &shard->m_StateStack[shard->m_StateStackTop];
 
-		if (skipCmds && cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand) {
-			cmd = nextCmd;
-			continue;
+		const bool isStrokerCmd = cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand;
+		if (isStrokerCmd) {
+			if (prepared->m_NumCommands + 1 > prepared->m_CommandCapacity) {
+				prepared->m_CommandCapacity += 32;
+				prepared->m_Commands = (PreparedCommand*)bx::realloc(prepared->m_Allocator, prepared->m_Commands, sizeof(PreparedCommand) * prepared->m_CommandCapacity);
+			}
+
+			PreparedCommand* preparedCmd = &prepared->m_Commands[prepared->m_NumCommands++];
+			preparedCmd->m_FirstMeshID = prepared->m_NumMeshes;
+			preparedCmd->m_NumMeshes = 0;
+
+			if ((cmdHeader->m_Flags & CommandFlags::Hidden) != 0) {
+				cmd = nextCmd;
+				continue;
+			}
 		}
 
 		switch (cmdHeader->m_Type) {
 		case CommandType::BeginPath: {
-			ctxBeginPath(ctx);
+			tessBeginPath(tess, state->m_AvgScale, ctx->m_TesselationTolerance, ctx->m_FringeWidth);
 		} break;
 		case CommandType::ClosePath: {
-			ctxClosePath(ctx);
+			pathClose(tess->m_Path);
 		} break;
 		case CommandType::MoveTo: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 2;
-			ctxMoveTo(ctx, coords[0], coords[1]);
+			pathMoveTo(tess->m_Path, coords[0], coords[1]);
 		} break;
 		case CommandType::LineTo: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 2;
-			ctxLineTo(ctx, coords[0], coords[1]);
+			pathLineTo(tess->m_Path, coords[0], coords[1]);
 		} break;
 		case CommandType::CubicTo: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 6;
-			ctxCubicTo(ctx, coords[0], coords[1], coords[2], coords[3], coords[4], coords[5]);
+			pathCubicTo(tess->m_Path, coords[0], coords[1], coords[2], coords[3], coords[4], coords[5]);
 		} break;
 		case CommandType::QuadraticTo: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			ctxQuadraticTo(ctx, coords[0], coords[1], coords[2], coords[3]);
+			pathQuadraticTo(tess->m_Path, coords[0], coords[1], coords[2], coords[3]);
 		} break;
 		case CommandType::Arc: {
 			const float* coords = (float*)cmd;
 			cmd += sizeof(float) * 5;
 			const Winding::Enum dir = CMD_READ(cmd, Winding::Enum);
-			ctxArc(ctx, coords[0], coords[1], coords[2], coords[3], coords[4], dir);
+			pathArc(tess->m_Path, coords[0], coords[1], coords[2], coords[3], coords[4], dir);
 		} break;
 		case CommandType::ArcTo: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 5;
-			ctxArcTo(ctx, coords[0], coords[1], coords[2], coords[3], coords[4]);
+			pathArcTo(tess->m_Path, coords[0], coords[1], coords[2], coords[3], coords[4]);
 		} break;
 		case CommandType::Rect: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			ctxRect(ctx, coords[0], coords[1], coords[2], coords[3]);
+			pathRect(tess->m_Path, coords[0], coords[1], coords[2], coords[3]);
 		} break;
 		case CommandType::RoundedRect: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 5;
-			ctxRoundedRect(ctx, coords[0], coords[1], coords[2], coords[3], coords[4]);
+			pathRoundedRect(tess->m_Path, coords[0], coords[1], coords[2], coords[3], coords[4]);
 		} break;
 		case CommandType::RoundedRectVarying: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 8;
-			ctxRoundedRectVarying(ctx, coords[0], coords[1], coords[2], coords[3], coords[4], coords[5], coords[6], coords[7]);
+			pathRoundedRectVarying(tess->m_Path, coords[0], coords[1], coords[2], coords[3], coords[4], coords[5], coords[6], coords[7]);
 		} break;
 		case CommandType::Circle: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 3;
-			ctxCircle(ctx, coords[0], coords[1], coords[2]);
+			pathCircle(tess->m_Path, coords[0], coords[1], coords[2]);
 		} break;
 		case CommandType::Ellipse: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			ctxEllipse(ctx, coords[0], coords[1], coords[2], coords[3]);
-		} break;
-		case CommandType::Polyline: {
-			const uint32_t numPoints = CMD_READ(cmd, uint32_t);
-			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 2 * numPoints;
-			ctxPolyline(ctx, coords, numPoints);
-		} break;
-		case CommandType::FillPathColor: {
-			const uint32_t flags = CMD_READ(cmd, uint32_t);
-			const Color color = CMD_READ(cmd, Color);
-
-			ctxFillPathColor(ctx, color, flags);
-		} break;
-		case CommandType::FillPathGradient: {
-			const uint32_t flags = CMD_READ(cmd, uint32_t);
-			const uint16_t gradientHandle = CMD_READ(cmd, uint16_t);
-			const uint16_t gradientFlags = CMD_READ(cmd, uint16_t);
-
-			const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
-			ctxFillPathGradient(ctx, gradient, flags);
-		} break;
-		case CommandType::FillPathImagePattern: {
-			const uint32_t flags = CMD_READ(cmd, uint32_t);
-			const Color color = CMD_READ(cmd, Color);
-			const uint16_t imgPatternHandle = CMD_READ(cmd, uint16_t);
-			const uint16_t imgPatternFlags = CMD_READ(cmd, uint16_t);
-
-			const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
-			ctxFillPathImagePattern(ctx, imgPattern, color, flags);
-		} break;
-		case CommandType::StrokePathColor: {
-			const float width = CMD_READ(cmd, float);
-			const uint32_t flags = CMD_READ(cmd, uint32_t);
-			const Color color = CMD_READ(cmd, Color);
-
-			ctxStrokePathColor(ctx, color, width, flags);
-		} break;
-		case CommandType::StrokePathGradient: {
-			const float width = CMD_READ(cmd, float);
-			const uint32_t flags = CMD_READ(cmd, uint32_t);
-			const uint16_t gradientHandle = CMD_READ(cmd, uint16_t);
-			const uint16_t gradientFlags = CMD_READ(cmd, uint16_t);
-
-			const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
-			ctxStrokePathGradient(ctx, gradient, width, flags);
-		} break;
-		case CommandType::StrokePathImagePattern: {
-			const float width = CMD_READ(cmd, float);
-			const uint32_t flags = CMD_READ(cmd, uint32_t);
-			const Color color = CMD_READ(cmd, Color);
-			const uint16_t imgPatternHandle = CMD_READ(cmd, uint16_t);
-			const uint16_t imgPatternFlags = CMD_READ(cmd, uint16_t);
-
-			const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
-			ctxStrokePathImagePattern(ctx, imgPattern, color, width, flags);
-		} break;
-		case CommandType::IndexedTriList: {
-			const uint32_t numVertices = CMD_READ(cmd, uint32_t);
-			const float* positions = (float*)cmd;
-			cmd += sizeof(float) * 2 * numVertices;
-			const uint32_t numUVs = CMD_READ(cmd, uint32_t);
-			const uv_t* uv = (uv_t*)cmd;
-			cmd += sizeof(uv_t) * 2 * numUVs;
-			const uint32_t numColors = CMD_READ(cmd, uint32_t);
-			const Color* colors = (Color*)cmd;
-			cmd += sizeof(Color) * numColors;
-			const uint32_t numIndices = CMD_READ(cmd, uint32_t);
-			const uint16_t* indices = (uint16_t*)cmd;
-			cmd += sizeof(uint16_t) * numIndices;
-			const uint16_t imgHandle = CMD_READ(cmd, uint16_t);
-
-			ctxIndexedTriList(ctx, positions, numUVs ? uv : nullptr, numVertices, colors, numColors, indices, numIndices, { imgHandle });
-		} break;
-		case CommandType::CreateLinearGradient: {
-			const float* params = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			const Color* colors = (Color*)cmd;
-			cmd += sizeof(Color) * 2;
-			ctxCreateLinearGradient(ctx, params[0], params[1], params[2], params[3], colors[0], colors[1]);
-		} break;
-		case CommandType::CreateBoxGradient: {
-			const float* params = (float*)cmd;
-			cmd += sizeof(float) * 6;
-			const Color* colors = (Color*)cmd;
-			cmd += sizeof(Color) * 2;
-			ctxCreateBoxGradient(ctx, params[0], params[1], params[2], params[3], params[4], params[5], colors[0], colors[1]);
-		} break;
-		case CommandType::CreateRadialGradient: {
-			const float* params = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			const Color* colors = (Color*)cmd;
-			cmd += sizeof(Color) * 2;
-			ctxCreateRadialGradient(ctx, params[0], params[1], params[2], params[3], colors[0], colors[1]);
-		} break;
-		case CommandType::CreateImagePattern: {
-			const float* params = (float*)cmd;
-			cmd += sizeof(float) * 5;
-			const ImageHandle img = CMD_READ(cmd, ImageHandle);
-			ctxCreateImagePattern(ctx, params[0], params[1], params[2], params[3], params[4], img);
-		} break;
-		case CommandType::Text: {
-			const TextConfig* txtCfg = (TextConfig*)cmd;
-			cmd += sizeof(TextConfig);
-			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 2;
-			const uint32_t stringOffset = CMD_READ(cmd, uint32_t);
-			const uint32_t stringLen = CMD_READ(cmd, uint32_t);
-			VG_CHECK(stringOffset < cl->m_StringBufferPos, "Invalid string offset");
-			VG_CHECK(stringOffset + stringLen <= cl->m_StringBufferPos, "Invalid string length");
-
-			const char* str = stringBuffer + stringOffset;
-			const char* end = str + stringLen;
-			ctxText(ctx, *txtCfg, coords[0], coords[1], str, end);
+			pathEllipse(tess->m_Path, coords[0], coords[1], coords[2], coords[3]);
 		} break;
-		case CommandType::TextBox: {
-			const TextConfig* txtCfg = (TextConfig*)cmd;
-			cmd += sizeof(TextConfig);
-			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 3; // x, y, breakWidth
-			const uint32_t stringOffset = CMD_READ(cmd, uint32_t);
-			const uint32_t stringLen = CMD_READ(cmd, uint32_t);
-			const uint32_t textboxFlags = CMD_READ(cmd, uint32_t);
-			VG_CHECK(stringOffset < cl->m_StringBufferPos, "Invalid string offset");
-			VG_CHECK(stringOffset + stringLen <= cl->m_StringBufferPos, "Invalid string length");
-
-			const char* str = stringBuffer + stringOffset;
-			const char* end = str + stringLen;
-			ctxTextBox(ctx, *txtCfg, coords[0], coords[1], coords[2], str, end, textboxFlags);
+		case CommandType::Polyline: {
+			const uint32_t numPoints = CMD_READ(cmd, uint32_t);
+			const float* coords = (float*)cmd;
+			pathPolyline(tess->m_Path, coords, numPoints);
 		} break;
-		case CommandType::ResetScissor: {
-			ctxResetScissor(ctx);
-			skipCmds = false;
+		case CommandType::FillPathColor: {
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+			if (shard->m_RecordClipCommands || tessIsPathVisible(tess, state->m_TransformMtx, canvasRect, ctx->m_FringeWidth)) {
+				tessFillPath(tess, state, DrawCommand::Type::Textured, color, flags, shard->m_RecordClipCommands, false, preparedMeshCallback, prepared);
+			}
 		} break;
-		case CommandType::SetScissor: {
-			const float* rect = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			ctxSetScissor(ctx, rect[0], rect[1], rect[2], rect[3]);
-
-			if (cullCmds) {
-				const State* state = getState(ctx);
-				const float* scissorRect = &state->m_ScissorRect[0];
-				skipCmds = (scissorRect[2] < 1.0f) || (scissorRect[3] < 1.0f);
+		case CommandType::FillPathGradient: {
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			if (shard->m_RecordClipCommands || tessIsPathVisible(tess, state->m_TransformMtx, canvasRect, ctx->m_FringeWidth)) {
+				tessFillPath(tess, state, DrawCommand::Type::ColorGradient, Colors::Black, flags, shard->m_RecordClipCommands, false, preparedMeshCallback, prepared);
 			}
 		} break;
-		case CommandType::IntersectScissor: {
-			const float* rect = (float*)cmd;
-			cmd += sizeof(float) * 4;
-
-			const bool zeroRect = !ctxIntersectScissor(ctx, rect[0], rect[1], rect[2], rect[3]);
-			if (cullCmds) {
-				skipCmds = zeroRect;
+		case CommandType::FillPathImagePattern: {
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+			if (shard->m_RecordClipCommands || tessIsPathVisible(tess, state->m_TransformMtx, canvasRect, ctx->m_FringeWidth)) {
+				tessFillPath(tess, state, DrawCommand::Type::ImagePattern, color, flags, shard->m_RecordClipCommands, false, preparedMeshCallback, prepared);
+			}
+		} break;
+		case CommandType::StrokePathColor: {
+			const float width = CMD_READ(cmd, float);
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+			if (shard->m_RecordClipCommands || tessIsPathVisible(tess, state->m_TransformMtx, canvasRect, tessCalcStrokeMargin(state, ctx->m_FringeWidth, width, flags))) {
+				tessStrokePath(tess, state, ctx->m_FringeWidth, DrawCommand::Type::Textured, color, width, flags, shard->m_RecordClipCommands, false, preparedMeshCallback, prepared);
+			}
+		} break;
+		case CommandType::StrokePathGradient: {
+			const float width = CMD_READ(cmd, float);
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			if (shard->m_RecordClipCommands || tessIsPathVisible(tess, state->m_TransformMtx, canvasRect, tessCalcStrokeMargin(state, ctx->m_FringeWidth, width, flags))) {
+				tessStrokePath(tess, state, ctx->m_FringeWidth, DrawCommand::Type::ColorGradient, Colors::Black, width, flags, shard->m_RecordClipCommands, false, preparedMeshCallback, prepared);
+			}
+		} break;
+		case CommandType::StrokePathImagePattern: {
+			const float width = CMD_READ(cmd, float);
+			const uint32_t flags = CMD_READ(cmd, uint32_t);
+			const Color color = CMD_READ(cmd, Color);
+			if (shard->m_RecordClipCommands || tessIsPathVisible(tess, state->m_TransformMtx, canvasRect, tessCalcStrokeMargin(state, ctx->m_FringeWidth, width, flags))) {
+				tessStrokePath(tess, state, ctx->m_FringeWidth, DrawCommand::Type::ImagePattern, color, width, flags, shard->m_RecordClipCommands, false, preparedMeshCallback, prepared);
 			}
 		} break;
+		case CommandType::BeginClip: {
+			shard->m_RecordClipCommands = true;
+		} break;
+		case CommandType::EndClip: {
+			shard->m_RecordClipCommands = false;
+		} break;
 		case CommandType::PushState: {
-			ctxPushState(ctx);
+			VG_CHECK(shard->m_StateStackTop < (uint32_t)(ctx->m_Config.m_MaxStateStackSize - 1), "State stack overflow");
+			bx::memCopy(&shard->m_StateStack[shard->m_StateStackTop + 1], state, sizeof(State));
+			++shard->m_StateStackTop;
 		} break;
 		case CommandType::PopState: {
-			ctxPopState(ctx);
-			if (cullCmds) {
-				const State* state = getState(ctx);
-				const float* scissorRect = &state->m_ScissorRect[0];
-				skipCmds = (scissorRect[2] < 1.0f) || (scissorRect[3] < 1.0f);
-			}
+			VG_CHECK(shard->m_StateStackTop > 0, "State stack underflow");
+			--shard->m_StateStackTop;
 		} break;
 		case CommandType::TransformIdentity: {
-			ctxTransformIdentity(ctx);
+			stateTransformIdentity(state);
 		} break;
 		case CommandType::TransformRotate: {
 			const float ang_rad = CMD_READ(cmd, float);
-			ctxTransformRotate(ctx, ang_rad);
+			stateTransformRotate(state, ang_rad);
 		} break;
 		case CommandType::TransformTranslate: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 2;
-			ctxTransformTranslate(ctx, coords[0], coords[1]);
+			stateTransformTranslate(state, coords[0], coords[1]);
 		} break;
 		case CommandType::TransformScale: {
 			const float* coords = (float*)cmd;
-			cmd += sizeof(float) * 2;
-			ctxTransformScale(ctx, coords[0], coords[1]);
+			stateTransformScale(state, coords[0], coords[1]);
 		} break;
 		case CommandType::TransformMult: {
 			const float* mtx = (float*)cmd;
 			cmd += sizeof(float) * 6;
 			const TransformOrder::Enum order = CMD_READ(cmd, TransformOrder::Enum);
-			ctxTransformMult(ctx, mtx, order);
+			stateTransformMult(state, mtx, order);
 		} break;
 		case CommandType::SetViewBox: {
 			const float* viewBox = (float*)cmd;
-			cmd += sizeof(float) * 4;
-			ctxSetViewBox(ctx, viewBox[0], viewBox[1], viewBox[2], viewBox[3]);
-		} break;
-		case CommandType::BeginClip: {
-			const ClipRule::Enum rule = CMD_READ(cmd, ClipRule::Enum);
-			ctxBeginClip(ctx, rule);
+			stateSetViewBox(state, canvasWidth, canvasHeight, viewBox[0], viewBox[1], viewBox[2], viewBox[3]);
 		} break;
-		case CommandType::EndClip: {
-			ctxEndClip(ctx);
-		} break;
-		case CommandType::ResetClip: {
-			ctxResetClip(ctx);
+		case CommandType::BeginLayer:
+		case CommandType::EndLayer: {
+			// Layers change the canvas size and their content might be discarded at submission time.
+			return false;
 		} break;
 		case CommandType::SubmitCommandList: {
 			const uint16_t cmdListID = CMD_READ(cmd, uint16_t);
 			const CommandListHandle cmdListHandle = { cmdListID };
 
-			if (isCommandListHandleValid(ctx, cmdListHandle)) {
-				ctxSubmitCommandList(ctx, cmdListHandle);
+			clPreparedAddChild(ctx, prepared, cmdListHandle);
+			if (isCommandListHandleValid(ctx, cmdListHandle) && depth < ctx->m_Config.m_MaxCommandListDepth) {
+				if (!clPrepare(ctx, shard, prepared, &ctx->m_CmdLists[cmdListID], depth + 1)) {
+					return false;
+				}
 			}
 		} break;
 		default: {
-			VG_CHECK(false, "Unknown command");
+			// Scissor, gradient, image pattern, text and indexed triangle list commands don't
+			// affect the generated meshes.
 		} break;
 		}
 
+		if (isStrokerCmd) {
+			PreparedCommand* preparedCmd = &prepared->m_Commands[prepared->m_NumCommands - 1];
+			preparedCmd->m_NumMeshes = prepared->m_NumMeshes - preparedCmd->m_FirstMeshID;
+		}
+
 		cmd = nextCmd;
 	}
 
 #if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
-	ctxPopState(ctx);
-	ctxResetClip(ctx);
-#endif
-
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-	popCommandListCache(ctx);
+	VG_CHECK(shard->m_StateStackTop > 0, "State stack underflow");
+	--shard->m_StateStackTop;
 #endif
 
-	--ctx->m_SubmitCmdListRecursionDepth;
-}
-
-// Internal
-static State* getState(Context* ctx)
-{
-	const uint32_t top = ctx->m_StateStackTop;
-	return &ctx->m_StateStack[top];
-}
-
-static void updateState(State* state)
-{
-	const float* stateTransform = state->m_TransformMtx;
-
-	const float sx = bx::sqrt(stateTransform[0] * stateTransform[0] + stateTransform[2] * stateTransform[2]);
-	const float sy = bx::sqrt(stateTransform[1] * stateTransform[1] + stateTransform[3] * stateTransform[3]);
-	const float avgScale = (sx + sy) * 0.5f;
-
-	state->m_AvgScale = avgScale;
-
-	const float quantFactor = 0.1f;
-	const float quantScale = (bx::floor((avgScale / quantFactor) + 0.5f)) * quantFactor;
-	state->m_FontScale = quantScale;
+	return true;
 }
 
-static float* allocTransformedVertices(Context* ctx, uint32_t numVertices)
+static bool clCanUsePrepared(Context* ctx, const CommandList* cl)
 {
-	if (numVertices > ctx->m_TransformedVertexCapacity) {
-		bx::AllocatorI* allocator = ctx->m_Allocator;
-		ctx->m_TransformedVertices = (float*)bx::alignedRealloc(allocator, ctx->m_TransformedVertices, sizeof(float) * 2 * numVertices, 16);
-		ctx->m_TransformedVertexCapacity = numVertices;
-	}
-
-	return ctx->m_TransformedVertices;
-}
+	static const float kIdentityMtx[6] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
 
-static const float* transformPath(Context* ctx)
-{
-	if (ctx->m_PathTransformed) {
-		return ctx->m_TransformedVertices;
+	const PreparedCommandList* prepared = cl->m_Prepared;
+	if (!prepared || !prepared->m_IsValid) {
+		return false;
 	}
 
-	Path* path = ctx->m_Path;
-
-	const uint32_t numPathVertices = pathGetNumVertices(path);
-	float* transformedVertices = allocTransformedVertices(ctx, numPathVertices);
-
-	const State* state = getState(ctx);
-	const float* stateTransform = state->m_TransformMtx;
-	const float* pathVertices = pathGetVertices(path);
-	vgutil::batchTransformPositions(pathVertices, numPathVertices, transformedVertices, stateTransform);
-	ctx->m_PathTransformed = true;
-
-	return transformedVertices;
-}
-
-static VertexBuffer* allocVertexBuffer(Context* ctx)
-{
-	if (ctx->m_NumVertexBuffers + 1 > ctx->m_VertexBufferCapacity) {
-		ctx->m_VertexBufferCapacity++;
-		ctx->m_VertexBuffers = (VertexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_VertexBuffers, sizeof(VertexBuffer) * ctx->m_VertexBufferCapacity);
-		ctx->m_GPUVertexBuffers = (GPUVertexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_GPUVertexBuffers, sizeof(GPUVertexBuffer) * ctx->m_VertexBufferCapacity);
-
-		GPUVertexBuffer* gpuvb = &ctx->m_GPUVertexBuffers[ctx->m_VertexBufferCapacity - 1];
-
-		gpuvb->m_PosBufferHandle = BGFX_INVALID_HANDLE;
-		gpuvb->m_UVBufferHandle = BGFX_INVALID_HANDLE;
-		gpuvb->m_ColorBufferHandle = BGFX_INVALID_HANDLE;
+	if (prepared->m_CommandBufferPos != cl->m_CommandBufferPos
+		|| prepared->m_Revision != cl->m_Revision
+		|| prepared->m_TesselationTolerance != ctx->m_TesselationTolerance
+		|| prepared->m_FringeWidth != ctx->m_FringeWidth
+		|| prepared->m_CanvasWidth != ctx->m_CanvasWidth
+		|| prepared->m_CanvasHeight != ctx->m_CanvasHeight) {
+		return false;
 	}
 
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::MutexScope ms(*ctx->m_DataPoolMutex);
-#endif
-
-	VertexBuffer* vb = &ctx->m_VertexBuffers[ctx->m_NumVertexBuffers++];
-	vb->m_Pos = (float*)bx::alloc(ctx->m_PosBufferPool, sizeof(float) * 2 * ctx->m_Config.m_MaxVBVertices);
-	vb->m_Color = (uint32_t*)bx::alloc(ctx->m_ColorBufferPool, sizeof(uint32_t) * ctx->m_Config.m_MaxVBVertices);
-	vb->m_UV = (uv_t*)bx::alloc(ctx->m_UVBufferPool, sizeof(uv_t) * 2 * ctx->m_Config.m_MaxVBVertices);
-	vb->m_Count = 0;
-
-	return vb;
-}
-
-static uint16_t allocIndexBuffer(Context* ctx)
-{
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::MutexScope ms(*ctx->m_DataPoolMutex);
-#endif
-
-	uint16_t ibID = UINT16_MAX;
-	const uint32_t numIB = ctx->m_NumIndexBuffers;
-	for (uint32_t i = 0; i < numIB; ++i) {
-		if (ctx->m_IndexBuffers[i].m_Count == 0) {
-			ibID = (uint16_t)i;
-			break;
+	// Child lists which have been modified, reset, destroyed or created since don't match the
+	// prepared meshes anymore.
+	const uint32_t numChildren = prepared->m_NumChildren;
+	for (uint32_t i = 0; i < numChildren; ++i) {
+		const PreparedCommandListChild* record = &prepared->m_Children[i];
+		const bool isValid = isCommandListHandleValid(ctx, record->m_Handle);
+		if (isValid != record->m_IsValid) {
+			return false;
 		}
-	}
-
-	if (ibID == UINT16_MAX) {
-		ctx->m_NumIndexBuffers++;
-		ctx->m_IndexBuffers = (IndexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_IndexBuffers, sizeof(IndexBuffer) * ctx->m_NumIndexBuffers);
-		ctx->m_GPUIndexBuffers = (GPUIndexBuffer*)bx::realloc(ctx->m_Allocator, ctx->m_GPUIndexBuffers, sizeof(GPUIndexBuffer) * ctx->m_NumIndexBuffers);
-
-		ibID = (uint16_t)(ctx->m_NumIndexBuffers - 1);
-
-		IndexBuffer* ib = &ctx->m_IndexBuffers[ibID];
-		ib->m_Capacity = 0;
-		ib->m_Count = 0;
-		ib->m_Indices = nullptr;
-
-		GPUIndexBuffer* gpuib = &ctx->m_GPUIndexBuffers[ibID];
-		gpuib->m_bgfxHandle = BGFX_INVALID_HANDLE;
-	}
 
-	return ibID;
-}
-
-static void releaseIndexBuffer(Context* ctx, uint16_t* data)
-{
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::MutexScope ms(*ctx->m_DataPoolMutex);
-#endif
-
-	VG_CHECK(data != nullptr, "Tried to release a null vertex buffer");
-	const uint32_t numIB = ctx->m_NumIndexBuffers;
-	for (uint32_t i = 0; i < numIB; ++i) {
-		if (ctx->m_IndexBuffers[i].m_Indices == data) {
-			// Reset the ib for reuse.
-			ctx->m_IndexBuffers[i].m_Count = 0;
-			break;
+		if (isValid) {
+			const CommandList* child = &ctx->m_CmdLists[record->m_Handle.idx];
+			if (child->m_Revision != record->m_Revision || child->m_CommandBufferPos != record->m_CommandBufferPos) {
+				return false;
+			}
 		}
 	}
-}
-
-static void createDrawCommand_VertexColor(Context* ctx, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices)
-{
-	// Allocate the draw command
-	const ImageHandle fontImg = fsGetFontAtlasImage(ctx->m_FontSystem);
-	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::Textured, fontImg.idx);
-
-	// Vertex buffer
-	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
-	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
-
-	float* dstPos = &vb->m_Pos[vbOffset << 1];
-	bx::memCopy(dstPos, vtx, sizeof(float) * 2 * numVertices);
-
-	const uv_t* uv = fsGetWhitePixelUV(ctx->m_FontSystem);
-
-	uv_t* dstUV = &vb->m_UV[vbOffset << 1];
-#if VG_CONFIG_UV_INT16
-	vgutil::memset32(dstUV, numVertices, &uv[0]);
-#else
-	vgutil::memset64(dstUV, numVertices, &uv[0]);
-#endif
-
-	uint32_t* dstColor = &vb->m_Color[vbOffset];
-	if (numColors == numVertices) {
-		bx::memCopy(dstColor, colors, sizeof(uint32_t) * numVertices);
-	} else {
-		VG_CHECK(numColors == 1, "Invalid size of color array passed.");
-		vgutil::memset32(dstColor, numVertices, colors);
-	}
 
-	// Index buffer
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	uint16_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
-	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (uint16_t)cmd->m_NumVertices);
-
-	cmd->m_NumVertices += numVertices;
-	cmd->m_NumIndices += numIndices;
+	// prepareCommandList() assumes the list is submitted using the initial state of the frame.
+	const State* state = getState(ctx);
+	return true
+		&& !ctx->m_RecordClipCommands
+		&& state->m_GlobalAlpha == 1.0f
+		&& bx::memCmp(state->m_TransformMtx, kIdentityMtx, sizeof(float) * 6) == 0
+		;
 }
 
-static void createDrawCommand_ImagePattern(Context* ctx, ImagePatternHandle imgPatternHandle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices)
+static void clFreePrepared(CommandList* cl)
 {
-	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::ImagePattern, imgPatternHandle.idx);
-
-	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
-	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
-
-	float* dstPos = &vb->m_Pos[vbOffset << 1];
-	bx::memCopy(dstPos, vtx, sizeof(float) * 2 * numVertices);
-
-	uint32_t* dstColor = &vb->m_Color[vbOffset];
-	if (numColors == numVertices) {
-		bx::memCopy(dstColor, colors, sizeof(uint32_t) * numVertices);
-	} else {
-		VG_CHECK(numColors == 1, "Invalid size of color array passed.");
-		vgutil::memset32(dstColor, numVertices, colors);
+	PreparedCommandList* prepared = cl->m_Prepared;
+	if (!prepared) {
+		return;
 	}
 
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	uint16_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
-	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (uint16_t)cmd->m_NumVertices);
-
-	cmd->m_NumVertices += numVertices;
-	cmd->m_NumIndices += numIndices;
+	bx::AllocatorI* allocator = prepared->m_Allocator;
+	bx::alignedFree(allocator, prepared->m_Pos, 16);
+	bx::free(allocator, prepared->m_Colors);
+	bx::free(allocator, prepared->m_Indices);
+	bx::free(allocator, prepared->m_Meshes);
+	bx::free(allocator, prepared->m_Commands);
+	bx::free(allocator, prepared->m_Children);
+	bx::free(allocator, prepared);
+	cl->m_Prepared = nullptr;
 }
 
-static void createDrawCommand_ColorGradient(Context* ctx, GradientHandle gradientHandle, const float* vtx, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices)
+static void clPreparedAddChild(Context* ctx, PreparedCommandList* prepared, CommandListHandle handle)
 {
-	DrawCommand* cmd = allocDrawCommand(ctx, numVertices, numIndices, DrawCommand::Type::ColorGradient, gradientHandle.idx);
+	const bool isValid = isCommandListHandleValid(ctx, handle);
+	const CommandList* child = isValid ? &ctx->m_CmdLists[handle.idx] : nullptr;
+	const uint32_t revision = isValid ? child->m_Revision : 0;
+	const uint32_t cmdBufferPos = isValid ? child->m_CommandBufferPos : 0;
 
-	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
-	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
-
-	float* dstPos = &vb->m_Pos[vbOffset << 1];
-	bx::memCopy(dstPos, vtx, sizeof(float) * 2 * numVertices);
-
-	uint32_t* dstColor = &vb->m_Color[vbOffset];
-	if (numColors == numVertices) {
-		bx::memCopy(dstColor, colors, sizeof(uint32_t) * numVertices);
-	} else {
-		VG_CHECK(numColors == 1, "Invalid size of color array passed.");
-		vgutil::memset32(dstColor, numVertices, colors);
+	// Submitting the same list several times in a row is common; record it once.
+	const PreparedCommandListChild* lastChild = prepared->m_NumChildren != 0 ? &prepared->m_Children[prepared->m_NumChildren - 1] : nullptr;
+	if (lastChild && lastChild->m_Handle.idx == handle.idx && lastChild->m_IsValid == isValid && lastChild->m_Revision == revision && lastChild->m_CommandBufferPos == cmdBufferPos) {
+		return;
 	}
 
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	uint16_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
-	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (uint16_t)cmd->m_NumVertices);
-
-	cmd->m_NumVertices += numVertices;
-	cmd->m_NumIndices += numIndices;
-}
-
-static void createDrawCommand_Clip(Context* ctx, const float* vtx, uint32_t numVertices, const uint16_t* indices, uint32_t numIndices)
-{
-	// Allocate the draw command
-	DrawCommand* cmd = allocClipCommand(ctx, numVertices, numIndices);
-
-	// Vertex buffer
-	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
-	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
-
-	float* dstPos = &vb->m_Pos[vbOffset << 1];
-	bx::memCopy(dstPos, vtx, sizeof(float) * 2 * numVertices);
-
-	// Index buffer
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	uint16_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
-	vgutil::batchTransformDrawIndices(indices, numIndices, dstIndex, (uint16_t)cmd->m_NumVertices);
-
-	cmd->m_NumVertices += numVertices;
-	cmd->m_NumIndices += numIndices;
-}
-
-// NOTE: Side effect: Resets m_ForceNewDrawCommand and m_ForceNewClipCommand if the current
-// vertex buffer cannot hold the specified amount of vertices.
-static uint32_t allocVertices(Context* ctx, uint32_t numVertices, uint32_t* vbID)
-{
-	VG_CHECK(numVertices < ctx->m_Config.m_MaxVBVertices, "A single draw call cannot have more than %d vertices", ctx->m_Config.m_MaxVBVertices);
-
-	// Check if the current vertex buffer can hold the specified amount of vertices
-	VertexBuffer* vb = &ctx->m_VertexBuffers[ctx->m_NumVertexBuffers - 1];
-	if (vb->m_Count + numVertices > ctx->m_Config.m_MaxVBVertices) {
-		// It cannot. Allocate a new vb.
-		vb = allocVertexBuffer(ctx);
-		VG_CHECK(vb, "Failed to allocate new Vertex Buffer");
-
-		// The currently active vertex buffer has changed so force a new draw command.
-		ctx->m_ForceNewDrawCommand = true;
-		ctx->m_ForceNewClipCommand = true;
+	if (prepared->m_NumChildren + 1 > prepared->m_ChildCapacity) {
+		prepared->m_ChildCapacity = bx::max<uint32_t>(prepared->m_ChildCapacity * 2, 4);
+		prepared->m_Children = (PreparedCommandListChild*)bx::realloc(prepared->m_Allocator, prepared->m_Children, sizeof(PreparedCommandListChild) * prepared->m_ChildCapacity);
 	}
 
-	*vbID = (uint32_t)(vb - ctx->m_VertexBuffers);
+	PreparedCommandListChild* record = &prepared->m_Children[prepared->m_NumChildren++];
+	record->m_Handle = handle;
+	record->m_Revision = revision;
+	record->m_CommandBufferPos = cmdBufferPos;
+	record->m_IsValid = isValid;
+}
 
-	const uint32_t firstVertexID = vb->m_Count;
-	vb->m_Count += numVertices;
-	return firstVertexID;
+static void clBoundsReset(CommandList* cl)
+{
+	cl->m_Bounds[0] = cl->m_Bounds[1] = cl->m_Bounds[2] = cl->m_Bounds[3] = 0.0f;
+	cl->m_BoundsMtx[0] = 1.0f;
+	cl->m_BoundsMtx[1] = 0.0f;
+	cl->m_BoundsMtx[2] = 0.0f;
+	cl->m_BoundsMtx[3] = 1.0f;
+	cl->m_BoundsMtx[4] = 0.0f;
+	cl->m_BoundsMtx[5] = 0.0f;
+	cl->m_BoundsMtxStackSize = 0;
+	cl->m_BoundsStrokeWidth = 0.0f;
+	cl->m_BoundsFixedStrokeWidth = 0.0f;
+	cl->m_BoundsFlags = 0;
+	cl->m_NumBoundsChildren = 0;
+	cl->m_BoundsGeneration++;
 }
 
-static uint32_t allocIndices(Context* ctx, uint32_t numIndices)
+// Called every time the bounds of the list grow. Parents which included the old bounds of
+// the list can no longer be culled (see clBoundsChildrenValid()).
+static inline void clBoundsGrow(CommandList* cl)
 {
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	if (ib->m_Count + numIndices > ib->m_Capacity) {
-		const uint32_t nextCapacity = ib->m_Capacity != 0 ? (ib->m_Capacity * 3) / 2 : 32;
+	cl->m_BoundsGeneration++;
+}
 
-		ib->m_Capacity = bx::uint32_max(nextCapacity, ib->m_Count + numIndices);
-		ib->m_Indices = (uint16_t*)bx::alignedRealloc(ctx->m_Allocator, ib->m_Indices, sizeof(uint16_t) * ib->m_Capacity, 16);
+static void clBoundsSetFlags(CommandList* cl, uint32_t flags)
+{
+	if ((cl->m_BoundsFlags & flags) != flags) {
+		cl->m_BoundsFlags |= flags;
+		clBoundsGrow(cl);
 	}
+}
 
-	const uint32_t firstIndexID = ib->m_Count;
-	ib->m_Count += numIndices;
-	return firstIndexID;
+// Upper bound of the scale the transform applies to any vector.
+static inline float transformGetMaxScale(const float* mtx)
+{
+	return bx::sqrt(mtx[0] * mtx[0] + mtx[1] * mtx[1] + mtx[2] * mtx[2] + mtx[3] * mtx[3]);
 }
 
-static DrawCommand* allocDrawCommand(Context* ctx, uint32_t numVertices, uint32_t numIndices, DrawCommand::Type::Enum type, uint16_t handle)
+// Transforms the rect's corners using mtx and returns their bounding rect.
+static void transformRect(const float* rect, const float* mtx, float* res)
 {
-	uint32_t vertexBufferID;
-	const uint32_t firstVertexID = allocVertices(ctx, numVertices, &vertexBufferID);
-	const uint32_t firstIndexID = allocIndices(ctx, numIndices);
+	const float corners[8] = {
+		rect[0], rect[1],
+		rect[2], rect[1],
+		rect[2], rect[3],
+		rect[0], rect[3]
+	};
 
-	const State* state = getState(ctx);
-	const float* scissor = state->m_ScissorRect;
+	float transformed[8];
+	vgutil::batchTransformPositions(&corners[0], 4, &transformed[0], mtx);
+	vgutil::calcBoundingRect(&transformed[0], 4, res);
+}
 
-	if (!ctx->m_ForceNewDrawCommand && ctx->m_NumDrawCommands != 0) {
-		DrawCommand* prevCmd = &ctx->m_DrawCommands[ctx->m_NumDrawCommands - 1];
+static void clBoundsAddRect(CommandList* cl, float minx, float miny, float maxx, float maxy)
+{
+	const float rect[4] = { minx, miny, maxx, maxy };
 
-		VG_CHECK(prevCmd->m_VertexBufferID == vertexBufferID, "Cannot merge draw commands with different vertex buffers");
-		VG_CHECK(prevCmd->m_ScissorRect[0] == (uint16_t)scissor[0]
-		      && prevCmd->m_ScissorRect[1] == (uint16_t)scissor[1]
-		      && prevCmd->m_ScissorRect[2] == (uint16_t)scissor[2]
-		      && prevCmd->m_ScissorRect[3] == (uint16_t)scissor[3], "Invalid scissor rect");
+	float bounds[4];
+	transformRect(&rect[0], cl->m_BoundsMtx, &bounds[0]);
 
-		if (prevCmd->m_Type == type && prevCmd->m_HandleID == handle) {
-			return prevCmd;
-		}
+	if ((cl->m_BoundsFlags & CommandListBoundsFlags::HasGeometry) == 0) {
+		bx::memCopy(cl->m_Bounds, bounds, sizeof(float) * 4);
+		cl->m_BoundsFlags |= CommandListBoundsFlags::HasGeometry;
+		clBoundsGrow(cl);
+	} else if (bounds[0] < cl->m_Bounds[0] || bounds[1] < cl->m_Bounds[1] || bounds[2] > cl->m_Bounds[2] || bounds[3] > cl->m_Bounds[3]) {
+		cl->m_Bounds[0] = bx::min<float>(cl->m_Bounds[0], bounds[0]);
+		cl->m_Bounds[1] = bx::min<float>(cl->m_Bounds[1], bounds[1]);
+		cl->m_Bounds[2] = bx::max<float>(cl->m_Bounds[2], bounds[2]);
+		cl->m_Bounds[3] = bx::max<float>(cl->m_Bounds[3], bounds[3]);
+		clBoundsGrow(cl);
 	}
+}
 
-	// The new draw command cannot be combined with the previous one. Create a new one.
-	if (ctx->m_NumDrawCommands == ctx->m_DrawCommandCapacity) {
-		ctx->m_DrawCommandCapacity = ctx->m_DrawCommandCapacity + 32;
-		ctx->m_DrawCommands = (DrawCommand*)bx::realloc(ctx->m_Allocator, ctx->m_DrawCommands, sizeof(DrawCommand) * ctx->m_DrawCommandCapacity);
+static void clBoundsAddStroke(CommandList* cl, float width, uint32_t flags)
+{
+	if ((flags & StrokeFlags::FixedWidth) != 0) {
+		if (width > cl->m_BoundsFixedStrokeWidth) {
+			cl->m_BoundsFixedStrokeWidth = width;
+			clBoundsGrow(cl);
+		}
+	} else {
+		const float scaledWidth = width * transformGetMaxScale(cl->m_BoundsMtx);
+		if (scaledWidth > cl->m_BoundsStrokeWidth) {
+			cl->m_BoundsStrokeWidth = scaledWidth;
+			clBoundsGrow(cl);
+		}
 	}
 
-	DrawCommand* cmd = &ctx->m_DrawCommands[ctx->m_NumDrawCommands];
-	ctx->m_NumDrawCommands++;
-
-	cmd->m_VertexBufferID = vertexBufferID;
-	cmd->m_FirstVertexID = firstVertexID;
-	cmd->m_FirstIndexID = firstIndexID;
-	cmd->m_NumVertices = 0;
-	cmd->m_NumIndices = 0;
-	cmd->m_Type = type;
-	cmd->m_HandleID = handle;
-	cmd->m_ScissorRect[0] = (uint16_t)scissor[0];
-	cmd->m_ScissorRect[1] = (uint16_t)scissor[1];
-	cmd->m_ScissorRect[2] = (uint16_t)scissor[2];
-	cmd->m_ScissorRect[3] = (uint16_t)scissor[3];
-	bx::memCopy(&cmd->m_ClipState, &ctx->m_ClipState, sizeof(ClipState));
-
-	ctx->m_ForceNewDrawCommand = false;
-
-	return cmd;
+	const LineJoin::Enum lineJoin = (LineJoin::Enum)((flags & VG_STROKE_FLAGS_LINE_JOIN_Msk) >> VG_STROKE_FLAGS_LINE_JOIN_Pos);
+	if (lineJoin == LineJoin::Miter) {
+		clBoundsSetFlags(cl, CommandListBoundsFlags::MiterJoins);
+	}
 }
 
-static DrawCommand* allocClipCommand(Context* ctx, uint32_t numVertices, uint32_t numIndices)
+// NOTE: Reads the bounds of the child so it shouldn't be recorded from another thread at the same time.
+static void clBoundsAddChild(Context* ctx, CommandList* cl, CommandListHandle childHandle)
 {
-	uint32_t vertexBufferID;
-	const uint32_t firstVertexID = allocVertices(ctx, numVertices, &vertexBufferID);
-	const uint32_t firstIndexID = allocIndices(ctx, numIndices);
-
-	const State* state = getState(ctx);
-	const float* scissor = state->m_ScissorRect;
-
-	if (!ctx->m_ForceNewClipCommand && ctx->m_NumClipCommands != 0) {
-		DrawCommand* prevCmd = &ctx->m_ClipCommands[ctx->m_NumClipCommands - 1];
+	if (!isCommandListHandleValid(ctx, childHandle)) {
+		clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+		return;
+	}
 
-		VG_CHECK(prevCmd->m_VertexBufferID == vertexBufferID, "Cannot merge clip commands with different vertex buffers");
-		VG_CHECK(prevCmd->m_ScissorRect[0] == (uint16_t)scissor[0]
-		      && prevCmd->m_ScissorRect[1] == (uint16_t)scissor[1]
-		      && prevCmd->m_ScissorRect[2] == (uint16_t)scissor[2]
-		      && prevCmd->m_ScissorRect[3] == (uint16_t)scissor[3], "Invalid scissor rect");
-		VG_CHECK(prevCmd->m_Type == DrawCommand::Type::Clip, "Invalid draw command type");
+	const CommandList* child = &ctx->m_CmdLists[childHandle.idx];
 
-		return prevCmd;
+	const uint32_t childFlags = child->m_BoundsFlags;
+	const bool childIsStale = (childFlags & CommandListBoundsFlags::HasChildren) != 0 && !clBoundsChildrenValid(ctx, child, 1);
+#if !VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	// Open clPushState() of the child leak into the parent.
+	const bool childLeaksState = child->m_BoundsMtxStackSize != 0;
+#else
+	const bool childLeaksState = false;
+#endif
+	if ((childFlags & CommandListBoundsFlags::Unbounded) != 0 || childIsStale || childLeaksState) {
+		clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+		return;
 	}
 
-	// The new clip command cannot be combined with the previous one. Create a new one.
-	if (ctx->m_NumClipCommands == ctx->m_ClipCommandCapacity) {
-		ctx->m_ClipCommandCapacity = ctx->m_ClipCommandCapacity + 32;
-		ctx->m_ClipCommands = (DrawCommand*)bx::realloc(ctx->m_Allocator, ctx->m_ClipCommands, sizeof(DrawCommand) * ctx->m_ClipCommandCapacity);
-	}
+	// Submitting the same list several times in a row is common; record it once.
+	const CommandListBoundsChild* lastChild = cl->m_NumBoundsChildren != 0 ? &cl->m_BoundsChildren[cl->m_NumBoundsChildren - 1] : nullptr;
+	if (!lastChild || lastChild->m_Handle.idx != childHandle.idx || lastChild->m_Generation != child->m_BoundsGeneration) {
+		if (cl->m_NumBoundsChildren + 1 > cl->m_BoundsChildrenCapacity) {
+			bx::AllocatorI* allocator = ctx->m_RecordingShards[cl->m_ShardID].m_Allocator;
+			cl->m_BoundsChildrenCapacity = bx::max<uint32_t>(cl->m_BoundsChildrenCapacity * 2, 4);
+			cl->m_BoundsChildren = (CommandListBoundsChild*)bx::realloc(allocator, cl->m_BoundsChildren, sizeof(CommandListBoundsChild) * cl->m_BoundsChildrenCapacity);
+		}
 
-	DrawCommand* cmd = &ctx->m_ClipCommands[ctx->m_NumClipCommands];
-	ctx->m_NumClipCommands++;
+		CommandListBoundsChild* record = &cl->m_BoundsChildren[cl->m_NumBoundsChildren++];
+		record->m_Handle = childHandle;
+		record->m_Generation = child->m_BoundsGeneration;
+	}
 
-	cmd->m_VertexBufferID = vertexBufferID;
-	cmd->m_FirstVertexID = firstVertexID;
-	cmd->m_FirstIndexID = firstIndexID;
-	cmd->m_NumVertices = 0;
-	cmd->m_NumIndices = 0;
-	cmd->m_Type = DrawCommand::Type::Clip;
-	cmd->m_HandleID = UINT16_MAX;
-	cmd->m_ScissorRect[0] = (uint16_t)scissor[0];
-	cmd->m_ScissorRect[1] = (uint16_t)scissor[1];
-	cmd->m_ScissorRect[2] = (uint16_t)scissor[2];
-	cmd->m_ScissorRect[3] = (uint16_t)scissor[3];
-	cmd->m_ClipState.m_FirstCmdID = ~0u;
-	cmd->m_ClipState.m_NumCmds = 0;
+	cl->m_BoundsFlags |= CommandListBoundsFlags::HasChildren;
 
-	ctx->m_ForceNewClipCommand = false;
+	if ((childFlags & CommandListBoundsFlags::HasGeometry) != 0) {
+		clBoundsAddRect(cl, child->m_Bounds[0], child->m_Bounds[1], child->m_Bounds[2], child->m_Bounds[3]);
+	}
 
-	return cmd;
-}
+	const float strokeWidth = child->m_BoundsStrokeWidth * transformGetMaxScale(cl->m_BoundsMtx);
+	if (strokeWidth > cl->m_BoundsStrokeWidth || child->m_BoundsFixedStrokeWidth > cl->m_BoundsFixedStrokeWidth) {
+		cl->m_BoundsStrokeWidth = bx::max<float>(cl->m_BoundsStrokeWidth, strokeWidth);
+		cl->m_BoundsFixedStrokeWidth = bx::max<float>(cl->m_BoundsFixedStrokeWidth, child->m_BoundsFixedStrokeWidth);
+		clBoundsGrow(cl);
+	}
 
-static void resetImage(Image* img)
-{
-	img->m_bgfxHandle = BGFX_INVALID_HANDLE;
-	img->m_Width = 0;
-	img->m_Height = 0;
-	img->m_Flags = 0;
-	img->m_Owned = false;
+	clBoundsSetFlags(cl, childFlags & (CommandListBoundsFlags::ResetsScissor | CommandListBoundsFlags::MiterJoins));
 }
 
-static ImageHandle allocImage(Context* ctx)
+// Returns false if any child included in the bounds of the list (or one of their own children)
+// has been destroyed or its bounds have grown since.
+static bool clBoundsChildrenValid(Context* ctx, const CommandList* cl, uint32_t depth)
 {
-	ImageHandle handle = { ctx->m_ImageHandleAlloc->alloc() };
-	if (!isValid(handle)) {
-		return VG_INVALID_HANDLE;
+	if (depth >= ctx->m_Config.m_MaxCommandListDepth) {
+		return false;
 	}
 
-	if (handle.idx >= ctx->m_ImageCapacity) {
-		const uint32_t oldCapacity = ctx->m_ImageCapacity;
+	const uint32_t numChildren = cl->m_NumBoundsChildren;
+	for (uint32_t i = 0; i < numChildren; ++i) {
+		const CommandListBoundsChild* record = &cl->m_BoundsChildren[i];
+		if (!isCommandListHandleValid(ctx, record->m_Handle)) {
+			return false;
+		}
 
-		ctx->m_ImageCapacity = bx::min(bx::max(ctx->m_ImageCapacity + 4, handle.idx + 1), ctx->m_Config.m_MaxImages);
-		ctx->m_Images = (Image*)bx::realloc(ctx->m_Allocator, ctx->m_Images, sizeof(Image) * ctx->m_ImageCapacity);
-		if (!ctx->m_Images) {
-			return VG_INVALID_HANDLE;
+		const CommandList* child = &ctx->m_CmdLists[record->m_Handle.idx];
+		if (child->m_BoundsGeneration != record->m_Generation) {
+			return false;
 		}
 
-		// Reset all new textures...
-		const uint32_t capacity = ctx->m_ImageCapacity;
-		for (uint32_t i = oldCapacity; i < capacity; ++i) {
-			resetImage(&ctx->m_Images[i]);
+		if ((child->m_BoundsFlags & CommandListBoundsFlags::HasChildren) != 0 && !clBoundsChildrenValid(ctx, child, depth + 1)) {
+			return false;
 		}
 	}
 
-	VG_CHECK(handle.idx < ctx->m_ImageCapacity, "Allocated invalid image handle");
-	Image* tex = &ctx->m_Images[handle.idx];
-	VG_CHECK(!bgfx::isValid(tex->m_bgfxHandle), "Allocated texture is already in use");
-	resetImage(tex);
+	return true;
+}
 
-	return handle;
+// Without VG_CONFIG_COMMAND_LIST_PRESERVE_STATE, state changes outside a clPushState()/clPopState()
+// block leak into the caller so the list cannot be skipped.
+static void clBoundsStateChanged(CommandList* cl)
+{
+#if !VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	if (cl->m_BoundsMtxStackSize == 0) {
+		clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+	}
+#else
+	BX_UNUSED(cl);
+#endif
 }
 
-static void renderTextQuads(Context* ctx, const TextQuad* quads, uint32_t numQuads, Color color, ImageHandle img)
+static void clBoundsTransformMult(CommandList* cl, const float* mtx)
 {
-	const uint32_t numDrawVertices = numQuads * 4;
-	const uint32_t numDrawIndices = numQuads * 6;
+	float res[6];
+	vgutil::multiplyMatrix3(cl->m_BoundsMtx, mtx, res);
+	bx::memCopy(cl->m_BoundsMtx, res, sizeof(float) * 6);
+}
 
-	if (ctx->m_TextVertexCapacity < numDrawVertices) {
-		ctx->m_TextVertices = (float*)bx::alignedRealloc(ctx->m_Allocator, ctx->m_TextVertices, sizeof(float) * 2 * numDrawVertices, 16);
-		ctx->m_TextVertexCapacity = numDrawVertices;
+static void clBoundsPushState(Context* ctx, CommandList* cl)
+{
+	if (cl->m_BoundsMtxStackSize + 1 > cl->m_BoundsMtxStackCapacity) {
+		bx::AllocatorI* allocator = ctx->m_RecordingShards[cl->m_ShardID].m_Allocator;
+		cl->m_BoundsMtxStackCapacity += 4;
+		cl->m_BoundsMtxStack = (float*)bx::realloc(allocator, cl->m_BoundsMtxStack, sizeof(float) * 6 * cl->m_BoundsMtxStackCapacity);
 	}
 
-	const State* state = getState(ctx);
-	const float scale = state->m_FontScale * ctx->m_DevicePixelRatio;
-	const float invscale = 1.0f / scale;
+	bx::memCopy(&cl->m_BoundsMtxStack[cl->m_BoundsMtxStackSize * 6], cl->m_BoundsMtx, sizeof(float) * 6);
+	++cl->m_BoundsMtxStackSize;
+}
 
-	float mtx[6];
-	mtx[0] = state->m_TransformMtx[0] * invscale;
-	mtx[1] = state->m_TransformMtx[1] * invscale;
-	mtx[2] = state->m_TransformMtx[2] * invscale;
-	mtx[3] = state->m_TransformMtx[3] * invscale;
-	mtx[4] = state->m_TransformMtx[4];
-	mtx[5] = state->m_TransformMtx[5];
+static void clBoundsPopState(CommandList* cl)
+{
+	if (cl->m_BoundsMtxStackSize == 0) {
+		// Pops the state of the caller.
+		clBoundsSetFlags(cl, CommandListBoundsFlags::Unbounded);
+		return;
+	}
 
-	// TODO: Calculate bounding rect of the quads.
-	vgutil::batchTransformTextQuads(&quads->m_Pos[0], numQuads, mtx, ctx->m_TextVertices);
+	--cl->m_BoundsMtxStackSize;
+	bx::memCopy(cl->m_BoundsMtx, &cl->m_BoundsMtxStack[cl->m_BoundsMtxStackSize * 6], sizeof(float) * 6);
+}
 
-	DrawCommand* cmd = allocDrawCommand(ctx, numDrawVertices, numDrawIndices, DrawCommand::Type::Textured, img.idx);
+// Returns false if nothing the list (and its children) draws can be inside the current scissor rect.
+static bool clIsVisible(Context* ctx, const CommandList* cl)
+{
+	float bounds[4];
+	if (!clCalcCanvasBounds(ctx, cl, &bounds[0])) {
+		return true;
+	}
 
-	VertexBuffer* vb = &ctx->m_VertexBuffers[cmd->m_VertexBufferID];
-	const uint32_t vbOffset = cmd->m_FirstVertexID + cmd->m_NumVertices;
+	const uint32_t flags = cl->m_BoundsFlags;
+	if ((flags & CommandListBoundsFlags::HasGeometry) == 0) {
+		return false;
+	}
 
-	float* dstPos = &vb->m_Pos[vbOffset << 1];
-	bx::memCopy(dstPos, ctx->m_TextVertices, sizeof(float) * 2 * numDrawVertices);
+	const State* state = getState(ctx);
+	const float canvasRect[4] = { 0.0f, 0.0f, (float)ctx->m_CanvasWidth, (float)ctx->m_CanvasHeight };
+	const float* rect = (flags & CommandListBoundsFlags::ResetsScissor) != 0 ? &canvasRect[0] : &state->m_ScissorRect[0];
+
+	return true
+		&& bounds[0] < rect[0] + rect[2]
+		&& bounds[1] < rect[1] + rect[3]
+		&& bounds[2] > rect[0]
+		&& bounds[3] > rect[1]
+		;
+}
 
-	uint32_t* dstColor = &vb->m_Color[vbOffset];
-	vgutil::memset32(dstColor, numDrawVertices, &color);
+// Calculates the canvas space bounds (minx, miny, maxx, maxy) of the list when submitted with the
+// current transform, including the widest stroke and AA fringes. Returns false if the bounds
+// aren't known; the list can draw anywhere in that case. Lists without geometry get an empty rect.
+static bool clCalcCanvasBounds(Context* ctx, const CommandList* cl, float* bounds)
+{
+	const uint32_t flags = cl->m_BoundsFlags;
+	if ((flags & CommandListBoundsFlags::Unbounded) != 0) {
+		return false;
+	}
 
-	uv_t* dstUV = &vb->m_UV[vbOffset << 1];
-	const TextQuad* q = quads;
-	uint32_t nq = numQuads;
-	while (nq-- > 0) {
-		const uv_t s0 = q->m_TexCoord[0];
-		const uv_t t0 = q->m_TexCoord[1];
-		const uv_t s1 = q->m_TexCoord[2];
-		const uv_t t1 = q->m_TexCoord[3];
+	if ((flags & CommandListBoundsFlags::HasChildren) != 0 && !clBoundsChildrenValid(ctx, cl, 0)) {
+		return false;
+	}
 
-		dstUV[0] = s0; dstUV[1] = t0;
-		dstUV[2] = s1; dstUV[3] = t0;
-		dstUV[4] = s1; dstUV[5] = t1;
-		dstUV[6] = s0; dstUV[7] = t1;
+#if !VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
+	if (cl->m_BoundsMtxStackSize != 0) {
+		return false;
+	}
+#endif
 
-		dstUV += 8;
-		++q;
+	if ((flags & CommandListBoundsFlags::HasGeometry) == 0) {
+		bx::memSet(bounds, 0, sizeof(float) * 4);
+		return true;
 	}
 
-	IndexBuffer* ib = &ctx->m_IndexBuffers[ctx->m_ActiveIndexBufferID];
-	uint16_t* dstIndex = &ib->m_Indices[cmd->m_FirstIndexID + cmd->m_NumIndices];
-	vgutil::genQuadIndices_unaligned(dstIndex, numQuads, (uint16_t)cmd->m_NumVertices);
+	const State* state = getState(ctx);
+	const float* mtx = state->m_TransformMtx;
 
-	cmd->m_NumVertices += numDrawVertices;
-	cmd->m_NumIndices += numDrawIndices;
-}
+	transformRect(cl->m_Bounds, mtx, bounds);
 
-static CommandListHandle allocCommandList(Context* ctx)
-{
-	CommandListHandle handle = { ctx->m_CmdListHandleAlloc->alloc() };
-	if (!isValid(handle)) {
-		return VG_INVALID_HANDLE;
-	}
+	// Same as tessCalcStrokeMargin() using the widest stroke of the list.
+	const float fringeWidth = ctx->m_FringeWidth;
+	const float scaledStrokeWidth = bx::min<float>(cl->m_BoundsStrokeWidth * transformGetMaxScale(mtx), 200.0f);
+	const float strokeWidth = bx::max<float>(scaledStrokeWidth, cl->m_BoundsFixedStrokeWidth);
+	const float halfWidth = bx::max<float>(strokeWidth, fringeWidth) * 0.5f + fringeWidth;
+	const float margin = (flags & CommandListBoundsFlags::MiterJoins) != 0 ? halfWidth * 200.0f : halfWidth * 1.5f;
 
-	VG_CHECK(handle.idx < ctx->m_Config.m_MaxCommandLists, "Allocated invalid command list handle");
-	CommandList* cl = &ctx->m_CmdLists[handle.idx];
-	bx::memSet(cl, 0, sizeof(CommandList));
+	bounds[0] -= margin;
+	bounds[1] -= margin;
+	bounds[2] += margin;
+	bounds[3] += margin;
 
-	return handle;
+	return true;
 }
 
-static inline bool isCommandListHandleValid(Context* ctx, CommandListHandle handle)
+// Adds the area the list covers (and covered the last time it was submitted) to the dirty rect
+// if the list has been modified, moved or scissored differently since its previous submission, or
+// if it wasn't submitted by the previous frame.
+// Lists submitted more than once per frame always mark all their instances dirty.
+static void clUpdateDirtyRect(Context* ctx, CommandList* cl)
 {
-	return isValid(handle) && ctx->m_CmdListHandleAlloc->isValid(handle.idx);
-}
+	const State* state = getState(ctx);
 
-#if VG_CONFIG_ENABLE_SHAPE_CACHING
-static CommandListCache* allocCommandListCache(Context* ctx)
-{
-	bx::AllocatorI* allocator = ctx->m_Allocator;
+	float bounds[4];
+	if (!clCalcCanvasBounds(ctx, cl, &bounds[0])) {
+		bounds[0] = 0.0f;
+		bounds[1] = 0.0f;
+		bounds[2] = (float)ctx->m_CanvasWidth;
+		bounds[3] = (float)ctx->m_CanvasHeight;
+	} else if ((cl->m_BoundsFlags & CommandListBoundsFlags::ResetsScissor) == 0) {
+		const float* scissor = state->m_ScissorRect;
+		bounds[0] = bx::max<float>(bounds[0], scissor[0]);
+		bounds[1] = bx::max<float>(bounds[1], scissor[1]);
+		bounds[2] = bx::max<float>(bx::min<float>(bounds[2], scissor[0] + scissor[2]), bounds[0]);
+		bounds[3] = bx::max<float>(bx::min<float>(bounds[3], scissor[1] + scissor[3]), bounds[1]);
+	}
 
-	CommandListCache* cache = (CommandListCache*)bx::alloc(allocator, sizeof(CommandListCache));
-	bx::memSet(cache, 0, sizeof(CommandListCache));
+	const float* mtx = state->m_TransformMtx;
+	if (cl->m_DirtyFrameID == ctx->m_DirtyFrameID) {
+		addDirtyRectMinMax(ctx, bounds);
+		addDirtyRectMinMax(ctx, cl->m_DirtyPrevBounds);
+
+		cl->m_DirtyBounds[0] = bx::min<float>(cl->m_DirtyBounds[0], bounds[0]);
+		cl->m_DirtyBounds[1] = bx::min<float>(cl->m_DirtyBounds[1], bounds[1]);
+		cl->m_DirtyBounds[2] = bx::max<float>(cl->m_DirtyBounds[2], bounds[2]);
+		cl->m_DirtyBounds[3] = bx::max<float>(cl->m_DirtyBounds[3], bounds[3]);
+		return;
+	}
+
+	// Lists which weren't submitted by the previous frame have never been drawn or have been
+	// erased by its end().
+	const bool wasSubmitted = cl->m_DirtyFrameID != 0 && cl->m_DirtyFrameID + 1 == ctx->m_DirtyFrameID;
+	const bool changed = false
+		|| !wasSubmitted
+		|| cl->m_Revision != cl->m_DirtyRevision
+		|| bx::memCmp(cl->m_DirtyMtx, mtx, sizeof(float) * 6) != 0
+		|| bx::memCmp(cl->m_DirtyBounds, bounds, sizeof(float) * 4) != 0
+		;
+	if (changed) {
+		if (wasSubmitted) {
+			addDirtyRectMinMax(ctx, cl->m_DirtyBounds);
+		}
+		addDirtyRectMinMax(ctx, bounds);
+	}
 
-	return cache;
+	bx::memCopy(cl->m_DirtyPrevBounds, cl->m_DirtyBounds, sizeof(float) * 4);
+	bx::memCopy(cl->m_DirtyBounds, bounds, sizeof(float) * 4);
+	bx::memCopy(cl->m_DirtyMtx, mtx, sizeof(float) * 6);
+	cl->m_DirtyRevision = cl->m_Revision;
+	cl->m_DirtyFrameID = ctx->m_DirtyFrameID;
 }
 
-static void freeCommandListCache(Context* ctx, CommandListCache* cache)
+// rect: minx, miny, maxx, maxy
+static void addDirtyRectMinMax(Context* ctx, const float* rect)
 {
-	bx::AllocatorI* allocator = ctx->m_Allocator;
+	if (!ctx->m_DirtyRectTracking || rect[0] >= rect[2] || rect[1] >= rect[3]) {
+		return;
+	}
 
-	clCacheReset(ctx, cache);
-	bx::free(allocator, cache);
+	float* dirtyRect = ctx->m_DirtyRect;
+	if (!ctx->m_HasDirtyRect) {
+		bx::memCopy(dirtyRect, rect, sizeof(float) * 4);
+		ctx->m_HasDirtyRect = true;
+	} else {
+		dirtyRect[0] = bx::min<float>(dirtyRect[0], rect[0]);
+		dirtyRect[1] = bx::min<float>(dirtyRect[1], rect[1]);
+		dirtyRect[2] = bx::max<float>(dirtyRect[2], rect[2]);
+		dirtyRect[3] = bx::max<float>(dirtyRect[3], rect[3]);
+	}
 }
-#endif
 
-static uint8_t* clAllocCommand(Context* ctx, CommandList* cl, CommandType::Enum cmdType, uint32_t dataSize)
+static void preparedMeshCallback(void* userData, const Mesh* mesh, const uint32_t* colors, uint32_t numColors)
 {
-	const uint32_t alignedDataSize = alignSize(dataSize, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
-	const uint32_t totalSize = 0
-		+ kAlignedCommandHeaderSize
-		+ alignedDataSize;
+	PreparedCommandList* prepared = (PreparedCommandList*)userData;
+	bx::AllocatorI* allocator = prepared->m_Allocator;
 
-	const uint32_t pos = cl->m_CommandBufferPos;
-	VG_CHECK(isAligned(pos, VG_CONFIG_COMMAND_LIST_ALIGNMENT), "Unaligned command buffer position");
+	const uint32_t numVertices = mesh->m_NumVertices;
+	const uint32_t numIndices = mesh->m_NumIndices;
+
+	if (prepared->m_NumVertices + numVertices > prepared->m_VertexCapacity) {
+		prepared->m_VertexCapacity = bx::max<uint32_t>(prepared->m_NumVertices + numVertices, prepared->m_VertexCapacity * 3 / 2);
+		prepared->m_Pos = (float*)bx::alignedRealloc(allocator, prepared->m_Pos, sizeof(float) * 2 * prepared->m_VertexCapacity, 16);
+	}
 
-	if (pos + totalSize > cl->m_CommandBufferCapacity) {
-		const uint32_t capacityDelta = bx::max<uint32_t>(totalSize, 256);
-		cl->m_CommandBufferCapacity += capacityDelta;
-		cl->m_CommandBuffer = (uint8_t*)bx::alignedRealloc(ctx->m_Allocator, cl->m_CommandBuffer, cl->m_CommandBufferCapacity, VG_CONFIG_COMMAND_LIST_ALIGNMENT);
+	if (prepared->m_NumColors + numColors > prepared->m_ColorCapacity) {
+		prepared->m_ColorCapacity = bx::max<uint32_t>(prepared->m_NumColors + numColors, prepared->m_ColorCapacity * 3 / 2);
+		prepared->m_Colors = (uint32_t*)bx::realloc(allocator, prepared->m_Colors, sizeof(uint32_t) * prepared->m_ColorCapacity);
+	}
 
-		ctx->m_Stats.m_CmdListMemoryTotal += capacityDelta;
+	if (prepared->m_NumIndices + numIndices > prepared->m_IndexCapacity) {
+		prepared->m_IndexCapacity = bx::max<uint32_t>(prepared->m_NumIndices + numIndices, prepared->m_IndexCapacity * 3 / 2);
+		prepared->m_Indices = (index_t*)bx::realloc(allocator, prepared->m_Indices, sizeof(index_t) * prepared->m_IndexCapacity);
 	}
 
-	uint8_t* ptr = &cl->m_CommandBuffer[pos];
-	cl->m_CommandBufferPos += totalSize;
-	ctx->m_Stats.m_CmdListMemoryUsed += totalSize;
+	if (prepared->m_NumMeshes + 1 > prepared->m_MeshCapacity) {
+		prepared->m_MeshCapacity += 32;
+		prepared->m_Meshes = (PreparedMesh*)bx::realloc(allocator, prepared->m_Meshes, sizeof(PreparedMesh) * prepared->m_MeshCapacity);
+	}
 
-	CommandHeader* hdr = (CommandHeader*)ptr;
-	ptr += kAlignedCommandHeaderSize;
+	PreparedMesh* preparedMesh = &prepared->m_Meshes[prepared->m_NumMeshes++];
+	preparedMesh->m_FirstVertexID = prepared->m_NumVertices;
+	preparedMesh->m_NumVertices = numVertices;
+	preparedMesh->m_FirstColorID = prepared->m_NumColors;
+	preparedMesh->m_NumColors = numColors;
+	preparedMesh->m_FirstIndexID = prepared->m_NumIndices;
+	preparedMesh->m_NumIndices = numIndices;
 
-	hdr->m_Type = cmdType;
-	hdr->m_Size = alignedDataSize;
+	bx::memCopy(&prepared->m_Pos[prepared->m_NumVertices << 1], mesh->m_PosBuffer, sizeof(float) * 2 * numVertices);
+	bx::memCopy(&prepared->m_Colors[prepared->m_NumColors], colors, sizeof(uint32_t) * numColors);
+	bx::memCopy(&prepared->m_Indices[prepared->m_NumIndices], mesh->m_IndexBuffer, sizeof(index_t) * numIndices);
 
-	return ptr;
+	prepared->m_NumVertices += numVertices;
+	prepared->m_NumColors += numColors;
+	prepared->m_NumIndices += numIndices;
 }
 
-static uint32_t clStoreString(Context* ctx, CommandList* cl, const char* str, uint32_t len)
+static void submitPreparedCommand(Context* ctx, const PreparedCommandList* prepared, const PreparedCommand* cmd, DrawCommand::Type::Enum type, uint16_t handle)
 {
-	if (cl->m_StringBufferPos + len > cl->m_StringBufferCapacity) {
-		cl->m_StringBufferCapacity += bx::max<uint32_t>(len, 128);
-		cl->m_StringBuffer = (char*)bx::realloc(ctx->m_Allocator, cl->m_StringBuffer, cl->m_StringBufferCapacity);
-	}
+	DrawCommandMeshSink sink;
+	sink.m_Context = ctx;
+	sink.m_Type = type;
+	sink.m_Handle = handle;
+	sink.m_Color = Colors::Black;
+	sink.m_AddToCache = false;
 
-	const uint32_t offset = cl->m_StringBufferPos;
-	bx::memCopy(cl->m_StringBuffer + offset, str, len);
-	cl->m_StringBufferPos += len;
-	return offset;
+	const uint32_t lastMeshID = cmd->m_FirstMeshID + cmd->m_NumMeshes;
+	for (uint32_t i = cmd->m_FirstMeshID; i < lastMeshID; ++i) {
+		const PreparedMesh* preparedMesh = &prepared->m_Meshes[i];
+
+		Mesh mesh;
+		mesh.m_PosBuffer = &prepared->m_Pos[preparedMesh->m_FirstVertexID << 1];
+		mesh.m_ColorBuffer = &prepared->m_Colors[preparedMesh->m_FirstColorID];
+		mesh.m_IndexBuffer = &prepared->m_Indices[preparedMesh->m_FirstIndexID];
+		mesh.m_NumVertices = preparedMesh->m_NumVertices;
+		mesh.m_NumIndices = preparedMesh->m_NumIndices;
+
+		drawCommandMeshCallback(&sink, &mesh, mesh.m_ColorBuffer, preparedMesh->m_NumColors);
+	}
 }
 
 #if VG_CONFIG_ENABLE_SHAPE_CACHING
-static CommandListCache* clGetCache(Context* ctx, CommandList* cl)
+// Returns the LOD tessellated at the scale nearest to avgScale, if it's within ContextConfig::m_CacheScaleTolerance
+// (*isCached = true). Otherwise an empty or the least recently used LOD is reset and returned in order to be
+// filled by the caller (*isCached = false).
+static CommandListCache* clGetCache(Context* ctx, CommandList* cl, float avgScale, bool* isCached)
 {
+	*isCached = false;
+
 	if ((cl->m_Flags & CommandListFlags::Cacheable) == 0) {
 		return nullptr;
 	}
 
-	CommandListCache* cache = cl->m_Cache;
-	if (!cache) {
-		cache = allocCommandListCache(ctx);
-		cl->m_Cache = cache;
+	CommandListCache* lods = cl->m_Cache;
+	if (!lods) {
+		lods = allocCommandListCache(ctx);
+		cl->m_Cache = lods;
+	}
+
+	const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+	float nearestScaleRatio = 1.0f + ctx->m_Config.m_CacheScaleTolerance;
+	CommandListCache* nearest = nullptr;
+	CommandListCache* lru = &lods[0];
+	for (uint32_t i = 0; i < numLODs; ++i) {
+		CommandListCache* lod = &lods[i];
+		if (lod->m_LastUsed < lru->m_LastUsed) {
+			lru = lod;
+		}
+
+		if (lod->m_LastUsed == 0) {
+			continue;
+		}
+
+		const float scaleRatio = lod->m_AvgScale == avgScale
+			? 1.0f
+			: (lod->m_AvgScale > avgScale ? lod->m_AvgScale / avgScale : avgScale / lod->m_AvgScale);
+		if (scaleRatio <= nearestScaleRatio) {
+			nearestScaleRatio = scaleRatio;
+			nearest = lod;
+		}
+	}
+
+	if (nearest) {
+		nearest->m_LastUsed = ++ctx->m_CmdListCacheClock;
+		*isCached = true;
+		return nearest;
 	}
 
-	return cache;
+	clCacheReset(ctx, lru);
+	lru->m_AvgScale = avgScale;
+	lru->m_LastUsed = ++ctx->m_CmdListCacheClock;
+
+	return lru;
 }
 
 static void pushCommandListCache(Context* ctx, CommandListCache* cache)
@@ -4346,15 +7966,23 @@ static void beginCachedCommand(Context* ctx)
 
 	bx::AllocatorI* allocator = ctx->m_Allocator;
 
-	cache->m_NumCommands++;
-	cache->m_Commands = (CachedCommand*)bx::realloc(allocator, cache->m_Commands, sizeof(CachedCommand) * cache->m_NumCommands);
+	CachedCommand* cachedCmd = cache->m_RebuildCommand;
+	if (!cachedCmd) {
+		cache->m_NumCommands++;
+		cache->m_Commands = (CachedCommand*)bx::realloc(allocator, cache->m_Commands, sizeof(CachedCommand) * cache->m_NumCommands);
+		cachedCmd = &cache->m_Commands[cache->m_NumCommands - 1];
+	} else {
+		const uint32_t freedMemory = clCacheFreeCommandMeshes(allocator, cachedCmd);
+		cache->m_MemoryUsed -= freedMemory;
+		ctx->m_CmdListCacheMemory -= freedMemory;
+	}
 
-	CachedCommand* lastCmd = &cache->m_Commands[cache->m_NumCommands - 1];
-	lastCmd->m_FirstMeshID = (uint16_t)cache->m_NumMeshes;
-	lastCmd->m_NumMeshes = 0;
+	bx::memSet(cachedCmd, 0, sizeof(CachedCommand));
 
 	const State* state = getState(ctx);
-	vgutil::invertMatrix3(state->m_TransformMtx, lastCmd->m_InvTransformMtx);
+	vgutil::invertMatrix3(state->m_TransformMtx, cachedCmd->m_InvTransformMtx);
+
+	cache->m_ActiveCommand = cachedCmd;
 }
 
 static void endCachedCommand(Context* ctx)
@@ -4362,66 +7990,81 @@ static void endCachedCommand(Context* ctx)
 	CommandListCache* cache = getCommandListCacheStackTop(ctx);
 	VG_CHECK(cache, "No bound CommandListCache");
 
-	VG_CHECK(cache->m_NumCommands != 0, "beginCachedCommand() hasn't been called");
-
-	CachedCommand* lastCmd = &cache->m_Commands[cache->m_NumCommands - 1];
-	VG_CHECK(lastCmd->m_NumMeshes == 0, "endCachedCommand() called too many times");
-	lastCmd->m_NumMeshes = (uint16_t)(cache->m_NumMeshes - lastCmd->m_FirstMeshID);
+	VG_CHECK(cache->m_ActiveCommand != nullptr, "beginCachedCommand() hasn't been called");
+	cache->m_ActiveCommand = nullptr;
 }
 
-static void addCachedCommand(Context* ctx, const float* pos, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const uint16_t* indices, uint32_t numIndices)
+static void addCachedCommand(Context* ctx, const float* pos, uint32_t numVertices, const uint32_t* colors, uint32_t numColors, const index_t* indices, uint32_t numIndices)
 {
 	CommandListCache* cache = getCommandListCacheStackTop(ctx);
 	VG_CHECK(cache, "No bound CommandListCache");
 
+	CachedCommand* cachedCmd = cache->m_ActiveCommand;
+	VG_CHECK(cachedCmd, "beginCachedCommand() hasn't been called");
+
 	bx::AllocatorI* allocator = ctx->m_Allocator;
 
-	cache->m_NumMeshes++;
-	cache->m_Meshes = (CachedMesh*)bx::realloc(allocator, cache->m_Meshes, sizeof(CachedMesh) * cache->m_NumMeshes);
+	cachedCmd->m_NumMeshes++;
+	cachedCmd->m_Meshes = (CachedMesh*)bx::realloc(allocator, cachedCmd->m_Meshes, sizeof(CachedMesh) * cachedCmd->m_NumMeshes);
 
-	CachedMesh* mesh = &cache->m_Meshes[cache->m_NumMeshes - 1];
+	CachedMesh* mesh = &cachedCmd->m_Meshes[cachedCmd->m_NumMeshes - 1];
 
-	const uint32_t totalMem = 0
-		+ alignSize(sizeof(float) * 2 * numVertices, 16)
-		+ ((numColors != 1) ? alignSize(sizeof(uint32_t) * numVertices, 16) : 0)
-		+ alignSize(sizeof(uint16_t) * numIndices, 16);
+	// NOTE: Meshes are tessellated using white (see ctxFillPath()) so only the alpha channel
+	// of the colors is meaningful. A single color is still stored per vertex if it's not opaque
+	// (e.g. thin non-AA strokes).
+	const bool hasCoverage = numColors != 1 || colorGetAlpha(colors[0]) != 0xFF;
+
+	const uint32_t totalMem = clCacheMeshSize(numVertices, hasCoverage, numIndices);
+	cache->m_MemoryUsed += totalMem;
+	ctx->m_CmdListCacheMemory += totalMem;
 
 	uint8_t* mem = (uint8_t*)bx::alignedAlloc(allocator, totalMem, 16);
 	mesh->m_Pos = (float*)mem;
 	mem += alignSize(sizeof(float) * 2 * numVertices, 16);
 
-	const float* invMtx = cache->m_Commands[cache->m_NumCommands - 1].m_InvTransformMtx;
+	const float* invMtx = cachedCmd->m_InvTransformMtx;
 	vgutil::batchTransformPositions(pos, numVertices, mesh->m_Pos, invMtx);
 	mesh->m_NumVertices = numVertices;
 
-	if (numColors == 1) {
-		mesh->m_Colors = nullptr;
+	if (!hasCoverage) {
+		mesh->m_Coverage = nullptr;
 	} else {
-		VG_CHECK(numColors == numVertices, "Invalid number of colors");
-		mesh->m_Colors = (uint32_t*)mem;
-		mem += alignSize(sizeof(uint32_t) * numVertices, 16);
+		VG_CHECK(numColors == 1 || numColors == numVertices, "Invalid number of colors");
+		mesh->m_Coverage = (uint8_t*)mem;
+		mem += alignSize(sizeof(uint8_t) * numVertices, 16);
 
-		bx::memCopy(mesh->m_Colors, colors, sizeof(uint32_t) * numColors);
+		if (numColors == 1) {
+			bx::memSet(mesh->m_Coverage, colorGetAlpha(colors[0]), numVertices);
+		} else {
+			for (uint32_t i = 0; i < numVertices; ++i) {
+				mesh->m_Coverage[i] = colorGetAlpha(colors[i]);
+			}
+		}
 	}
 
-	mesh->m_Indices = (uint16_t*)mem;
-	bx::memCopy(mesh->m_Indices, indices, sizeof(uint16_t) * numIndices);
+	mesh->m_Indices = (index_t*)mem;
+	bx::memCopy(mesh->m_Indices, indices, sizeof(index_t) * numIndices);
 	mesh->m_NumIndices = numIndices;
 }
 
 // Walk the command list; avoid Path commands and use CachedMesh(es) on Stroker commands.
 // Everything else (state, clip, text) is executed similarly to the uncached version (see submitCommandList).
-static void clCacheRender(Context* ctx, CommandList* cl)
+static void clCacheRender(Context* ctx, CommandList* cl, CommandListCache* clCache)
 {
 	const uint16_t numGradients = cl->m_NumGradients;
 	const uint16_t numImagePatterns = cl->m_NumImagePatterns;
 	const uint32_t clFlags = cl->m_Flags;
 
 	const bool cullCmds = (clFlags & CommandListFlags::AllowCommandCulling) != 0;
+	const bool retained = (clFlags & CommandListFlags::Retained) != 0;
+	const bool gpuTransform = (clFlags & CommandListFlags::GPUTransform) != 0;
 
-	CommandListCache* clCache = cl->m_Cache;
 	VG_CHECK(clCache != nullptr, "No CommandListCache in CommandList; this function shouldn't have been called!");
 
+	if (retained) {
+		clCacheUpdateGPUBuffers(ctx, cl, clCache);
+	}
+
 	const uint16_t firstGradientID = (uint16_t)ctx->m_NextGradientID;
 	const uint16_t firstImagePatternID = (uint16_t)ctx->m_NextImagePatternID;
 	VG_CHECK(firstGradientID + numGradients <= ctx->m_Config.m_MaxGradients, "Not enough free gradients for command list. Increase ContextConfig::m_MaxGradients");
@@ -4436,8 +8079,10 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 
 	const char* stringBuffer = cl->m_StringBuffer;
 	CachedCommand* nextCachedCommand = &clCache->m_Commands[0];
+	const uint8_t* pathFirstCmd = cmd;
 
 	bool skipCmds = false;
+	bool cacheModified = false;
 
 #if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
 	ctxPushState(ctx);
@@ -4449,16 +8094,31 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 
 		const uint8_t* nextCmd = cmd + cmdHeader->m_Size;
 
-		// Skip path commands.
+		// Skip path commands. Remember where the current path starts in case a modified command should be tessellated again.
 		if (cmdHeader->m_Type >= CommandType::FirstPathCommand && cmdHeader->m_Type <= CommandType::LastPathCommand) {
+			if (cmdHeader->m_Type == CommandType::BeginPath) {
+				pathFirstCmd = (const uint8_t*)cmdHeader;
+			}
+
 			cmd = nextCmd;
 			continue;
 		}
 
-		if (skipCmds && cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand) {
-			cmd = nextCmd;
-			++nextCachedCommand;
-			continue;
+		if (cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand) {
+			if (skipCmds || (cmdHeader->m_Flags & CommandFlags::Hidden) != 0) {
+				cmd = nextCmd;
+				++nextCachedCommand;
+				continue;
+			}
+
+			if (nextCachedCommand->m_IsDirty) {
+				clCacheRebuildCommand(ctx, clCache, nextCachedCommand, pathFirstCmd, cmdHeader, firstGradientID, firstImagePatternID);
+				cacheModified = true;
+
+				cmd = nextCmd;
+				++nextCachedCommand;
+				continue;
+			}
 		}
 
 		switch (cmdHeader->m_Type) {
@@ -4466,7 +8126,9 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			const uint32_t flags = CMD_READ(cmd, uint32_t);
 			const Color color = CMD_READ(cmd, Color);
 			BX_UNUSED(flags);
-			submitCachedMesh(ctx, color, &clCache->m_Meshes[nextCachedCommand->m_FirstMeshID], nextCachedCommand->m_NumMeshes);
+			if (!retained || ctx->m_RecordClipCommands || !submitRetainedCommand(ctx, clCache, nextCachedCommand)) {
+				submitCachedMesh(ctx, color, nextCachedCommand->m_Meshes, nextCachedCommand->m_NumMeshes, gpuTransform);
+			}
 			++nextCachedCommand;
 		} break;
 		case CommandType::FillPathGradient: {
@@ -4476,7 +8138,7 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			BX_UNUSED(flags);
 
 			const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
-			submitCachedMesh(ctx, gradient, &clCache->m_Meshes[nextCachedCommand->m_FirstMeshID], nextCachedCommand->m_NumMeshes);
+			submitCachedMesh(ctx, gradient, nextCachedCommand->m_Meshes, nextCachedCommand->m_NumMeshes);
 			++nextCachedCommand;
 		} break;
 		case CommandType::FillPathImagePattern: {
@@ -4487,7 +8149,7 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			BX_UNUSED(flags);
 
 			const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
-			submitCachedMesh(ctx, imgPattern, color, &clCache->m_Meshes[nextCachedCommand->m_FirstMeshID], nextCachedCommand->m_NumMeshes);
+			submitCachedMesh(ctx, imgPattern, color, nextCachedCommand->m_Meshes, nextCachedCommand->m_NumMeshes);
 			++nextCachedCommand;
 		} break;
 		case CommandType::StrokePathColor: {
@@ -4496,7 +8158,9 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			const Color color = CMD_READ(cmd, Color);
 			BX_UNUSED(flags, width);
 
-			submitCachedMesh(ctx, color, &clCache->m_Meshes[nextCachedCommand->m_FirstMeshID], nextCachedCommand->m_NumMeshes);
+			if (!retained || ctx->m_RecordClipCommands || !submitRetainedCommand(ctx, clCache, nextCachedCommand)) {
+				submitCachedMesh(ctx, color, nextCachedCommand->m_Meshes, nextCachedCommand->m_NumMeshes, gpuTransform);
+			}
 			++nextCachedCommand;
 		} break;
 		case CommandType::StrokePathGradient: {
@@ -4507,7 +8171,7 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			BX_UNUSED(flags, width);
 
 			const GradientHandle gradient = { isLocal(gradientFlags) ? (uint16_t)(gradientHandle + firstGradientID) : gradientHandle, 0 };
-			submitCachedMesh(ctx, gradient, &clCache->m_Meshes[nextCachedCommand->m_FirstMeshID], nextCachedCommand->m_NumMeshes);
+			submitCachedMesh(ctx, gradient, nextCachedCommand->m_Meshes, nextCachedCommand->m_NumMeshes);
 			++nextCachedCommand;
 		} break;
 		case CommandType::StrokePathImagePattern: {
@@ -4519,7 +8183,7 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			BX_UNUSED(flags, width);
 
 			const ImagePatternHandle imgPattern = { isLocal(imgPatternFlags) ? (uint16_t)(imgPatternHandle + firstImagePatternID) : imgPatternHandle, 0 };
-			submitCachedMesh(ctx, imgPattern, color, &clCache->m_Meshes[nextCachedCommand->m_FirstMeshID], nextCachedCommand->m_NumMeshes);
+			submitCachedMesh(ctx, imgPattern, color, nextCachedCommand->m_Meshes, nextCachedCommand->m_NumMeshes);
 			++nextCachedCommand;
 		} break;
 		case CommandType::IndexedTriList: {
@@ -4533,8 +8197,8 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 			const Color* colors = (Color*)cmd;
 			cmd += sizeof(Color) * numColors;
 			const uint32_t numIndices = CMD_READ(cmd, uint32_t);
-			const uint16_t* indices = (uint16_t*)cmd;
-			cmd += sizeof(uint16_t) * numIndices;
+			const index_t* indices = (index_t*)cmd;
+			cmd += sizeof(index_t) * numIndices;
 			const uint16_t imgHandle = CMD_READ(cmd, uint16_t);
 
 			ctxIndexedTriList(ctx, positions, numUVs ? uv : nullptr, numVertices, colors, numColors, indices, numIndices, { imgHandle });
@@ -4682,30 +8346,420 @@ static void clCacheRender(Context* ctx, CommandList* cl)
 		cmd = nextCmd;
 	}
 
+	// The GPU buffers have been skipped because of the modified commands (see clCacheUpdateGPUBuffers()).
+	// Upload everything now that they have been tessellated again.
+	if (retained && cacheModified) {
+		clCacheUpdateGPUBuffers(ctx, cl, clCache);
+	}
+
 #if VG_CONFIG_COMMAND_LIST_PRESERVE_STATE
 	ctxPopState(ctx);
 	ctxResetClip(ctx);
 #endif
 }
 
-static void clCacheReset(Context* ctx, CommandListCache* cache)
+// Tessellates a modified command again (replacing its cached meshes) and submits the new meshes.
+// The path is rebuilt from the path commands between pathFirstCmd and the stroker command.
+static void clCacheRebuildCommand(Context* ctx, CommandListCache* cache, CachedCommand* cachedCmd, const uint8_t* pathFirstCmd, const CommandHeader* strokerCmdHeader, uint16_t firstGradientID, uint16_t firstImagePatternID)
 {
-	bx::AllocatorI* allocator = ctx->m_Allocator;
+	// Use the scale of the LOD (instead of the current one) so the new meshes match the rest of the cached commands.
+	tessBeginPath(&ctx->m_Tessellator, cache->m_AvgScale, ctx->m_TesselationTolerance, ctx->m_FringeWidth);
+
+	const uint8_t* cmd = pathFirstCmd;
+	while (cmd < (const uint8_t*)strokerCmdHeader) {
+		const CommandHeader* cmdHeader = (const CommandHeader*)cmd;
+		cmd += kAlignedCommandHeaderSize;
+
+		if (cmdHeader->m_Type <= CommandType::LastPathCommand) {
+			ctxExecPathCommand(ctx, cmdHeader->m_Type, cmd);
+		}
+
+		cmd += cmdHeader->m_Size;
+	}
+
+	pushCommandListCache(ctx, cache);
+	cache->m_RebuildCommand = cachedCmd;
+	ctxExecStrokerCommand(ctx, strokerCmdHeader->m_Type, (const uint8_t*)strokerCmdHeader + kAlignedCommandHeaderSize, firstGradientID, firstImagePatternID);
+	cache->m_RebuildCommand = nullptr;
+	popCommandListCache(ctx);
+}
 
-	const uint32_t numMeshes = cache->m_NumMeshes;
+// Returns the size of the freed meshes (see clCacheMeshSize()).
+static uint32_t clCacheFreeCommandMeshes(bx::AllocatorI* allocator, CachedCommand* cachedCmd)
+{
+	uint32_t freedMemory = 0;
+
+	const uint32_t numMeshes = cachedCmd->m_NumMeshes;
 	for (uint32_t i = 0; i < numMeshes; ++i) {
-		CachedMesh* mesh = &cache->m_Meshes[i];
+		const CachedMesh* mesh = &cachedCmd->m_Meshes[i];
+		freedMemory += clCacheMeshSize(mesh->m_NumVertices, mesh->m_Coverage != nullptr, mesh->m_NumIndices);
 		bx::alignedFree(allocator, mesh->m_Pos, 16);
 	}
-	bx::free(allocator, cache->m_Meshes);
+	bx::free(allocator, cachedCmd->m_Meshes);
+
+	cachedCmd->m_Meshes = nullptr;
+	cachedCmd->m_NumMeshes = 0;
+
+	return freedMemory;
+}
+
+// Size of the single allocation holding the positions, coverage and indices of a CachedMesh.
+static uint32_t clCacheMeshSize(uint32_t numVertices, bool hasCoverage, uint32_t numIndices)
+{
+	return 0
+		+ alignSize(sizeof(float) * 2 * numVertices, 16)
+		+ (hasCoverage ? alignSize(sizeof(uint8_t) * numVertices, 16) : 0)
+		+ alignSize(sizeof(index_t) * numIndices, 16);
+}
+
+// Evicts the least recently used LODs of all command lists until the cached meshes fit in
+// ContextConfig::m_MaxCacheMemory. LODs used by the current frame are kept, even if they alone
+// exceed the budget, so they aren't tessellated again every frame.
+static void ctxTrimCommandListCaches(Context* ctx)
+{
+	const uint32_t maxMemory = ctx->m_Config.m_MaxCacheMemory;
+	if (maxMemory == 0) {
+		return;
+	}
+
+	const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+	const uint16_t numCmdLists = ctx->m_CmdListHandleAlloc->getNumHandles();
+	const uint16_t* cmdListHandles = ctx->m_CmdListHandleAlloc->getHandles();
+	while (ctx->m_CmdListCacheMemory > maxMemory) {
+		CommandListCache* lru = nullptr;
+		for (uint16_t i = 0; i < numCmdLists; ++i) {
+			CommandListCache* lods = ctx->m_CmdLists[cmdListHandles[i]].m_Cache;
+			if (!lods) {
+				continue;
+			}
+
+			for (uint32_t j = 0; j < numLODs; ++j) {
+				CommandListCache* lod = &lods[j];
+				if (lod->m_LastUsed != 0 && lod->m_LastUsed <= ctx->m_CmdListCacheFrameClock && (!lru || lod->m_LastUsed < lru->m_LastUsed)) {
+					lru = lod;
+				}
+			}
+		}
+
+		if (!lru) {
+			break;
+		}
+
+		clCacheReset(ctx, lru);
+	}
+}
+
+// Marks the specified stroker commands as modified in all LODs. They are tessellated again the
+// next time the list is rendered from the cache.
+static void clCacheInvalidateCommands(Context* ctx, CommandList* cl, uint32_t firstCmdID, uint32_t lastCmdID)
+{
+	CommandListCache* lods = cl->m_Cache;
+	if (!lods) {
+		return;
+	}
+
+	const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+	for (uint32_t i = 0; i < numLODs; ++i) {
+		CommandListCache* cache = &lods[i];
+		const uint32_t last = bx::min<uint32_t>(lastCmdID, cache->m_NumCommands);
+		for (uint32_t cmdID = firstCmdID; cmdID < last; ++cmdID) {
+			cache->m_Commands[cmdID].m_IsDirty = true;
+		}
+
+		// The geometry of the GPU buffers is out of date.
+		if (firstCmdID < last) {
+			clCacheDestroyGPUBuffers(cache);
+		}
+	}
+}
+
+// Destroys the GPU buffers of all LODs so the new command colors are uploaded on the next
+// submission. The cached meshes themselves stay valid.
+static void clCacheInvalidateColors(Context* ctx, CommandList* cl)
+{
+	CommandListCache* lods = cl->m_Cache;
+	if (!lods) {
+		return;
+	}
+
+	const uint32_t numLODs = ctx->m_Config.m_MaxCachedLODs;
+	for (uint32_t i = 0; i < numLODs; ++i) {
+		clCacheDestroyGPUBuffers(&lods[i]);
+	}
+}
+
+static void clCacheReset(Context* ctx, CommandListCache* cache)
+{
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+
+	const uint32_t numCommands = cache->m_NumCommands;
+	for (uint32_t i = 0; i < numCommands; ++i) {
+		clCacheFreeCommandMeshes(allocator, &cache->m_Commands[i]);
+	}
 	bx::free(allocator, cache->m_Commands);
 
+	clCacheDestroyGPUBuffers(cache);
+
+	ctx->m_CmdListCacheMemory -= cache->m_MemoryUsed;
+
 	bx::memSet(cache, 0, sizeof(CommandListCache));
+	cache->m_GPUPosBufferHandle = BGFX_INVALID_HANDLE;
+	cache->m_GPUUVBufferHandle = BGFX_INVALID_HANDLE;
+	cache->m_GPUColorBufferHandle = BGFX_INVALID_HANDLE;
+	cache->m_GPUIndexBufferHandle = BGFX_INVALID_HANDLE;
+}
+
+static void clCacheDestroyGPUBuffers(CommandListCache* cache)
+{
+	if (bgfx::isValid(cache->m_GPUPosBufferHandle)) {
+		bgfx::destroy(cache->m_GPUPosBufferHandle);
+		cache->m_GPUPosBufferHandle = BGFX_INVALID_HANDLE;
+	}
+	if (bgfx::isValid(cache->m_GPUUVBufferHandle)) {
+		bgfx::destroy(cache->m_GPUUVBufferHandle);
+		cache->m_GPUUVBufferHandle = BGFX_INVALID_HANDLE;
+	}
+	if (bgfx::isValid(cache->m_GPUColorBufferHandle)) {
+		bgfx::destroy(cache->m_GPUColorBufferHandle);
+		cache->m_GPUColorBufferHandle = BGFX_INVALID_HANDLE;
+	}
+	if (bgfx::isValid(cache->m_GPUIndexBufferHandle)) {
+		bgfx::destroy(cache->m_GPUIndexBufferHandle);
+		cache->m_GPUIndexBufferHandle = BGFX_INVALID_HANDLE;
+	}
+}
+
+// Uploads the meshes of all solid color fill/stroke commands into static GPU buffers. Each command's
+// meshes are concatenated so a command can be drawn with a single draw call. The buffers are
+// recreated only when the font atlas white pixel moves.
+static void clCacheUpdateGPUBuffers(Context* ctx, CommandList* cl, CommandListCache* cache)
+{
+	const uv_t* whitePixelUV = fsGetWhitePixelUV(ctx->m_FontSystem);
+
+	// Retained commands are drawn using the font atlas. Bake the premultiplied colors if it's
+	// blended as premultiplied alpha, the same way premultiplyDrawCommandColors() does.
+	const bool premultipliedAlpha = ctx->m_Images[fsGetFontAtlasImage(ctx->m_FontSystem).idx].m_PremultipliedAlpha;
+
+	if (bgfx::isValid(cache->m_GPUIndexBufferHandle)
+		&& !bx::memCmp(cache->m_GPUWhitePixelUV, whitePixelUV, sizeof(uv_t) * 2)
+		&& cache->m_GPUPremultipliedAlpha == premultipliedAlpha) {
+		return;
+	}
+
+	clCacheDestroyGPUBuffers(cache);
+
+	const uint32_t numCommands = cache->m_NumCommands;
+	if (numCommands == 0) {
+		return;
+	}
+
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+	Color* cmdColors = (Color*)bx::alloc(allocator, sizeof(Color) * numCommands);
+
+	// Find the commands which can be drawn from the GPU buffers and assign their ranges.
+	uint32_t totalVertices = 0;
+	uint32_t totalIndices = 0;
+	uint32_t cmdID = 0;
+
+	const uint8_t* cmd = cl->m_CommandBuffer;
+	const uint8_t* cmdListEnd = cl->m_CommandBuffer + cl->m_CommandBufferPos;
+	while (cmd < cmdListEnd) {
+		const CommandHeader* cmdHeader = (CommandHeader*)cmd;
+		cmd += kAlignedCommandHeaderSize;
+
+		const uint8_t* nextCmd = cmd + cmdHeader->m_Size;
+
+		if (cmdHeader->m_Type >= CommandType::FirstStrokerCommand && cmdHeader->m_Type <= CommandType::LastStrokerCommand) {
+			VG_CHECK(cmdID < numCommands, "Command list cache doesn't match the command list");
+			CachedCommand* cachedCmd = &cache->m_Commands[cmdID];
+
+			bool isColorPaint = true;
+			if (cmdHeader->m_Type == CommandType::FillPathColor) {
+				cmd += sizeof(uint32_t); // flags
+				cmdColors[cmdID] = CMD_READ(cmd, Color);
+			} else if (cmdHeader->m_Type == CommandType::StrokePathColor) {
+				cmd += sizeof(float) + sizeof(uint32_t); // width + flags
+				cmdColors[cmdID] = CMD_READ(cmd, Color);
+			} else {
+				isColorPaint = false;
+			}
+
+			uint32_t numVertices = 0;
+			uint32_t numIndices = 0;
+			const uint32_t numMeshes = cachedCmd->m_NumMeshes;
+			for (uint32_t iMesh = 0; iMesh < numMeshes; ++iMesh) {
+				numVertices += cachedCmd->m_Meshes[iMesh].m_NumVertices;
+				numIndices += cachedCmd->m_Meshes[iMesh].m_NumIndices;
+			}
+
+			// Don't upload anything while visible commands are waiting to be tessellated again.
+			// clCacheRender() calls this again after rebuilding them.
+			if (cachedCmd->m_IsDirty && (cmdHeader->m_Flags & CommandFlags::Hidden) == 0) {
+				bx::free(allocator, cmdColors);
+				return;
+			}
+
+			// Indices are relative to the first vertex of the command so all its vertices should
+			// be addressable by 16-bit indices. Hidden and modified commands aren't uploaded.
+			const bool isRetained = true
+				&& isColorPaint
+				&& numIndices != 0
+				&& numVertices <= UINT16_MAX
+				&& (cmdHeader->m_Flags & CommandFlags::Hidden) == 0
+				&& !cachedCmd->m_IsDirty;
+
+			cachedCmd->m_GPUFirstVertexID = totalVertices;
+			cachedCmd->m_GPUNumVertices = isRetained ? numVertices : 0;
+			cachedCmd->m_GPUFirstIndexID = totalIndices;
+			cachedCmd->m_GPUNumIndices = isRetained ? numIndices : 0;
+
+			totalVertices += cachedCmd->m_GPUNumVertices;
+			totalIndices += cachedCmd->m_GPUNumIndices;
+			++cmdID;
+		}
+
+		cmd = nextCmd;
+	}
+	VG_CHECK(cmdID == numCommands, "Command list cache doesn't match the command list");
+
+	if (totalIndices != 0) {
+		const bgfx::Memory* posMem = bgfx::alloc(sizeof(float) * 2 * totalVertices);
+		const bgfx::Memory* uvMem = bgfx::alloc(sizeof(uv_t) * 2 * totalVertices);
+		const bgfx::Memory* colorMem = bgfx::alloc(sizeof(uint32_t) * totalVertices);
+		const bgfx::Memory* indexMem = bgfx::alloc(sizeof(index_t) * totalIndices);
+
+#if VG_CONFIG_UV_INT16
+		vgutil::memset32(uvMem->data, totalVertices, &whitePixelUV[0]);
+#else
+		vgutil::memset64(uvMem->data, totalVertices, &whitePixelUV[0]);
+#endif
+
+		for (uint32_t iCmd = 0; iCmd < numCommands; ++iCmd) {
+			const CachedCommand* cachedCmd = &cache->m_Commands[iCmd];
+			if (cachedCmd->m_GPUNumIndices == 0) {
+				continue;
+			}
+
+			float* dstPos = (float*)posMem->data + (cachedCmd->m_GPUFirstVertexID << 1);
+			uint32_t* dstColor = (uint32_t*)colorMem->data + cachedCmd->m_GPUFirstVertexID;
+			index_t* dstIndex = (index_t*)indexMem->data + cachedCmd->m_GPUFirstIndexID;
+			index_t firstVertexID = 0;
+
+			const uint32_t numMeshes = cachedCmd->m_NumMeshes;
+			for (uint32_t iMesh = 0; iMesh < numMeshes; ++iMesh) {
+				const CachedMesh* mesh = &cachedCmd->m_Meshes[iMesh];
+				const uint32_t numVertices = mesh->m_NumVertices;
+
+				bx::memCopy(dstPos, mesh->m_Pos, sizeof(float) * 2 * numVertices);
+				if (mesh->m_Coverage) {
+					vgutil::batchModulateCoverage(mesh->m_Coverage, numVertices, cmdColors[iCmd], dstColor);
+				} else {
+					vgutil::memset32(dstColor, numVertices, &cmdColors[iCmd]);
+				}
+
+				if (premultipliedAlpha) {
+					for (uint32_t i = 0; i < numVertices; ++i) {
+						dstColor[i] = premultiplyColor(dstColor[i]);
+					}
+				}
+				vgutil::batchTransformDrawIndices(mesh->m_Indices, mesh->m_NumIndices, dstIndex, firstVertexID);
+
+				dstPos += numVertices << 1;
+				dstColor += numVertices;
+				dstIndex += mesh->m_NumIndices;
+				firstVertexID += (index_t)numVertices;
+			}
+		}
+
+		cache->m_GPUPosBufferHandle = bgfx::createVertexBuffer(posMem, ctx->m_PosVertexDecl);
+		cache->m_GPUUVBufferHandle = bgfx::createVertexBuffer(uvMem, ctx->m_UVVertexDecl);
+		cache->m_GPUColorBufferHandle = bgfx::createVertexBuffer(colorMem, ctx->m_ColorVertexDecl);
+		cache->m_GPUIndexBufferHandle = bgfx::createIndexBuffer(indexMem, VG_INDEX_BUFFER_FLAGS);
+	}
+
+	bx::memCopy(cache->m_GPUWhitePixelUV, whitePixelUV, sizeof(uv_t) * 2);
+	cache->m_GPUPremultipliedAlpha = premultipliedAlpha;
+
+	bx::free(allocator, cmdColors);
+}
+
+// Creates a draw command which references the command's meshes in the GPU buffers of the cache.
+// The current transform is applied as the model matrix. Returns false if the command hasn't
+// been uploaded.
+static bool submitRetainedCommand(Context* ctx, const CommandListCache* cache, const CachedCommand* cachedCmd)
+{
+	VG_CHECK(!ctx->m_RecordClipCommands, "Retained commands cannot be used inside BeginClip()/EndClip()");
+
+	if (cachedCmd->m_GPUNumIndices == 0 || !bgfx::isValid(cache->m_GPUIndexBufferHandle)) {
+		return false;
+	}
+
+	// The paint colors are baked into the GPU buffers. Let submitCachedMesh() apply the global alpha.
+	if (getState(ctx)->m_GlobalAlpha != 1.0f) {
+		return false;
+	}
+
+	bx::AllocatorI* allocator = ctx->m_Allocator;
+
+	if (ctx->m_NumRetainedDraws == ctx->m_RetainedDrawCapacity) {
+		ctx->m_RetainedDrawCapacity = ctx->m_RetainedDrawCapacity + 32;
+		ctx->m_RetainedDraws = (RetainedDraw*)bx::realloc(allocator, ctx->m_RetainedDraws, sizeof(RetainedDraw) * ctx->m_RetainedDrawCapacity);
+	}
+
+	if (ctx->m_NumDrawCommands == ctx->m_DrawCommandCapacity) {
+		ctx->m_DrawCommandCapacity = ctx->m_DrawCommandCapacity + 32;
+		ctx->m_DrawCommands = (DrawCommand*)bx::realloc(allocator, ctx->m_DrawCommands, sizeof(DrawCommand) * ctx->m_DrawCommandCapacity);
+	}
+
+	const State* state = getState(ctx);
+	const float* mtx = state->m_TransformMtx;
+	const float* scissor = state->m_ScissorRect;
+
+	RetainedDraw* retainedDraw = &ctx->m_RetainedDraws[ctx->m_NumRetainedDraws];
+	retainedDraw->m_PosBufferHandle = cache->m_GPUPosBufferHandle;
+	retainedDraw->m_UVBufferHandle = cache->m_GPUUVBufferHandle;
+	retainedDraw->m_ColorBufferHandle = cache->m_GPUColorBufferHandle;
+	retainedDraw->m_IndexBufferHandle = cache->m_GPUIndexBufferHandle;
+
+	DrawCommand* cmd = &ctx->m_DrawCommands[ctx->m_NumDrawCommands];
+	ctx->m_NumDrawCommands++;
+
+	cmd->m_VertexBufferID = UINT32_MAX;
+	cmd->m_FirstVertexID = cachedCmd->m_GPUFirstVertexID;
+	cmd->m_FirstIndexID = cachedCmd->m_GPUFirstIndexID;
+	cmd->m_NumVertices = cachedCmd->m_GPUNumVertices;
+	cmd->m_NumIndices = cachedCmd->m_GPUNumIndices;
+	cmd->m_Type = DrawCommand::Type::Textured;
+	cmd->m_HandleID = fsGetFontAtlasImage(ctx->m_FontSystem).idx;
+	cmd->m_RetainedDrawID = ctx->m_NumRetainedDraws;
+	cmd->m_TransformID = pushDrawTransform(ctx, mtx);
+	cmd->m_LayerID = ctx->m_ActiveLayerID;
+	cmd->m_NumStencilIndices = 0;
+	cmd->m_StencilFillRule = FillRule::NonZero;
+	cmd->m_FirstInstanceID = 0;
+	cmd->m_NumInstances = 0;
+	cmd->m_SDFBlur = 0.0f;
+	cmd->m_ScissorRect[0] = (uint16_t)scissor[0];
+	cmd->m_ScissorRect[1] = (uint16_t)scissor[1];
+	cmd->m_ScissorRect[2] = (uint16_t)scissor[2];
+	cmd->m_ScissorRect[3] = (uint16_t)scissor[3];
+	bx::memCopy(&cmd->m_ClipState, &ctx->m_ClipState, sizeof(ClipState));
+
+	ctx->m_NumRetainedDraws++;
+
+	// Nothing can be appended to this draw command.
+	ctx->m_ForceNewDrawCommand = true;
+
+	return true;
 }
 
-static void submitCachedMesh(Context* ctx, Color col, const CachedMesh* meshList, uint32_t numMeshes)
+static void submitCachedMesh(Context* ctx, Color col, const CachedMesh* meshList, uint32_t numMeshes, bool gpuTransform)
 {
 	const bool recordClipCommands = ctx->m_RecordClipCommands;
+#if VG_CONFIG_POSITION_INT16
+	// Quantized vertices cannot be in local space.
+	gpuTransform = false;
+#endif
 
 	const State* state = getState(ctx);
 	const float* mtx = state->m_TransformMtx;
@@ -4714,23 +8768,44 @@ static void submitCachedMesh(Context* ctx, Color col, const CachedMesh* meshList
 		for (uint32_t i = 0; i < numMeshes; ++i) {
 			const CachedMesh* mesh = &meshList[i];
 			const uint32_t numVertices = mesh->m_NumVertices;
-			float* transformedVertices = allocTransformedVertices(ctx, numVertices);
+			float* transformedVertices = tessAllocTransformedVertices(&ctx->m_Tessellator, numVertices);
 
 			vgutil::batchTransformPositions(mesh->m_Pos, numVertices, transformedVertices, mtx);
 			createDrawCommand_Clip(ctx, transformedVertices, numVertices, mesh->m_Indices, mesh->m_NumIndices);
 		}
 	} else {
+		col = colorSetAlpha(col, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(col)));
+
+		// Let the vertex shader transform the cached vertices. Draw commands with a different
+		// model matrix (e.g. uncached commands) cannot be batched with these.
+		if (gpuTransform) {
+			VG_CHECK(ctx->m_ActiveDrawTransformID == UINT32_MAX, "Nested GPU transforms aren't supported");
+			ctx->m_ActiveDrawTransformID = pushDrawTransform(ctx, mtx);
+		}
+
 		for (uint32_t i = 0; i < numMeshes; ++i) {
 			const CachedMesh* mesh = &meshList[i];
 			const uint32_t numVertices = mesh->m_NumVertices;
-			float* transformedVertices = allocTransformedVertices(ctx, numVertices);
 
-			const uint32_t* colors = mesh->m_Colors ? mesh->m_Colors : &col;
-			const uint32_t numColors = mesh->m_Colors ? numVertices : 1;
+			const uint32_t* colors = &col;
+			uint32_t numColors = 1;
+			if (mesh->m_Coverage) {
+				uint32_t* modulatedColors = tessAllocColors(&ctx->m_Tessellator, numVertices);
+				vgutil::batchModulateCoverage(mesh->m_Coverage, numVertices, col, modulatedColors);
+				colors = modulatedColors;
+				numColors = numVertices;
+			}
 
-			vgutil::batchTransformPositions(mesh->m_Pos, numVertices, transformedVertices, mtx);
-			createDrawCommand_VertexColor(ctx, transformedVertices, numVertices, colors, numColors, mesh->m_Indices, mesh->m_NumIndices);
+			if (gpuTransform) {
+				createDrawCommand_VertexColor(ctx, mesh->m_Pos, numVertices, colors, numColors, mesh->m_Indices, mesh->m_NumIndices);
+			} else {
+				float* transformedVertices = tessAllocTransformedVertices(&ctx->m_Tessellator, numVertices);
+				vgutil::batchTransformPositions(mesh->m_Pos, numVertices, transformedVertices, mtx);
+				createDrawCommand_VertexColor(ctx, transformedVertices, numVertices, colors, numColors, mesh->m_Indices, mesh->m_NumIndices);
+			}
 		}
+
+		ctx->m_ActiveDrawTransformID = UINT32_MAX;
 	}
 }
 
@@ -4747,10 +8822,16 @@ static void submitCachedMesh(Context* ctx, GradientHandle gradientHandle, const
 	for (uint32_t i = 0; i < numMeshes; ++i) {
 		const CachedMesh* mesh = &meshList[i];
 		const uint32_t numVertices = mesh->m_NumVertices;
-		float* transformedVertices = allocTransformedVertices(ctx, numVertices);
+		float* transformedVertices = tessAllocTransformedVertices(&ctx->m_Tessellator, numVertices);
 
-		const uint32_t* colors = mesh->m_Colors ? mesh->m_Colors : &black;
-		const uint32_t numColors = mesh->m_Colors ? numVertices : 1;
+		const uint32_t* colors = &black;
+		uint32_t numColors = 1;
+		if (mesh->m_Coverage) {
+			uint32_t* modulatedColors = tessAllocColors(&ctx->m_Tessellator, numVertices);
+			vgutil::batchModulateCoverage(mesh->m_Coverage, numVertices, black, modulatedColors);
+			colors = modulatedColors;
+			numColors = numVertices;
+		}
 
 		vgutil::batchTransformPositions(mesh->m_Pos, numVertices, transformedVertices, mtx);
 		createDrawCommand_ColorGradient(ctx, gradientHandle, transformedVertices, numVertices, colors, numColors, mesh->m_Indices, mesh->m_NumIndices);
@@ -4766,13 +8847,21 @@ static void submitCachedMesh(Context* ctx, ImagePatternHandle imgPattern, Color
 	const State* state = getState(ctx);
 	const float* mtx = state->m_TransformMtx;
 
+	col = colorSetAlpha(col, (uint8_t)(state->m_GlobalAlpha * colorGetAlpha(col)));
+
 	for (uint32_t i = 0; i < numMeshes; ++i) {
 		const CachedMesh* mesh = &meshList[i];
 		const uint32_t numVertices = mesh->m_NumVertices;
-		float* transformedVertices = allocTransformedVertices(ctx, numVertices);
+		float* transformedVertices = tessAllocTransformedVertices(&ctx->m_Tessellator, numVertices);
 
-		const uint32_t* colors = mesh->m_Colors ? mesh->m_Colors : &col;
-		const uint32_t numColors = mesh->m_Colors ? numVertices : 1;
+		const uint32_t* colors = &col;
+		uint32_t numColors = 1;
+		if (mesh->m_Coverage) {
+			uint32_t* modulatedColors = tessAllocColors(&ctx->m_Tessellator, numVertices);
+			vgutil::batchModulateCoverage(mesh->m_Coverage, numVertices, col, modulatedColors);
+			colors = modulatedColors;
+			numColors = numVertices;
+		}
 
 		vgutil::batchTransformPositions(mesh->m_Pos, numVertices, transformedVertices, mtx);
 		createDrawCommand_ImagePattern(ctx, imgPattern, transformedVertices, numVertices, colors, numColors, mesh->m_Indices, mesh->m_NumIndices);
@@ -4780,37 +8869,13 @@ static void submitCachedMesh(Context* ctx, ImagePatternHandle imgPattern, Color
 }
 #endif // VG_CONFIG_ENABLE_SHAPE_CACHING
 
-static void releaseVertexBufferPosCallback(void* ptr, void* userData)
-{
-	Context* ctx = (Context*)userData;
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::MutexScope ms(*ctx->m_DataPoolMutex);
-#endif
-	bx::free(ctx->m_PosBufferPool, ptr);
-}
-
-static void releaseVertexBufferColorCallback(void* ptr, void* userData)
-{
-	Context* ctx = (Context*)userData;
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::MutexScope ms(*ctx->m_DataPoolMutex);
-#endif
-	bx::free(ctx->m_ColorBufferPool, ptr);
-}
-
-static void releaseVertexBufferUVCallback(void* ptr, void* userData)
-{
-	Context* ctx = (Context*)userData;
-#if BX_CONFIG_SUPPORTS_THREADING
-	bx::MutexScope ms(*ctx->m_DataPoolMutex);
-#endif
-	bx::free(ctx->m_UVBufferPool, ptr);
-}
-
-static void releaseIndexBufferCallback(void* ptr, void* userData)
+static void releaseBufferCallback(void* ptr, void* userData)
 {
-	Context* ctx = (Context*)userData;
-	releaseIndexBuffer(ctx, (uint16_t*)ptr);
+	BX_UNUSED(ptr);
+	BufferRef* ref = (BufferRef*)userData;
+	if (bx::atomicFetchAndSub(&ref->m_NumPendingReleases, 1) == 1) {
+		pushBufferRef(ref);
+	}
 }
 } // namespace vg
 
@@ -1,6 +1,7 @@
 #include "vg_util.h"
 #include <vg/vg.h>
 #include <bx/bx.h>
+#include <string.h> // memcpy
 
 #if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
 #include <xmmintrin.h>
@@ -272,9 +273,46 @@ void batchTransformPositions(const float* __restrict v, uint32_t n, float* __res
 }
 #endif
 
-void genQuadIndices_unaligned(uint16_t* dst, uint32_t n, uint16_t firstVertexID)
+void genQuadIndices_unaligned(vg::index_t* dst, uint32_t n, vg::index_t firstVertexID)
 {
-#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
+#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86 && VG_CONFIG_INDEX_UINT32
+	BX_ALIGN_DECL(16, static const uint32_t delta[]) = {
+		0, 1, 2, 0, 2, 3,
+		4, 5, 6, 4, 6, 7,
+		8, 9, 10, 8, 10, 11,
+		12, 13, 14, 12, 14, 15
+	};
+
+	const __m128i xmm_delta0 = _mm_load_si128((const __m128i*)&delta[0]);
+	const __m128i xmm_delta1 = _mm_load_si128((const __m128i*)&delta[4]);
+	const __m128i xmm_delta2 = _mm_load_si128((const __m128i*)&delta[8]);
+	const __m128i xmm_delta3 = _mm_load_si128((const __m128i*)&delta[12]);
+	const __m128i xmm_delta4 = _mm_load_si128((const __m128i*)&delta[16]);
+	const __m128i xmm_delta5 = _mm_load_si128((const __m128i*)&delta[20]);
+
+	const uint32_t numIter = n >> 2; // 4 quads per iteration
+	for (uint32_t i = 0; i < numIter; ++i) {
+		const __m128i id = _mm_set1_epi32((int)firstVertexID);
+
+		_mm_storeu_si128((__m128i*)(dst + 0), _mm_add_epi32(id, xmm_delta0));
+		_mm_storeu_si128((__m128i*)(dst + 4), _mm_add_epi32(id, xmm_delta1));
+		_mm_storeu_si128((__m128i*)(dst + 8), _mm_add_epi32(id, xmm_delta2));
+		_mm_storeu_si128((__m128i*)(dst + 12), _mm_add_epi32(id, xmm_delta3));
+		_mm_storeu_si128((__m128i*)(dst + 16), _mm_add_epi32(id, xmm_delta4));
+		_mm_storeu_si128((__m128i*)(dst + 20), _mm_add_epi32(id, xmm_delta5));
+
+		dst += 24;
+		firstVertexID += 16;
+	}
+
+	uint32_t rem = n & 3;
+	while (rem-- > 0) {
+		dst[0] = firstVertexID; dst[1] = firstVertexID + 1; dst[2] = firstVertexID + 2;
+		dst[3] = firstVertexID; dst[4] = firstVertexID + 2; dst[5] = firstVertexID + 3;
+		dst += 6;
+		firstVertexID += 4;
+	}
+#elif VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
 	BX_ALIGN_DECL(16, static const uint16_t delta[]) = {
 		0, 1, 2, 0, 2, 3,
 		4, 5, 6, 4, 6, 7,
@@ -444,14 +482,66 @@ void batchTransformTextQuads(const float* __restrict quads, uint32_t n, const fl
 #endif
 }
 
-void batchTransformDrawIndices(const uint16_t* __restrict src, uint32_t n, uint16_t* __restrict dst, uint16_t delta)
+void batchTransformDrawIndices(const vg::index_t* __restrict src, uint32_t n, vg::index_t* __restrict dst, vg::index_t delta)
 {
 	if (delta == 0) {
-		bx::memCopy(dst, src, sizeof(uint16_t) * n);
+		bx::memCopy(dst, src, sizeof(vg::index_t) * n);
 		return;
 	}
 
-#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
+#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86 && VG_CONFIG_INDEX_UINT32
+	const __m128i xmm_delta = _mm_set1_epi32((int)delta);
+
+	const uint32_t iter16 = n >> 4;
+	for (uint32_t i = 0; i < iter16; ++i) {
+		const __m128i s0 = _mm_loadu_si128((const __m128i*)src);
+		const __m128i s1 = _mm_loadu_si128((const __m128i*)(src + 4));
+		const __m128i s2 = _mm_loadu_si128((const __m128i*)(src + 8));
+		const __m128i s3 = _mm_loadu_si128((const __m128i*)(src + 12));
+
+		const __m128i d0 = _mm_add_epi32(s0, xmm_delta);
+		const __m128i d1 = _mm_add_epi32(s1, xmm_delta);
+		const __m128i d2 = _mm_add_epi32(s2, xmm_delta);
+		const __m128i d3 = _mm_add_epi32(s3, xmm_delta);
+
+		// NOTE: Proper alignment of dst buffer isn't guaranteed because it's part of the global IndexBuffer.
+		_mm_storeu_si128((__m128i*)dst, d0);
+		_mm_storeu_si128((__m128i*)(dst + 4), d1);
+		_mm_storeu_si128((__m128i*)(dst + 8), d2);
+		_mm_storeu_si128((__m128i*)(dst + 12), d3);
+
+		src += 16;
+		dst += 16;
+	}
+
+	uint32_t rem = n & 15;
+	if (rem >= 8) {
+		const __m128i s0 = _mm_loadu_si128((const __m128i*)src);
+		const __m128i s1 = _mm_loadu_si128((const __m128i*)(src + 4));
+
+		_mm_storeu_si128((__m128i*)dst, _mm_add_epi32(s0, xmm_delta));
+		_mm_storeu_si128((__m128i*)(dst + 4), _mm_add_epi32(s1, xmm_delta));
+
+		src += 8;
+		dst += 8;
+		rem -= 8;
+	}
+
+	if (rem >= 4) {
+		const __m128i s0 = _mm_loadu_si128((const __m128i*)src);
+		_mm_storeu_si128((__m128i*)dst, _mm_add_epi32(s0, xmm_delta));
+
+		src += 4;
+		dst += 4;
+		rem -= 4;
+	}
+
+	switch (rem) {
+	case 3: *dst++ = *src++ + delta;
+	case 2: *dst++ = *src++ + delta;
+	case 1: *dst = *src + delta;
+	}
+#elif VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
 	const __m128i xmm_delta = _mm_set1_epi16(delta);
 
 	const uint32_t iter32 = n >> 5;
@@ -530,6 +620,145 @@ void convertA8_to_RGBA8(uint32_t* rgba, const uint8_t* a8, uint32_t w, uint32_t
 	}
 }
 
+// rect = { minx, miny, maxx, maxy } of the n 2D points in v (n > 0)
+void calcBoundingRect(const float* __restrict v, uint32_t n, float* __restrict rect)
+{
+	float minx = v[0], miny = v[1];
+	float maxx = v[0], maxy = v[1];
+	for (uint32_t i = 1; i < n; ++i) {
+		const float x = v[i * 2 + 0];
+		const float y = v[i * 2 + 1];
+		minx = bx::min<float>(minx, x);
+		miny = bx::min<float>(miny, y);
+		maxx = bx::max<float>(maxx, x);
+		maxy = bx::max<float>(maxy, y);
+	}
+
+	rect[0] = minx;
+	rect[1] = miny;
+	rect[2] = maxx;
+	rect[3] = maxy;
+}
+
+// dst = floor(mtx * src + 0.5) clamped to the int16 range (same as quantizePos2D()). mtx usually
+// includes the fixed point scale.
+void batchQuantizePositions(const float* __restrict src, uint32_t n, int16_t* __restrict dst, const float* __restrict mtx)
+{
+#if VG_CONFIG_ENABLE_SIMD && BX_CPU_X86
+	// x' = m[0] * x + m[2] * y + m[4];
+	// y' = m[1] * x + m[3] * y + m[5];
+	const __m128 mtx0101 = _mm_setr_ps(mtx[0], mtx[1], mtx[0], mtx[1]);
+	const __m128 mtx2323 = _mm_setr_ps(mtx[2], mtx[3], mtx[2], mtx[3]);
+	const __m128 mtx4545 = _mm_setr_ps(mtx[4], mtx[5], mtx[4], mtx[5]);
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 qmin = _mm_set1_ps(-32768.0f);
+	const __m128 qmax = _mm_set1_ps(32767.0f);
+
+	const uint32_t iter = n >> 2;
+	for (uint32_t i = 0; i < iter; ++i) {
+		const __m128 xy01 = _mm_loadu_ps(src + 0); // { x0, y0, x1, y1 }
+		const __m128 xy23 = _mm_loadu_ps(src + 4); // { x2, y2, x3, y3 }
+
+		const __m128 xx01 = _mm_shuffle_ps(xy01, xy01, _MM_SHUFFLE(2, 2, 0, 0)); // { x0, x0, x1, x1 }
+		const __m128 yy01 = _mm_shuffle_ps(xy01, xy01, _MM_SHUFFLE(3, 3, 1, 1)); // { y0, y0, y1, y1 }
+		const __m128 xx23 = _mm_shuffle_ps(xy23, xy23, _MM_SHUFFLE(2, 2, 0, 0));
+		const __m128 yy23 = _mm_shuffle_ps(xy23, xy23, _MM_SHUFFLE(3, 3, 1, 1));
+
+		const __m128 res01 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx01, mtx0101), _mm_mul_ps(yy01, mtx2323)), mtx4545);
+		const __m128 res23 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx23, mtx0101), _mm_mul_ps(yy23, mtx2323)), mtx4545);
+
+		// floor(x + 0.5): clamp (the bounds are integers so it doesn't matter that it happens before
+		// the floor), truncate and subtract 1 where truncation rounded negative values up.
+		const __m128 t01 = _mm_min_ps(_mm_max_ps(_mm_add_ps(res01, half), qmin), qmax);
+		const __m128 t23 = _mm_min_ps(_mm_max_ps(_mm_add_ps(res23, half), qmin), qmax);
+		const __m128i i01 = _mm_cvttps_epi32(t01);
+		const __m128i i23 = _mm_cvttps_epi32(t23);
+		const __m128i q01 = _mm_add_epi32(i01, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(i01), t01)));
+		const __m128i q23 = _mm_add_epi32(i23, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(i23), t23)));
+
+		const __m128i q0123 = _mm_packs_epi32(q01, q23);
+		_mm_storeu_si128((__m128i*)dst, q0123);
+
+		src += 8;
+		dst += 8;
+	}
+
+	n &= 3;
+#endif
+
+	for (uint32_t i = 0; i < n; ++i) {
+		quantizePos2D(src[0], src[1], mtx, dst);
+		src += 2;
+		dst += 2;
+	}
+}
+
+// colors[i] = color with its alpha scaled by coverage[i] / 255
+void batchModulateCoverage(const uint8_t* __restrict coverage, uint32_t n, uint32_t color, uint32_t* __restrict colors)
+{
+	const uint32_t rgb0 = color & 0x00FFFFFF;
+	const uint32_t a0 = color >> 24;
+
+	for (uint32_t i = 0; i < n; ++i) {
+		const uint32_t a = (a0 * (uint32_t)coverage[i] + 127) / 255;
+		colors[i] = rgb0 | (a << 24);
+	}
+}
+
+// colors[i] = color with its alpha scaled by the alpha of src[i]
+void batchModulateAlpha(const uint32_t* __restrict src, uint32_t n, uint32_t color, uint32_t* __restrict colors)
+{
+	const uint32_t rgb0 = color & 0x00FFFFFF;
+	const uint32_t a0 = color >> 24;
+
+	for (uint32_t i = 0; i < n; ++i) {
+		const uint32_t a = (a0 * (src[i] >> 24) + 127) / 255;
+		colors[i] = rgb0 | (a << 24);
+	}
+}
+
+// MurmurHash64A by Austin Appleby (public domain). Pass the hash of the previous block as the
+// seed to hash several blocks as one.
+uint64_t hashMurmur64A(const void* data, uint32_t size, uint64_t seed)
+{
+	const uint64_t m = 0xc6a4a7935bd1e995ull;
+	const uint32_t r = 47;
+
+	uint64_t h = seed ^ ((uint64_t)size * m);
+
+	const uint8_t* ptr = (const uint8_t*)data;
+	const uint8_t* end = ptr + (size & ~7u);
+	while (ptr != end) {
+		uint64_t k;
+		memcpy(&k, ptr, sizeof(uint64_t));
+		ptr += sizeof(uint64_t);
+
+		k *= m;
+		k ^= k >> r;
+		k *= m;
+
+		h ^= k;
+		h *= m;
+	}
+
+	switch (size & 7) {
+	case 7: h ^= (uint64_t)ptr[6] << 48;
+	case 6: h ^= (uint64_t)ptr[5] << 40;
+	case 5: h ^= (uint64_t)ptr[4] << 32;
+	case 4: h ^= (uint64_t)ptr[3] << 24;
+	case 3: h ^= (uint64_t)ptr[2] << 16;
+	case 2: h ^= (uint64_t)ptr[1] << 8;
+	case 1: h ^= (uint64_t)ptr[0];
+		h *= m;
+	}
+
+	h ^= h >> r;
+	h *= m;
+	h ^= h >> r;
+
+	return h;
+}
+
 PoolAllocator::PoolAllocator(uint32_t itemSize, uint32_t numItemsPerChunk, bx::AllocatorI* parentAllocator)
 	: m_ParentAllocator(parentAllocator)
 	, m_FirstChunk(nullptr)
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 #include <bx/allocator.h>
+#include <bx/math.h>
+#include <vg/vg.h>
 
 namespace vgutil
 {
@@ -10,15 +12,20 @@ void memset32(void* __restrict dst, uint32_t n, const void* __restrict src);
 void memset64(void* __restrict dst, uint32_t n64, const void* __restrict src);
 void memset128(void* __restrict dst, uint32_t n128, const void* __restrict src);
 
-void genQuadIndices_unaligned(uint16_t* dst, uint32_t numQuads, uint16_t firstVertexID);
+void genQuadIndices_unaligned(vg::index_t* dst, uint32_t numQuads, vg::index_t firstVertexID);
 
-void batchTransformDrawIndices(const uint16_t* __restrict src, uint32_t n, uint16_t* __restrict dst, uint16_t delta);
+void batchTransformDrawIndices(const vg::index_t* __restrict src, uint32_t n, vg::index_t* __restrict dst, vg::index_t delta);
 void batchTransformPositions(const float* __restrict v, uint32_t n, float* __restrict p, const float* __restrict mtx);
+void calcBoundingRect(const float* __restrict v, uint32_t n, float* __restrict rect);
+void batchQuantizePositions(const float* __restrict src, uint32_t n, int16_t* __restrict dst, const float* __restrict mtx);
 
 // quads == FONSquad { x1, y1, x2, y2, u1, v1, u2, v2 }
 void batchTransformTextQuads(const float* __restrict quads, uint32_t n, const float* __restrict mtx, float* __restrict transformedVertices);
 
 void convertA8_to_RGBA8(uint32_t* rgba, const uint8_t* a8, uint32_t w, uint32_t h, uint32_t rgbColor);
+void batchModulateCoverage(const uint8_t* __restrict coverage, uint32_t n, uint32_t color, uint32_t* __restrict colors);
+void batchModulateAlpha(const uint32_t* __restrict src, uint32_t n, uint32_t color, uint32_t* __restrict colors);
+uint64_t hashMurmur64A(const void* data, uint32_t size, uint64_t seed);
 
 bool invertMatrix3(const float* __restrict t, float* __restrict inv);
 
@@ -28,6 +35,18 @@ inline void transformPos2D(float x, float y, const float* __restrict mtx, float*
 	res[1] = mtx[1] * x + mtx[3] * y + mtx[5];
 }
 
+inline int16_t quantizeFloat(float v)
+{
+	const float q = bx::floor(v + 0.5f);
+	return (int16_t)(q < -32768.0f ? -32768.0f : (q > 32767.0f ? 32767.0f : q));
+}
+
+inline void quantizePos2D(float x, float y, const float* __restrict mtx, int16_t* __restrict res)
+{
+	res[0] = quantizeFloat(mtx[0] * x + mtx[2] * y + mtx[4]);
+	res[1] = quantizeFloat(mtx[1] * x + mtx[3] * y + mtx[5]);
+}
+
 inline void transformVec2D(float x, float y, const float* __restrict mtx, float* __restrict res)
 {
 	res[0] = mtx[0] * x + mtx[2] * y;